@@ -13,6 +13,8 @@
 
 #include "arcane/accelerator/CommonUtils.h"
 
+#include "arcane/utils/Math.h"
+
 #if defined(ARCANE_COMPILING_HIP)
 #include "arcane/accelerator/hip/HipAccelerator.h"
 #endif
@@ -71,6 +73,26 @@ toNativeStream(RunQueue* queue)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+Int32 MultiThreadAlgoHelper::
+computeNbBlock(Int32 nb_item)
+{
+  // Taille minimale d'un bloc pour que le coût de lancement des tâches
+  // reste négligeable par rapport au travail à effectuer.
+  const Int32 min_block_size = 8192;
+  Int32 nb_thread = TaskFactory::nbAllowedThread();
+  if (nb_thread <= 0)
+    nb_thread = 1;
+  // Utilise plusieurs blocs par thread pour équilibrer la charge.
+  Int32 nb_block = nb_thread * 4;
+  Int64 max_nb_block = (static_cast<Int64>(nb_item) + min_block_size - 1) / min_block_size;
+  if (nb_block > max_nb_block)
+    nb_block = static_cast<Int32>(max_nb_block);
+  return math::max(nb_block, 1);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 } // namespace Arcane::Accelerator::impl
 
 /*---------------------------------------------------------------------------*/
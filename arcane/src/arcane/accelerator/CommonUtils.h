@@ -14,6 +14,8 @@
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+#include "arcane/utils/ConcurrencyUtils.h"
+
 #include "arcane/accelerator/AcceleratorGlobal.h"
 #include "arcane/accelerator/core/RunQueue.h"
 
@@ -132,6 +134,80 @@ class DeviceStorage
   GenericDeviceStorage m_storage;
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Utilitaires pour les algorithmes multi-thread sur l'hôte.
+ *
+ * Ces algorithmes découpent l'intervalle [0,nb_item[ en blocs contigus
+ * traités chacun par une tâche. Le découpage ne dépend que du nombre
+ * d'éléments et du nombre de threads autorisés.
+ */
+class ARCANE_ACCELERATOR_EXPORT MultiThreadAlgoHelper
+{
+ public:
+
+  //! Nombre de blocs à utiliser pour traiter \a nb_item éléments
+  static Int32 computeNbBlock(Int32 nb_item);
+
+  //! Indice du premier élément du bloc \a block_index
+  static constexpr Int32 blockBegin(Int32 nb_item, Int32 nb_block, Int32 block_index)
+  {
+    return static_cast<Int32>((static_cast<Int64>(nb_item) * block_index) / nb_block);
+  }
+
+  /*!
+   * \brief Applique en concurrence \a func sur chacun des \a nb_block blocs.
+   *
+   * \a func doit avoir la signature `void func(Int32 block_index, Int32 begin, Int32 size)`.
+   */
+  template <typename Lambda> static void
+  applyByBlock(Int32 nb_item, Int32 nb_block, const Lambda& func)
+  {
+    auto block_func = [&](Integer begin_block, Integer nb) {
+      for (Int32 b = begin_block, end_block = begin_block + nb; b < end_block; ++b) {
+        Int32 begin = blockBegin(nb_item, nb_block, b);
+        Int32 end = blockBegin(nb_item, nb_block, b + 1);
+        func(b, begin, end - begin);
+      }
+    };
+    if (nb_block == 1) {
+      block_func(0, 1);
+      return;
+    }
+    LambdaRangeFunctorT<decltype(block_func)> functor(block_func);
+    ParallelLoopOptions options(TaskFactory::defaultParallelLoopOptions());
+    options.setGrainSize(1);
+    ParallelFor1DLoopInfo loop_info(0, nb_block, &functor, ForLoopRunInfo(options));
+    TaskFactory::executeParallelFor(loop_info);
+  }
+
+  /*!
+   * \brief Calcule la position du premier élément sélectionné de chaque bloc.
+   *
+   * En retour, \a block_offsets[b] contient le nombre d'éléments pour lesquels
+   * \a is_selected(i) est vrai dans les blocs précédant le bloc \a b et
+   * \a block_offsets[nb_block] contient le nombre total d'éléments sélectionnés.
+   * \a block_offsets doit avoir (nb_block+1) éléments.
+   */
+  template <typename SelectFunctor> static void
+  computeSelectedBlockOffsets(Int32 nb_item, Int32 nb_block, const SelectFunctor& is_selected,
+                              Span<Int32> block_offsets)
+  {
+    applyByBlock(nb_item, nb_block, [&](Int32 block_index, Int32 begin, Int32 size) {
+      Int32 nb_selected = 0;
+      for (Int32 i = begin, end = begin + size; i < end; ++i)
+        if (is_selected(i))
+          ++nb_selected;
+      block_offsets[block_index + 1] = nb_selected;
+    });
+    block_offsets[0] = 0;
+    for (Int32 b = 0; b < nb_block; ++b)
+      block_offsets[b + 1] += block_offsets[b];
+  }
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -15,6 +15,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "arcane/utils/ArrayView.h"
+#include "arcane/utils/Array.h"
 #include "arcane/utils/FatalErrorException.h"
 #include "arcane/utils/NumArray.h"
 
@@ -52,6 +53,37 @@ class ARCANE_ACCELERATOR_EXPORT GenericFilteringBase
   Int32 _nbOutputElement() const;
   void _allocate();
 
+  /*!
+   * \brief Filtrage multi-thread sur l'hôte.
+   *
+   * Le filtrage se fait en deux passes. La première calcule le nombre
+   * d'éléments conservés dans chaque bloc, ce qui permet d'obtenir par
+   * un scan la position dans \a output du premier élément de chaque bloc.
+   * La seconde recopie les éléments conservés. L'ordre des éléments en
+   * sortie est le même qu'en séquentiel.
+   *
+   * \a is_selected(i) indique si l'élément d'indice \a i est conservé.
+   */
+  template <typename DataType, typename SelectFunctor>
+  void _applyMultiThread(SmallSpan<const DataType> input, SmallSpan<DataType> output,
+                         const SelectFunctor& is_selected)
+  {
+    const Int32 nb_item = input.size();
+    const Int32 nb_block = MultiThreadAlgoHelper::computeNbBlock(nb_item);
+    UniqueArray<Int32> block_offsets(nb_block + 1);
+    MultiThreadAlgoHelper::computeSelectedBlockOffsets(nb_item, nb_block, is_selected, block_offsets);
+    MultiThreadAlgoHelper::applyByBlock(nb_item, nb_block, [&](Int32 block_index, Int32 begin, Int32 size) {
+      Int32 index = block_offsets[block_index];
+      for (Int32 i = begin, end = begin + size; i < end; ++i) {
+        if (is_selected(i)) {
+          output[index] = input[i];
+          ++index;
+        }
+      }
+    });
+    m_host_nb_out_storage[0] = block_offsets[nb_block];
+  }
+
  protected:
 
   RunQueue* m_queue = nullptr;
@@ -123,11 +155,12 @@ class GenericFilteringFlag
       ARCANE_CHECK_HIP(rocprim::select(s.m_algo_storage.address(), temp_storage_size, input_data, flag_data, output_data,
                                        nb_out_ptr, nb_item, stream));
       ARCANE_CHECK_HIP(::hipMemcpyAsync(s.m_host_nb_out_storage.bytes().data(), nb_out_ptr, sizeof(int), hipMemcpyDeviceToHost, stream));
-    }
+    } break;
 #endif
-    case eExecutionPolicy::Thread:
-      // Pas encore implémenté en multi-thread
-      [[fallthrough]];
+    case eExecutionPolicy::Thread: {
+      auto is_selected = [&](Int32 i) { return flag[i] != 0; };
+      s._applyMultiThread(input, output, is_selected);
+    } break;
     case eExecutionPolicy::Sequential: {
       Int32 index = 0;
       for (Int32 i = 0; i < nb_item; ++i) {
@@ -210,11 +243,12 @@ class GenericFilteringIf
       ARCANE_CHECK_HIP(rocprim::select(s.m_algo_storage.address(), temp_storage_size, input_data, output_data,
                                        nb_out_ptr, nb_item, select_lambda, stream));
       ARCANE_CHECK_HIP(::hipMemcpyAsync(s.m_host_nb_out_storage.bytes().data(), nb_out_ptr, sizeof(int), hipMemcpyDeviceToHost, stream));
-    }
+    } break;
 #endif
-    case eExecutionPolicy::Thread:
-      // Pas encore implémenté en multi-thread
-      [[fallthrough]];
+    case eExecutionPolicy::Thread: {
+      auto is_selected = [&](Int32 i) { return select_lambda(input[i]); };
+      s._applyMultiThread(input, output, is_selected);
+    } break;
     case eExecutionPolicy::Sequential: {
       Int32 index = 0;
       for (Int32 i = 0; i < nb_item; ++i) {
@@ -245,7 +279,9 @@ namespace Arcane::Accelerator
  * \brief Algorithme de filtrage sur accélérateur.
  *
  * Dans les méthodes suivantes, l'argument \a queue peut être nul auquel cas
- * l'algorithme s'applique sur l'hôte en séquentiel.
+ * l'algorithme s'applique sur l'hôte en séquentiel. Si la politique d'exécution
+ * de \a queue est eExecutionPolicy::Thread, l'algorithme utilise plusieurs
+ * threads. Dans ce cas, \a input et \a output ne doivent pas se recouvrir.
  */
 template <typename DataType>
 class Filterer
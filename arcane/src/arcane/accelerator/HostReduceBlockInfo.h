@@ -0,0 +1,161 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* HostReduceBlockInfo.h                                       (C) 2000-2023 */
+/*                                                                           */
+/* Découpage en blocs des boucles multi-thread contenant des réductions.     */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_ACCELERATOR_HOSTREDUCEBLOCKINFO_H
+#define ARCANE_ACCELERATOR_HOSTREDUCEBLOCKINFO_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/accelerator/AcceleratorGlobal.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Accelerator::impl
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Informations sur le bloc d'itérations en cours d'exécution pour
+ * les réductions sur l'hôte.
+ *
+ * Lorsqu'une commande contenant des réductions est exécutée avec la
+ * politique eExecutionPolicy::Thread, l'intervalle d'itération est découpé
+ * en blocs de computeBlockSize() itérations. Ce découpage ne dépend que du
+ * nombre d'itérations et pas du nombre de threads. Chaque bloc est exécuté
+ * séquentiellement avec sa propre copie
+ * de la lambda et chaque copie de réduction conserve sa valeur partielle
+ * dans l'emplacement associé au bloc, sans utiliser d'opérations atomiques.
+ *
+ * Ces informations sont propres à chaque thread et sont positionnées
+ * par HostReduceBlockScope avant la copie de la lambda.
+ */
+class ARCANE_ACCELERATOR_EXPORT HostReduceBlockInfo
+{
+  friend class HostReduceBlockScope;
+
+ public:
+
+  //! Nombre minimum d'itérations d'un bloc
+  static constexpr Int64 minBlockSize() { return 128; }
+
+  /*!
+   * \brief Nombre de blocs visé pour les grandes boucles.
+   *
+   * Cette valeur est fixe pour que le découpage ne dépende pas du nombre
+   * de threads. Elle permet d'avoir plusieurs blocs par thread jusqu'à
+   * quelques dizaines de threads et limite le nombre de valeurs partielles
+   * à conserver pour chaque réduction.
+   */
+  static constexpr Int64 targetNbBlock() { return 256; }
+
+  /*!
+   * \brief Nombre d'itérations d'un bloc pour une boucle de \a nb_item itérations.
+   *
+   * Vaut max(minBlockSize(),nb_item/targetNbBlock()) (arrondi au supérieur).
+   * Le nombre de blocs est donc au plus targetNbBlock() et une boucle de
+   * quelques milliers d'itérations est découpée en plusieurs blocs.
+   */
+  static constexpr Int64 computeBlockSize(Int64 nb_item)
+  {
+    Int64 block_size = (nb_item + targetNbBlock() - 1) / targetNbBlock();
+    return (block_size < minBlockSize()) ? minBlockSize() : block_size;
+  }
+
+  //! Nombre de blocs pour \a nb_item itérations
+  static constexpr Int32 computeNbBlock(Int64 nb_item)
+  {
+    const Int64 block_size = computeBlockSize(nb_item);
+    return static_cast<Int32>((nb_item + block_size - 1) / block_size);
+  }
+
+  //! Informations du thread courant
+  static HostReduceBlockInfo& current();
+
+ public:
+
+  //! Indique si on exécute une boucle découpée en blocs
+  bool isActive() const { return m_nb_block > 0; }
+
+  //! Nombre de blocs de la boucle
+  Int32 nbBlock() const { return m_nb_block; }
+
+  /*!
+   * \brief Indice du bloc en cours d'exécution.
+   *
+   * Vaut (-1) lors de la copie initiale de la lambda qui sert à détecter
+   * les réductions et à allouer les valeurs partielles.
+   */
+  Int32 blockIndex() const { return m_block_index; }
+
+  //! Indique si la copie en cours est la copie de détection des réductions
+  bool isProbe() const { return isActive() && m_block_index < 0; }
+
+  //! Signale qu'une réduction a été trouvée lors de la copie de détection
+  void registerReducer() { ++m_nb_reducer; }
+
+ private:
+
+  Int32 m_nb_block = 0;
+  Int32 m_block_index = -1;
+  Int32 m_nb_reducer = 0;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Positionne pour le thread courant le bloc en cours d'exécution.
+ *
+ * Les valeurs précédentes sont restaurées à la destruction de l'instance
+ * ce qui permet d'imbriquer les commandes.
+ */
+class HostReduceBlockScope
+{
+ public:
+
+  HostReduceBlockScope(Int32 nb_block, Int32 block_index)
+  : m_info(HostReduceBlockInfo::current())
+  , m_saved_info(m_info)
+  {
+    m_info.m_nb_block = nb_block;
+    m_info.m_block_index = block_index;
+    m_info.m_nb_reducer = 0;
+  }
+  ~HostReduceBlockScope()
+  {
+    m_info = m_saved_info;
+  }
+  HostReduceBlockScope(const HostReduceBlockScope&) = delete;
+  HostReduceBlockScope& operator=(const HostReduceBlockScope&) = delete;
+
+ public:
+
+  //! Nombre de réductions détectées depuis la création de l'instance
+  Int32 nbRegisteredReducer() const { return m_info.m_nb_reducer; }
+
+ private:
+
+  HostReduceBlockInfo& m_info;
+  HostReduceBlockInfo m_saved_info;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::Accelerator::impl
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
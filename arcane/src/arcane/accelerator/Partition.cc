@@ -0,0 +1,73 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* Partition.cc                                                (C) 2000-2023 */
+/*                                                                           */
+/* Algorithme de partitionnement.                                            */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/accelerator/Partition.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Accelerator::impl
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+GenericPartitionerBase::
+GenericPartitionerBase(RunQueue* queue)
+: m_queue(queue)
+{
+  _allocate();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Int32 GenericPartitionerBase::
+_nbFirstPart() const
+{
+  if (m_queue)
+    m_queue->barrier();
+  return m_host_nb_first_part_storage[0];
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void GenericPartitionerBase::
+_allocate()
+{
+  eMemoryRessource r = eMemoryRessource::Host;
+  if (m_queue && isAcceleratorPolicy(m_queue->executionPolicy()))
+    r = eMemoryRessource::HostPinned;
+  if (m_host_nb_first_part_storage.memoryRessource() != r)
+    m_host_nb_first_part_storage = NumArray<Int32, MDDim1>(r);
+  m_host_nb_first_part_storage.resize(1);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void GenericPartitionerBase::
+_checkSizes(Int32 nb_input, Int32 nb_output) const
+{
+  if (nb_input != nb_output)
+    ARCANE_FATAL("Sizes are not equals: input={0} output={1}", nb_input, nb_output);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Accelerator::impl
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,302 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* Partition.h                                                 (C) 2000-2023 */
+/*                                                                           */
+/* Algorithme de partitionnement.                                            */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_ACCELERATOR_PARTITION_H
+#define ARCANE_ACCELERATOR_PARTITION_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/ArrayView.h"
+#include "arcane/utils/Array.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/NumArray.h"
+
+#include "arcane/accelerator/AcceleratorGlobal.h"
+#include "arcane/accelerator/core/RunQueue.h"
+#include "arcane/accelerator/CommonUtils.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Accelerator::impl
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Classe de base pour effectuer un partitionnement.
+ */
+class ARCANE_ACCELERATOR_EXPORT GenericPartitionerBase
+{
+ public:
+
+  explicit GenericPartitionerBase(RunQueue* queue);
+
+ protected:
+
+  Int32 _nbFirstPart() const;
+
+  /*!
+   * \brief Partitionne \a input dans \a output.
+   *
+   * \a is_selected(i) indique si l'élément d'indice \a i est dans la
+   * première partie.
+   */
+  template <typename DataType, typename SelectFunctor>
+  void _applyHost(SmallSpan<const DataType> input, SmallSpan<DataType> output,
+                  const SelectFunctor& is_selected, bool is_multi_thread)
+  {
+    const Int32 nb_item = input.size();
+    const Int32 nb_block = (is_multi_thread) ? MultiThreadAlgoHelper::computeNbBlock(nb_item) : 1;
+    UniqueArray<Int32> block_offsets(nb_block + 1);
+    MultiThreadAlgoHelper::computeSelectedBlockOffsets(nb_item, nb_block, is_selected, block_offsets);
+    MultiThreadAlgoHelper::applyByBlock(nb_item, nb_block, [&](Int32 block_index, Int32 begin, Int32 size) {
+      Int32 first_index = block_offsets[block_index];
+      // Nombre d'éléments non sélectionnés dans les blocs précédents
+      Int32 last_index = begin - first_index;
+      for (Int32 i = begin, end = begin + size; i < end; ++i) {
+        if (is_selected(i)) {
+          output[first_index] = input[i];
+          ++first_index;
+        }
+        else {
+          output[nb_item - 1 - last_index] = input[i];
+          ++last_index;
+        }
+      }
+    });
+    m_host_nb_first_part_storage[0] = block_offsets[nb_block];
+  }
+
+  template <typename DataType, typename FlagType>
+  void _applyFlag(SmallSpan<const DataType> input, SmallSpan<DataType> output, SmallSpan<const FlagType> flag)
+  {
+    const Int32 nb_item = input.size();
+    _checkSizes(nb_item, output.size());
+    _checkSizes(nb_item, flag.size());
+    [[maybe_unused]] const DataType* input_data = input.data();
+    [[maybe_unused]] DataType* output_data = output.data();
+    [[maybe_unused]] const FlagType* flag_data = flag.data();
+    eExecutionPolicy exec_policy = eExecutionPolicy::Sequential;
+    if (m_queue)
+      exec_policy = m_queue->executionPolicy();
+    switch (exec_policy) {
+#if defined(ARCANE_COMPILING_CUDA)
+    case eExecutionPolicy::CUDA: {
+      size_t temp_storage_size = 0;
+      cudaStream_t stream = impl::CudaUtils::toNativeStream(m_queue);
+      // Premier appel pour connaitre la taille pour l'allocation
+      int* nb_out_ptr = nullptr;
+      ARCANE_CHECK_CUDA(::cub::DevicePartition::Flagged(nullptr, temp_storage_size,
+                                                        input_data, flag_data, output_data, nb_out_ptr, nb_item, stream));
+
+      m_algo_storage.allocate(temp_storage_size);
+      m_device_nb_first_part_storage.allocate();
+      nb_out_ptr = m_device_nb_first_part_storage.address();
+      ARCANE_CHECK_CUDA(::cub::DevicePartition::Flagged(m_algo_storage.address(), temp_storage_size,
+                                                        input_data, flag_data, output_data, nb_out_ptr, nb_item, stream));
+      ARCANE_CHECK_CUDA(::cudaMemcpyAsync(m_host_nb_first_part_storage.bytes().data(), nb_out_ptr, sizeof(int), cudaMemcpyDeviceToHost, stream));
+    } break;
+#endif
+#if defined(ARCANE_COMPILING_HIP)
+    case eExecutionPolicy::HIP: {
+      size_t temp_storage_size = 0;
+      // Premier appel pour connaitre la taille pour l'allocation
+      hipStream_t stream = impl::HipUtils::toNativeStream(m_queue);
+      int* nb_out_ptr = nullptr;
+      ARCANE_CHECK_HIP(rocprim::partition(nullptr, temp_storage_size, input_data, flag_data, output_data,
+                                          nb_out_ptr, nb_item, stream));
+
+      m_algo_storage.allocate(temp_storage_size);
+      m_device_nb_first_part_storage.allocate();
+      nb_out_ptr = m_device_nb_first_part_storage.address();
+
+      ARCANE_CHECK_HIP(rocprim::partition(m_algo_storage.address(), temp_storage_size, input_data, flag_data, output_data,
+                                          nb_out_ptr, nb_item, stream));
+      ARCANE_CHECK_HIP(::hipMemcpyAsync(m_host_nb_first_part_storage.bytes().data(), nb_out_ptr, sizeof(int), hipMemcpyDeviceToHost, stream));
+    } break;
+#endif
+    case eExecutionPolicy::Thread:
+    case eExecutionPolicy::Sequential: {
+      auto is_selected = [&](Int32 i) { return flag[i] != 0; };
+      _applyHost(input, output, is_selected, exec_policy == eExecutionPolicy::Thread);
+    } break;
+    default:
+      ARCANE_FATAL(getBadPolicyMessage(exec_policy));
+    }
+  }
+
+  template <typename DataType, typename SelectLambda>
+  void _applyIf(SmallSpan<const DataType> input, SmallSpan<DataType> output, const SelectLambda& select_lambda)
+  {
+    const Int32 nb_item = input.size();
+    _checkSizes(nb_item, output.size());
+    [[maybe_unused]] const DataType* input_data = input.data();
+    [[maybe_unused]] DataType* output_data = output.data();
+    eExecutionPolicy exec_policy = eExecutionPolicy::Sequential;
+    if (m_queue)
+      exec_policy = m_queue->executionPolicy();
+    switch (exec_policy) {
+#if defined(ARCANE_COMPILING_CUDA)
+    case eExecutionPolicy::CUDA: {
+      size_t temp_storage_size = 0;
+      cudaStream_t stream = impl::CudaUtils::toNativeStream(m_queue);
+      // Premier appel pour connaitre la taille pour l'allocation
+      int* nb_out_ptr = nullptr;
+      ARCANE_CHECK_CUDA(::cub::DevicePartition::If(nullptr, temp_storage_size,
+                                                   input_data, output_data, nb_out_ptr, nb_item,
+                                                   select_lambda, stream));
+
+      m_algo_storage.allocate(temp_storage_size);
+      m_device_nb_first_part_storage.allocate();
+      nb_out_ptr = m_device_nb_first_part_storage.address();
+      ARCANE_CHECK_CUDA(::cub::DevicePartition::If(m_algo_storage.address(), temp_storage_size,
+                                                   input_data, output_data, nb_out_ptr, nb_item,
+                                                   select_lambda, stream));
+      ARCANE_CHECK_CUDA(::cudaMemcpyAsync(m_host_nb_first_part_storage.bytes().data(), nb_out_ptr, sizeof(int), cudaMemcpyDeviceToHost, stream));
+    } break;
+#endif
+#if defined(ARCANE_COMPILING_HIP)
+    case eExecutionPolicy::HIP: {
+      size_t temp_storage_size = 0;
+      // Premier appel pour connaitre la taille pour l'allocation
+      hipStream_t stream = impl::HipUtils::toNativeStream(m_queue);
+      int* nb_out_ptr = nullptr;
+      ARCANE_CHECK_HIP(rocprim::partition(nullptr, temp_storage_size, input_data, output_data,
+                                          nb_out_ptr, nb_item, select_lambda, stream));
+
+      m_algo_storage.allocate(temp_storage_size);
+      m_device_nb_first_part_storage.allocate();
+      nb_out_ptr = m_device_nb_first_part_storage.address();
+
+      ARCANE_CHECK_HIP(rocprim::partition(m_algo_storage.address(), temp_storage_size, input_data, output_data,
+                                          nb_out_ptr, nb_item, select_lambda, stream));
+      ARCANE_CHECK_HIP(::hipMemcpyAsync(m_host_nb_first_part_storage.bytes().data(), nb_out_ptr, sizeof(int), hipMemcpyDeviceToHost, stream));
+    } break;
+#endif
+    case eExecutionPolicy::Thread:
+    case eExecutionPolicy::Sequential: {
+      auto is_selected = [&](Int32 i) { return select_lambda(input[i]); };
+      _applyHost(input, output, is_selected, exec_policy == eExecutionPolicy::Thread);
+    } break;
+    default:
+      ARCANE_FATAL(getBadPolicyMessage(exec_policy));
+    }
+  }
+
+ private:
+
+  void _allocate();
+  void _checkSizes(Int32 nb_input, Int32 nb_output) const;
+
+ protected:
+
+  RunQueue* m_queue = nullptr;
+  GenericDeviceStorage m_algo_storage;
+  DeviceStorage<int> m_device_nb_first_part_storage;
+  NumArray<Int32, MDDim1> m_host_nb_first_part_storage;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Accelerator::impl
+
+namespace Arcane::Accelerator
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Algorithme de partitionnement sur accélérateur.
+ *
+ * Le partitionnement sépare les éléments d'un tableau en deux parties en
+ * fonction d'un critère. Contrairement au filtrage (voir Filterer), les
+ * éléments non sélectionnés sont conservés. Après partitionnement, le
+ * tableau de sortie contient:
+ * - au début, les éléments sélectionnés dans le même ordre qu'en entrée,
+ * - à la fin, les éléments non sélectionnés dans l'ordre inverse de l'entrée.
+ *
+ * L'algorithme séquentiel est le suivant:
+ *
+ * \code
+ * Int32 first_index = 0;
+ * Int32 last_index = nb_item - 1;
+ * for (Int32 i = 0; i < nb_item; ++i) {
+ *   if (is_selected(input[i]))
+ *     output[first_index++] = input[i];
+ *   else
+ *     output[last_index--] = input[i];
+ * }
+ * \endcode
+ *
+ * Il faut appeler nbFirstPart() pour obtenir le nombre d'éléments
+ * de la première partie.
+ *
+ * Si \a queue est nul, l'algorithme s'applique sur l'hôte en séquentiel. Si
+ * la politique d'exécution de \a queue est eExecutionPolicy::Thread,
+ * l'algorithme utilise plusieurs threads. Dans tous les cas, \a input et
+ * \a output ne doivent pas se recouvrir.
+ */
+template <typename DataType>
+class GenericPartitioner
+: private impl::GenericPartitionerBase
+{
+ public:
+
+  explicit GenericPartitioner(RunQueue* queue)
+  : impl::GenericPartitionerBase(queue)
+  {}
+
+ public:
+
+  /*!
+   * \brief Partitionne \a input en fonction de \a flag.
+   *
+   * Les éléments pour lesquels \a flag est différent de 0 sont dans la
+   * première partie.
+   */
+  template <typename FlagType>
+  void apply(SmallSpan<const DataType> input, SmallSpan<DataType> output, SmallSpan<const FlagType> flag)
+  {
+    _applyFlag(input, output, flag);
+  }
+
+  /*!
+   * \brief Partitionne \a input en fonction de \a select_lambda.
+   *
+   * Les éléments pour lesquels \a select_lambda vaut \a true sont dans la
+   * première partie. \a select_lambda doit avoir un opérateur
+   * `ARCCORE_HOST_DEVICE bool operator()(const DataType& v) const`.
+   */
+  template <typename SelectLambda>
+  void applyIf(SmallSpan<const DataType> input, SmallSpan<DataType> output, const SelectLambda& select_lambda)
+  {
+    _applyIf(input, output, select_lambda);
+  }
+
+  //! Nombre d'éléments de la première partie
+  Int32 nbFirstPart() const { return _nbFirstPart(); }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Accelerator
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
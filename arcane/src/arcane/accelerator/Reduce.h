@@ -16,13 +16,17 @@
 
 #include "arcane/utils/ArrayView.h"
 #include "arcane/utils/String.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/ExactRealSum.h"
 
 #include "arcane/accelerator/core/IReduceMemoryImpl.h"
 #include "arcane/accelerator/AcceleratorGlobal.h"
+#include "arcane/accelerator/HostReduceBlockInfo.h"
 
 #include <limits.h>
 #include <float.h>
 #include <atomic>
+#include <mutex>
 #include <iostream>
 
 #if defined(__HIP__)
@@ -164,6 +168,10 @@ class ReduceFunctorSum
   {
     return ReduceAtomicSum<DataType>::apply(ptr,v);
   }
+  ARCCORE_HOST_DEVICE static void combine(DataType& a,const DataType& b)
+  {
+    a += b;
+  }
  public:
   ARCCORE_HOST_DEVICE static constexpr
   DataType identity() { return impl::ReduceIdentity<DataType>::sumValue(); }
@@ -188,6 +196,10 @@ class ReduceFunctorMax
     while(prev_value < v && !ptr->compare_exchange_weak(prev_value, v)) {}
     return *ptr;
   }
+  ARCCORE_HOST_DEVICE static void combine(DataType& a,const DataType& b)
+  {
+    a = (b>a) ? b : a;
+  }
  public:
   ARCCORE_HOST_DEVICE static constexpr
   DataType identity() { return impl::ReduceIdentity<DataType>::maxValue(); }
@@ -212,6 +224,10 @@ class ReduceFunctorMin
     while(prev_value > v && !ptr->compare_exchange_weak(prev_value, v)) {}
     return *ptr;
   }
+  ARCCORE_HOST_DEVICE static void combine(DataType& a,const DataType& b)
+  {
+    a = (b<a) ? b : a;
+  }
  public:
   ARCCORE_HOST_DEVICE static constexpr
   DataType identity() { return impl::ReduceIdentity<DataType>::minValue(); }
@@ -220,6 +236,82 @@ class ReduceFunctorMin
   void _applyDevice(const ReduceDeviceInfo<DataType>& dev_info);
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Valeurs partielles par bloc des réductions sur l'hôte.
+ *
+ * Il y a une valeur par bloc d'itérations (voir HostReduceBlockInfo). Chaque
+ * valeur occupe sa propre ligne de cache pour éviter les faux partages entre
+ * les threads. Le tableau n'est réalloué que si le nombre de blocs augmente
+ * et n'est donc alloué qu'une seule fois par commande.
+ */
+template<typename DataType>
+class HostReduceBlockStorage
+{
+  struct alignas(64) PaddedValue
+  {
+    DataType value;
+  };
+
+ public:
+
+  HostReduceBlockStorage() = default;
+  ~HostReduceBlockStorage() { delete[] m_values; }
+  HostReduceBlockStorage(const HostReduceBlockStorage&) = delete;
+  HostReduceBlockStorage& operator=(const HostReduceBlockStorage&) = delete;
+
+ public:
+
+  //! Indique s'il y a des valeurs partielles à combiner
+  bool hasValues() const { return m_nb_block>0; }
+
+  //! Positionne le nombre de blocs à \a nb_block et initialise les valeurs avec \a identity
+  void reset(Int32 nb_block,const DataType& identity)
+  {
+    if (nb_block>m_capacity){
+      delete[] m_values;
+      m_values = new PaddedValue[nb_block];
+      m_capacity = nb_block;
+    }
+    m_nb_block = nb_block;
+    for( Int32 i=0; i<nb_block; ++i )
+      m_values[i].value = identity;
+  }
+
+  //! Valeur partielle du bloc \a block_index
+  DataType& value(Int32 block_index) { return m_values[block_index].value; }
+
+  /*!
+   * \brief Combine les valeurs partielles et retourne le résultat.
+   *
+   * Les valeurs sont combinées deux à deux selon un arbre binaire dont la
+   * forme ne dépend que du nombre de blocs. \a ReduceOperator::combine(a,b)
+   * doit combiner \a b dans \a a. Après cet appel, il n'y a plus de valeurs
+   * partielles.
+   */
+  template<typename ReduceOperator> DataType treeReduce()
+  {
+    const Int32 n = m_nb_block;
+    for( Int32 stride=1; stride<n; stride *= 2 )
+      for( Int32 i=0; (i+stride)<n; i += 2*stride )
+        ReduceOperator::combine(m_values[i].value,m_values[i+stride].value);
+    m_nb_block = 0;
+    return m_values[0].value;
+  }
+
+  //! Verrou pour les copies qui ne sont pas associées à un bloc
+  std::mutex& mutex() { return m_mutex; }
+
+ private:
+
+  PaddedValue* m_values = nullptr;
+  Int32 m_nb_block = 0;
+  Int32 m_capacity = 0;
+  std::mutex m_mutex;
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -250,6 +342,13 @@ class ReduceFunctorMin
  * Sur l'hôte, on utilise un 'std::atomic' pour conserver la valeur commune
  * entre les threads. Cette valeur est référencée par 'm_parent_value' et n'est
  * valide que sur l'hôte.
+ *
+ * Avec la politique eExecutionPolicy::Thread, la boucle est découpée en blocs
+ * dont la taille ne dépend que du nombre d'itérations (voir
+ * impl::HostReduceBlockInfo). Chaque copie associée à un
+ * bloc conserve sa valeur dans 'm_block_storage' sans utiliser d'atomiques et
+ * ces valeurs sont combinées selon un arbre binaire lors de l'appel à reduce().
+ * Le résultat est alors identique quel que soit le nombre de threads.
  */
 template<typename DataType,typename ReduceFunctor>
 class Reducer
@@ -270,6 +369,8 @@ class Reducer
       m_host_or_device_memory_for_reduced_value = impl::allocateReduceDataMemory<DataType>(m_memory_impl,m_identity);
       m_grid_memory_info = m_memory_impl->gridMemoryInfo();
     }
+    else
+      m_block_storage = new impl::HostReduceBlockStorage<DataType>();
   }
   ARCCORE_HOST_DEVICE Reducer(const Reducer& rhs)
   : m_host_or_device_memory_for_reduced_value(rhs.m_host_or_device_memory_for_reduced_value), m_local_value(rhs.m_local_value), m_identity(rhs.m_identity)
@@ -288,6 +389,8 @@ class Reducer
     m_parent_value = rhs.m_parent_value;
     m_local_value = rhs.m_identity;
     m_atomic_value = m_identity;
+    m_block_storage = rhs.m_block_storage;
+    _setHostBlock();
     //std::cout << String::format("Reduce copy host  this={0} parent_value={1} rhs={2}\n",this,(void*)m_parent_value,&rhs); std::cout.flush();
     //if (!rhs.m_is_master_instance)
     //ARCANE_FATAL("Only copy from master instance is allowed");
@@ -324,12 +427,16 @@ class Reducer
     //std::cout << String::format("Reduce destructor this={0} grid_data={1} grid_size={2}\n",
     //                            this,(void*)m_grid_memory_value_as_bytes,m_grid_memory_size);
     //std::cout.flush();
-    if (!m_is_master_instance)
+    if (m_block_index>=0)
+      ReduceFunctor::combine(m_block_storage->value(m_block_index),m_local_value);
+    else if (!m_is_master_instance && !m_is_probe_instance)
       ReduceFunctor::apply(m_parent_value,m_local_value);
 
     //printf("Destroy host %p %p\n",m_host_or_device_memory_for_reduced_value,this);
     if (m_memory_impl && m_is_master_instance)
       m_memory_impl->release();
+    if (m_is_master_instance)
+      delete m_block_storage;
 #endif
   }
  public:
@@ -344,6 +451,7 @@ class Reducer
   //! Effectue la réduction et récupère la valeur. ATTENTION: ne faire qu'une seule fois.
   DataType reduce()
   {
+    _foldHostBlockValues();
     // Si la réduction est faite sur accélérateur, il faut recopier la valeur du device sur l'hôte.
     DataType* final_ptr = m_host_or_device_memory_for_reduced_value;
     if (m_memory_impl){
@@ -365,6 +473,35 @@ class Reducer
     }
     return *final_ptr;
   }
+ private:
+  /*!
+   * \brief Associe l'instance au bloc en cours d'exécution.
+   *
+   * Lors de la copie de détection, alloue les valeurs partielles de chaque
+   * bloc après avoir combiné celles d'une éventuelle commande précédente.
+   */
+  void _setHostBlock()
+  {
+    if (!m_block_storage)
+      return;
+    impl::HostReduceBlockInfo& block_info = impl::HostReduceBlockInfo::current();
+    if (!block_info.isActive())
+      return;
+    if (block_info.isProbe()){
+      block_info.registerReducer();
+      _foldHostBlockValues();
+      m_block_storage->reset(block_info.nbBlock(),m_identity);
+      m_is_probe_instance = true;
+    }
+    else
+      m_block_index = block_info.blockIndex();
+  }
+  //! Combine les valeurs partielles des blocs dans la valeur commune
+  void _foldHostBlockValues()
+  {
+    if (m_block_storage && m_block_storage->hasValues())
+      ReduceFunctor::apply(m_parent_value,m_block_storage->template treeReduce<ReduceFunctor>());
+  }
  protected:
   impl::IReduceMemoryImpl* m_memory_impl = nullptr;
   /*!
@@ -383,9 +520,15 @@ class Reducer
   mutable std::atomic<DataType> m_atomic_value;
  private:
   DataType m_identity;
+ private:
+  //! Valeurs partielles par bloc (uniquement sur l'hôte)
+  impl::HostReduceBlockStorage<DataType>* m_block_storage = nullptr;
+  //! Indice du bloc associé à cette instance ou (-1) si aucun
+  Int32 m_block_index = -1;
  private:
   bool m_is_allocated = false;
   bool m_is_master_instance = false;
+  bool m_is_probe_instance = false;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -451,6 +594,218 @@ class ReducerMin
   }
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Réduction sur l'hôte d'une valeur quelconque.
+ *
+ * Cette classe permet d'effectuer en une seule passe une réduction portant
+ * sur plusieurs valeurs regroupées dans une structure \a DataType. Elle n'est
+ * disponible que pour les politiques d'exécution eExecutionPolicy::Sequential
+ * et eExecutionPolicy::Thread.
+ *
+ * \a ReduceOperator doit fournir les deux méthodes statiques suivantes:
+ * \code
+ * static DataType identity();
+ * static void combine(DataType& a,const DataType& b); // Combine \a b dans \a a
+ * \endcode
+ *
+ * Ces deux méthodes doivent être ARCCORE_HOST_DEVICE si le code est compilé
+ * pour les accélérateurs. Comme pour Reducer, avec la politique
+ * eExecutionPolicy::Thread le résultat ne dépend pas du nombre de threads.
+ *
+ * Par exemple, pour calculer en même temps la somme et le maximum:
+ *
+ * \code
+ * struct SumMax { double sum; double max; };
+ * struct SumMaxOperator
+ * {
+ *   static SumMax identity() { return { 0.0, -DBL_MAX }; }
+ *   static void combine(SumMax& a,const SumMax& b)
+ *   {
+ *     a.sum += b.sum;
+ *     a.max = math::max(a.max,b.max);
+ *   }
+ * };
+ * auto command = makeCommand(queue);
+ * ax::HostReducer<SumMax,SumMaxOperator> reducer(command);
+ * command << RUNCOMMAND_LOOP1(iter,n)
+ * {
+ *   double v = in_values(iter);
+ *   reducer.combine({ v, v });
+ * };
+ * SumMax r = reducer.reduce();
+ * \endcode
+ */
+template<typename DataType,typename ReduceOperator>
+class HostReducer
+{
+ public:
+  explicit HostReducer(RunCommand& command)
+  : m_local_value(ReduceOperator::identity()), m_shared_value(ReduceOperator::identity())
+  {
+    impl::IReduceMemoryImpl* memory_impl = impl::internalGetOrCreateReduceMemoryImpl(&command);
+    if (memory_impl){
+      memory_impl->release();
+      ARCANE_FATAL("HostReducer is only available for host execution policies");
+    }
+    m_is_master_instance = true;
+    m_master_shared_value = &m_shared_value;
+    m_block_storage = new impl::HostReduceBlockStorage<DataType>();
+  }
+  ARCCORE_HOST_DEVICE HostReducer(const HostReducer& rhs)
+  : m_local_value(ReduceOperator::identity()), m_shared_value(ReduceOperator::identity())
+  {
+#ifndef ARCCORE_DEVICE_CODE
+    m_master_shared_value = rhs.m_master_shared_value;
+    m_block_storage = rhs.m_block_storage;
+    impl::HostReduceBlockInfo& block_info = impl::HostReduceBlockInfo::current();
+    if (block_info.isActive()){
+      if (block_info.isProbe()){
+        block_info.registerReducer();
+        _foldHostBlockValues();
+        m_block_storage->reset(block_info.nbBlock(),ReduceOperator::identity());
+        m_is_probe_instance = true;
+      }
+      else
+        m_block_index = block_info.blockIndex();
+    }
+#endif
+  }
+  HostReducer(HostReducer&& rhs) = delete;
+  HostReducer& operator=(const HostReducer& rhs) = delete;
+
+  ARCCORE_HOST_DEVICE ~HostReducer()
+  {
+#ifndef ARCCORE_DEVICE_CODE
+    if (m_block_index>=0)
+      ReduceOperator::combine(m_block_storage->value(m_block_index),m_local_value);
+    else if (!m_is_master_instance && !m_is_probe_instance){
+      std::lock_guard<std::mutex> lock(m_block_storage->mutex());
+      ReduceOperator::combine(*m_master_shared_value,m_local_value);
+    }
+    if (m_is_master_instance)
+      delete m_block_storage;
+#endif
+  }
+
+ public:
+
+  //! Combine \a v dans la valeur locale
+  ARCCORE_HOST_DEVICE void combine(const DataType& v) const
+  {
+    ReduceOperator::combine(m_local_value,v);
+  }
+  ARCCORE_HOST_DEVICE DataType localValue() const
+  {
+    return m_local_value;
+  }
+  //! Effectue la réduction et récupère la valeur. ATTENTION: ne faire qu'une seule fois.
+  DataType reduce()
+  {
+    _foldHostBlockValues();
+    ReduceOperator::combine(m_shared_value,m_local_value);
+    return m_shared_value;
+  }
+
+ private:
+
+  //! Combine les valeurs partielles des blocs dans la valeur commune
+  void _foldHostBlockValues()
+  {
+    if (m_block_storage->hasValues()){
+      DataType v = m_block_storage->template treeReduce<ReduceOperator>();
+      std::lock_guard<std::mutex> lock(m_block_storage->mutex());
+      ReduceOperator::combine(*m_master_shared_value,v);
+    }
+  }
+
+ protected:
+
+  mutable DataType m_local_value;
+
+ private:
+
+  //! Valeur commune (uniquement pour l'instance maître)
+  DataType m_shared_value;
+  DataType* m_master_shared_value = nullptr;
+  impl::HostReduceBlockStorage<DataType>* m_block_storage = nullptr;
+  Int32 m_block_index = -1;
+  bool m_is_master_instance = false;
+  bool m_is_probe_instance = false;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace impl
+{
+  //! Opérateur de réduction pour ExactRealSum
+  class ExactRealSumOperator
+  {
+   public:
+    static ARCCORE_HOST_DEVICE ExactRealSum identity() { return {}; }
+    static ARCCORE_HOST_DEVICE void combine(ExactRealSum& a,const ExactRealSum& b) { a.add(b); }
+  };
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Somme reproductible de réels.
+ *
+ * Contrairement à ReducerSum, le résultat est identique au bit près quel que
+ * soit l'ordre des itérations, la politique d'exécution hôte ou le nombre de
+ * threads. Les valeurs sont accumulées de manière exacte dans une instance
+ * de ExactRealSum et l'arrondi n'est effectué qu'une seule fois lors de
+ * l'appel à reduce(). L'accumulation est plus coûteuse qu'une addition
+ * classique.
+ *
+ * Comme HostReducer, cette classe n'est disponible que pour les politiques
+ * d'exécution eExecutionPolicy::Sequential et eExecutionPolicy::Thread.
+ *
+ * Pour que le résultat ne dépende pas non plus du nombre de sous-domaines,
+ * il faut réduire l'accumulateur retourné par reduceExactSum() avec
+ * ParallelMngUtils::reduceExactSum() plutôt que la valeur retournée par
+ * reduce():
+ *
+ * \code
+ * auto command = makeCommand(queue);
+ * ax::ReducerReproducibleSum reducer(command);
+ * command << RUNCOMMAND_LOOP1(iter,n)
+ * {
+ *   reducer.add(in_values(iter));
+ * };
+ * ExactRealSum local_sum = reducer.reduceExactSum();
+ * ParallelMngUtils::reduceExactSum(pm,ArrayView<ExactRealSum>(1,&local_sum));
+ * Real global_sum = local_sum.toReal();
+ * \endcode
+ */
+class ReducerReproducibleSum
+: public HostReducer<ExactRealSum,impl::ExactRealSumOperator>
+{
+  using BaseClass = HostReducer<ExactRealSum,impl::ExactRealSumOperator>;
+  using BaseClass::m_local_value;
+ public:
+  explicit ReducerReproducibleSum(RunCommand& command) : BaseClass(command){}
+ public:
+  //! Ajoute \a v à la valeur locale
+  ARCCORE_HOST_DEVICE void add(Real v) const
+  {
+    m_local_value.add(v);
+  }
+  //! Effectue la réduction et récupère la valeur. ATTENTION: ne faire qu'une seule fois.
+  Real reduce()
+  {
+    return BaseClass::reduce().toReal();
+  }
+  //! Effectue la réduction et récupère l'accumulateur exact. ATTENTION: ne faire qu'une seule fois.
+  ExactRealSum reduceExactSum()
+  {
+    return BaseClass::reduce();
+  }
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
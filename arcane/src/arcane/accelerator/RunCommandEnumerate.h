@@ -81,11 +81,15 @@ _applyItems(RunCommand& command,ItemVectorViewT<ItemType> items,const Lambda& fu
     }
     break;
   case eExecutionPolicy::Thread:
-    arcaneParallelForeach(items,launch_info.loopRunInfo(),
-                          [&](ItemVectorViewT<ItemType> sub_items)
-                          {
-                            impl::_doIndirectThreadLambda(sub_items,func);
-                          });
+  {
+    auto apply_func = [&](auto& body,Int64 i){ body(LocalIdType(items[static_cast<Int32>(i)].localId())); };
+    if (!impl::doThreadLambdaByReduceBlock(vsize,launch_info.loopRunInfo(),func,apply_func))
+      arcaneParallelForeach(items,launch_info.loopRunInfo(),
+                            [&](ItemVectorViewT<ItemType> sub_items)
+                            {
+                              impl::_doIndirectThreadLambda(sub_items,func);
+                            });
+  }
     break;
   default:
     ARCANE_FATAL("Invalid execution policy '{0}'",exec_policy);
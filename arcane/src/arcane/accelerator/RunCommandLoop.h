@@ -19,6 +19,8 @@
 #include "arcane/accelerator/RunCommand.h"
 #include "arcane/accelerator/RunQueueInternal.h"
 
+#include <limits>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -56,7 +58,18 @@ _applyGenericLoop(RunCommand& command,LoopBoundType<N> bounds,const Lambda& func
     arcaneSequentialFor(bounds,func);
     break;
   case eExecutionPolicy::Thread:
-    arcaneParallelFor(bounds,launch_info.computeParallelLoopOptions(vsize),func);
+  {
+    ParallelLoopOptions loop_options(launch_info.computeParallelLoopOptions(vsize));
+    // L'indice linéaire de getIndices() est sur 32 bits. Au delà, on utilise
+    // la boucle multi-thread classique qui parcourt chaque dimension.
+    bool is_done = false;
+    if (vsize<=std::numeric_limits<Int32>::max()){
+      auto apply_func = [&](auto& body,Int64 i){ body(bounds.getIndices(static_cast<Int32>(i))); };
+      is_done = impl::doThreadLambdaByReduceBlock(vsize,ForLoopRunInfo(loop_options),func,apply_func);
+    }
+    if (!is_done)
+      arcaneParallelFor(bounds,loop_options,func);
+  }
     break;
   default:
     ARCANE_FATAL("Invalid execution policy '{0}'",exec_policy);
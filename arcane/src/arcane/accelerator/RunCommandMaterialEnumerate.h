@@ -379,13 +379,15 @@ _applyEnvCells(RunCommand& command, ContainerType items, const Lambda& func)
     for (Int32 i = 0, n = vsize; i < n; ++i)
       func(items[i]);
     break;
-  case eExecutionPolicy::Thread:
-    arcaneParallelFor(0, vsize, launch_info.loopRunInfo(),
-                      [&](Int32 begin, Int32 size) {
-                        for (Int32 i = begin, n = (begin + size); i < n; ++i)
-                          func(items[i]);
-                      });
-    break;
+  case eExecutionPolicy::Thread: {
+    auto apply_func = [&](auto& body, Int64 i) { body(items[static_cast<Int32>(i)]); };
+    if (!doThreadLambdaByReduceBlock(vsize, launch_info.loopRunInfo(), func, apply_func))
+      arcaneParallelFor(0, vsize, launch_info.loopRunInfo(),
+                        [&](Int32 begin, Int32 size) {
+                          for (Int32 i = begin, n = (begin + size); i < n; ++i)
+                            func(items[i]);
+                        });
+  } break;
   default:
     ARCANE_FATAL("Invalid execution policy '{0}'", exec_policy);
   }
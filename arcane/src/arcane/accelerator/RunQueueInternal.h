@@ -19,6 +19,7 @@
 
 #include "arcane/accelerator/AcceleratorGlobal.h"
 #include "arcane/accelerator/RunCommandLaunchInfo.h"
+#include "arcane/accelerator/HostReduceBlockInfo.h"
 
 #if defined(ARCANE_COMPILING_HIP)
 #include <hip/hip_runtime.h>
@@ -129,6 +130,64 @@ void doDirectThreadLambda(Integer begin,Integer size,Lambda func)
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Exécute en multi-thread une lambda contenant des réductions.
+ *
+ * L'intervalle [0,nb_item[ est découpé en blocs dont la taille ne dépend
+ * que de \a nb_item (HostReduceBlockInfo::computeBlockSize()) et chaque bloc
+ * est exécuté séquentiellement avec sa propre copie de \a func. Les réductions
+ * conservent ainsi une valeur partielle par bloc et le résultat final
+ * ne dépend pas du nombre de threads.
+ *
+ * \a apply_func doit avoir la signature `void apply_func(Lambda& body,Int64 i)`
+ * et appliquer \a body sur la i-ème itération.
+ *
+ * Une première copie de \a func est effectuée pour détecter les réductions.
+ * S'il n'y en a pas, la boucle n'est pas exécutée et la fonction retourne \a false.
+ * L'appelant doit alors utiliser le mécanisme multi-thread classique.
+ */
+template <typename Lambda, typename ApplyFunc> bool
+doThreadLambdaByReduceBlock(Int64 nb_item, const ForLoopRunInfo& run_info,
+                            const Lambda& func, const ApplyFunc& apply_func)
+{
+  const Int64 block_size = HostReduceBlockInfo::computeBlockSize(nb_item);
+  const Int32 nb_block = HostReduceBlockInfo::computeNbBlock(nb_item);
+  {
+    HostReduceBlockScope probe_scope(nb_block, -1);
+    Lambda probe_copy(func);
+    if (probe_scope.nbRegisteredReducer() == 0)
+      return false;
+  }
+
+  // La taille de grain est exprimée en nombre d'itérations. Il faut
+  // la convertir en nombre de blocs.
+  ForLoopRunInfo block_run_info(run_info);
+  if (run_info.options().has_value()) {
+    ParallelLoopOptions options(run_info.options().value());
+    if (options.grainSize() > 0)
+      options.setGrainSize(static_cast<Int32>(std::max(static_cast<Int64>(1), options.grainSize() / block_size)));
+    block_run_info.addOptions(options);
+  }
+
+  auto block_func = [&](Int32 begin_block, Int32 nb) {
+    for (Int32 b = begin_block, end_block = begin_block + nb; b < end_block; ++b) {
+      HostReduceBlockScope block_scope(nb_block, b);
+      auto privatizer = privatize(func);
+      auto& body = privatizer.privateCopy();
+      Int64 begin = b * block_size;
+      Int64 end = std::min(begin + block_size, nb_item);
+      for (Int64 i = begin; i < end; ++i)
+        apply_func(body, i);
+    }
+  };
+  LambdaRangeFunctorT<decltype(block_func)> functor(block_func);
+  ParallelFor1DLoopInfo loop_info(0, nb_block, &functor, block_run_info);
+  TaskFactory::executeParallelFor(loop_info);
+  return true;
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -15,6 +15,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "arcane/utils/ArrayView.h"
+#include "arcane/utils/Array.h"
 #include "arcane/utils/FatalErrorException.h"
 
 #include "arcane/accelerator/AcceleratorGlobal.h"
@@ -149,11 +150,11 @@ class GenericScanner
       else
         ARCANE_CHECK_HIP(rocprim::inclusive_scan(temp_storage, temp_storage_size, input_data, output_data,
                                                  nb_item, op, stream));
-    }
+    } break;
 #endif
     case eExecutionPolicy::Thread:
-      // Pas encore implémenté en multi-thread
-      [[fallthrough]];
+      _applyMultiThread(input, output, op, init_value);
+      break;
     case eExecutionPolicy::Sequential: {
       DataType sum = init_value;
       for (Int32 i = 0; i < nb_item; ++i) {
@@ -172,6 +173,54 @@ class GenericScanner
     }
   }
 
+ private:
+
+  /*!
+   * \brief Scan multi-thread sur l'hôte.
+   *
+   * Le scan se fait en deux passes. La première calcule la réduction de
+   * chaque bloc, ce qui permet d'obtenir par un scan séquentiel sur les
+   * blocs la valeur initiale de chacun d'eux. La seconde effectue le scan
+   * de chaque bloc à partir de cette valeur.
+   *
+   * Les opérations ne sont pas effectuées dans le même ordre qu'en
+   * séquentiel. Si \a op n'est pas associatif (par exemple pour la somme de
+   * réels), le résultat peut donc différer de celui du scan séquentiel. Il
+   * est par contre déterministe pour un nombre de threads donné.
+   */
+  void _applyMultiThread(SmallSpan<const DataType> input, SmallSpan<DataType> output,
+                         const Operator& op, const DataType& init_value)
+  {
+    const Int32 nb_item = input.size();
+    const Int32 nb_block = MultiThreadAlgoHelper::computeNbBlock(nb_item);
+    UniqueArray<DataType> block_values(nb_block);
+    MultiThreadAlgoHelper::applyByBlock(nb_item, nb_block, [&](Int32 block_index, Int32 begin, Int32 size) {
+      DataType sum = Operator::initialValue();
+      for (Int32 i = begin, end = begin + size; i < end; ++i)
+        sum = op(input[i], sum);
+      block_values[block_index] = sum;
+    });
+    DataType sum = init_value;
+    for (Int32 b = 0; b < nb_block; ++b) {
+      DataType block_sum = block_values[b];
+      block_values[b] = sum;
+      sum = op(block_sum, sum);
+    }
+    MultiThreadAlgoHelper::applyByBlock(nb_item, nb_block, [&](Int32 block_index, Int32 begin, Int32 size) {
+      DataType block_sum = block_values[block_index];
+      for (Int32 i = begin, end = begin + size; i < end; ++i) {
+        if constexpr (IsExclusive) {
+          output[i] = block_sum;
+          block_sum = op(input[i], block_sum);
+        }
+        else {
+          block_sum = op(input[i], block_sum);
+          output[i] = block_sum;
+        }
+      }
+    });
+  }
+
  private:
 
   RunQueue* m_queue = nullptr;
@@ -194,7 +243,11 @@ namespace Arcane::Accelerator
  * Voir https://en.wikipedia.org/wiki/Prefix_sum.
  *
  * Dans les méthodes suivantes, l'argument \a queue peut être nul auquel cas
- * l'algorithme s'applique sur l'hôte en séquentiel.
+ * l'algorithme s'applique sur l'hôte en séquentiel. Si la politique d'exécution
+ * de \a queue est eExecutionPolicy::Thread, l'algorithme utilise plusieurs
+ * threads. Dans ce cas, \a input et \a output ne doivent pas se recouvrir
+ * et le résultat est déterministe pour un nombre de threads donné mais peut
+ * différer du résultat séquentiel pour les types flottants.
  */
 template <typename DataType>
 class Scanner
@@ -0,0 +1,58 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* Sort.cc                                                     (C) 2000-2023 */
+/*                                                                           */
+/* Algorithmes de tri pour les accélérateurs.                                */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/accelerator/Sort.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Accelerator::impl
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+GenericSorterBase::
+GenericSorterBase(RunQueue* queue)
+: m_queue(queue)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+eExecutionPolicy GenericSorterBase::
+_executionPolicy() const
+{
+  if (m_queue)
+    return m_queue->executionPolicy();
+  return eExecutionPolicy::Sequential;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void GenericSorterBase::
+_checkSizes(Int32 nb_input, Int32 nb_output) const
+{
+  if (nb_input != nb_output)
+    ARCANE_FATAL("Sizes are not equals: input={0} output={1}", nb_input, nb_output);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Accelerator::impl
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,621 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* Sort.h                                                      (C) 2000-2023 */
+/*                                                                           */
+/* Algorithmes de tri pour les accélérateurs.                                */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_ACCELERATOR_SORT_H
+#define ARCANE_ACCELERATOR_SORT_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/ArrayView.h"
+#include "arcane/utils/Array.h"
+#include "arcane/utils/FatalErrorException.h"
+
+#include "arcane/accelerator/AcceleratorGlobal.h"
+#include "arcane/accelerator/core/RunQueue.h"
+#include "arcane/accelerator/CommonUtils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Accelerator::impl
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Conversion d'une clé en entier non signé pour le tri par base.
+ *
+ * La conversion conserve l'ordre: si `a < b` alors `toRadix(a) < toRadix(b)`.
+ * Seuls les types entiers et flottants sont supportés.
+ */
+template <typename KeyType, typename Enabled = void>
+class RadixSortKeyTraits;
+
+//! Conversion pour les types entiers
+template <typename KeyType>
+class RadixSortKeyTraits<KeyType, std::enable_if_t<std::is_integral_v<KeyType> && !std::is_same_v<KeyType, bool>>>
+{
+ public:
+
+  using UnsignedType = std::make_unsigned_t<KeyType>;
+
+ public:
+
+  static constexpr ARCCORE_HOST_DEVICE UnsignedType toRadix(KeyType v)
+  {
+    UnsignedType u = static_cast<UnsignedType>(v);
+    // Inverse le bit de signe pour que les valeurs négatives soient en premier.
+    if constexpr (std::is_signed_v<KeyType>)
+      u ^= static_cast<UnsignedType>(UnsignedType(1) << (sizeof(KeyType) * 8 - 1));
+    return u;
+  }
+};
+
+//! Conversion pour les types flottants (IEEE 754)
+template <typename KeyType>
+class RadixSortKeyTraits<KeyType, std::enable_if_t<std::is_floating_point_v<KeyType>>>
+{
+  static_assert(sizeof(KeyType) == 4 || sizeof(KeyType) == 8, "Only 32 or 64 bits floating point types are supported");
+
+ public:
+
+  using UnsignedType = std::conditional_t<sizeof(KeyType) == 8, std::uint64_t, std::uint32_t>;
+
+ public:
+
+  static UnsignedType toRadix(KeyType v)
+  {
+    UnsignedType u = 0;
+    std::memcpy(&u, &v, sizeof(KeyType));
+    // Pour les valeurs négatives, tous les bits sont inversés afin que
+    // l'ordre soit inversé. Pour les autres, seul le bit de signe l'est.
+    const UnsignedType sign_bit = UnsignedType(1) << (sizeof(KeyType) * 8 - 1);
+    return (u & sign_bit) ? static_cast<UnsignedType>(~u) : static_cast<UnsignedType>(u ^ sign_bit);
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Type utilisé pour les valeurs lorsqu'on ne trie que des clés.
+ */
+class RadixSortNoValue
+{
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Tri par base (LSD) sur l'hôte.
+ *
+ * Le tri se fait par paquets de 8 bits en partant des bits de poids faible.
+ * Pour chaque paquet, chaque bloc calcule l'histogramme de ses clés. On en
+ * déduit la position en sortie de la première clé de chaque couple
+ * (paquet,bloc) puis chaque bloc recopie ses éléments. Les blocs étant rangés
+ * dans l'ordre pour un paquet donné, le tri est stable et le résultat ne
+ * dépend pas du nombre de blocs.
+ *
+ * Les paquets pour lesquels toutes les clés ont la même valeur sont ignorés.
+ */
+template <typename KeyType, typename ValueType>
+class HostRadixSorter
+{
+  using KeyTraits = RadixSortKeyTraits<KeyType>;
+  using UnsignedType = typename KeyTraits::UnsignedType;
+
+  static constexpr bool HasValue = !std::is_same_v<ValueType, RadixSortNoValue>;
+  static constexpr Int32 NB_DIGIT_BIT = 8;
+  static constexpr Int32 NB_BUCKET = 1 << NB_DIGIT_BIT;
+  static constexpr Int32 NB_PASS = static_cast<Int32>(sizeof(UnsignedType));
+  //! Taille en dessous de laquelle on utilise un tri par insertion
+  static constexpr Int32 INSERTION_SORT_SIZE = 32;
+
+ public:
+
+  /*!
+   * \brief Trie \a nb_item éléments en utilisant \a nb_block blocs.
+   *
+   * Si \a HasValue est faux, \a values_in et \a values_out ne sont pas utilisés.
+   */
+  static void sort(const KeyType* keys_in, KeyType* keys_out,
+                   const ValueType* values_in, ValueType* values_out,
+                   Int32 nb_item, Int32 nb_block)
+  {
+    if (nb_item <= INSERTION_SORT_SIZE) {
+      _copy(keys_in, keys_out, values_in, values_out, 0, nb_item);
+      _insertionSort(keys_out, values_out, nb_item);
+      return;
+    }
+
+    // Détermine les paquets de bits qui ne sont pas identiques pour toutes les clés.
+    const UnsignedType first_radix = KeyTraits::toRadix(keys_in[0]);
+    UniqueArray<UnsignedType> block_masks(nb_block);
+    MultiThreadAlgoHelper::applyByBlock(nb_item, nb_block, [&](Int32 block_index, Int32 begin, Int32 size) {
+      UnsignedType mask = 0;
+      for (Int32 i = begin, end = begin + size; i < end; ++i)
+        mask |= static_cast<UnsignedType>(KeyTraits::toRadix(keys_in[i]) ^ first_radix);
+      block_masks[block_index] = mask;
+    });
+    UnsignedType diff_mask = 0;
+    for (UnsignedType mask : block_masks)
+      diff_mask |= mask;
+    Int32 passes[NB_PASS];
+    Int32 nb_pass = 0;
+    for (Int32 p = 0; p < NB_PASS; ++p)
+      if (_digit(diff_mask, p) != 0)
+        passes[nb_pass++] = p;
+
+    if (nb_pass == 0) {
+      MultiThreadAlgoHelper::applyByBlock(nb_item, nb_block, [&](Int32, Int32 begin, Int32 size) {
+        _copy(keys_in, keys_out, values_in, values_out, begin, size);
+      });
+      return;
+    }
+
+    // Alterne entre le tableau temporaire et la sortie de telle sorte
+    // que la dernière passe écrive dans la sortie.
+    UniqueArray<KeyType> tmp_keys;
+    UniqueArray<ValueType> tmp_values;
+    if (nb_pass > 1) {
+      tmp_keys.resize(nb_item);
+      if constexpr (HasValue)
+        tmp_values.resize(nb_item);
+    }
+    UniqueArray<Int32> offsets(nb_block * NB_BUCKET);
+    const KeyType* src_keys = keys_in;
+    const ValueType* src_values = values_in;
+    for (Int32 k = 0; k < nb_pass; ++k) {
+      const bool is_last_buffer = ((nb_pass - k) % 2) == 1;
+      KeyType* dst_keys = (is_last_buffer) ? keys_out : tmp_keys.data();
+      ValueType* dst_values = (is_last_buffer) ? values_out : tmp_values.data();
+      _applyPass(src_keys, dst_keys, src_values, dst_values, passes[k], nb_item, nb_block, offsets);
+      src_keys = dst_keys;
+      src_values = dst_values;
+    }
+  }
+
+  /*!
+   * \brief Trie indépendamment chaque segment.
+   *
+   * Le segment \a i correspond aux indices [segment_offsets[i],segment_offsets[i+1][.
+   * Si \a is_multi_thread est vrai, les segments sont répartis entre les blocs.
+   */
+  static void sortSegments(const KeyType* keys_in, KeyType* keys_out,
+                           const ValueType* values_in, ValueType* values_out,
+                           Int32 nb_item, SmallSpan<const Int32> segment_offsets,
+                           bool is_multi_thread)
+  {
+    const Int32 nb_segment = segment_offsets.size() - 1;
+    if (nb_segment <= 0)
+      return;
+    Int32 nb_block = 1;
+    if (is_multi_thread)
+      nb_block = std::min(MultiThreadAlgoHelper::computeNbBlock(nb_item), nb_segment);
+    MultiThreadAlgoHelper::applyByBlock(nb_segment, nb_block, [&](Int32, Int32 begin, Int32 size) {
+      for (Int32 s = begin, end = begin + size; s < end; ++s) {
+        const Int32 first = segment_offsets[s];
+        const ValueType* segment_values_in = nullptr;
+        ValueType* segment_values_out = nullptr;
+        if constexpr (HasValue) {
+          segment_values_in = values_in + first;
+          segment_values_out = values_out + first;
+        }
+        sort(keys_in + first, keys_out + first, segment_values_in, segment_values_out,
+             segment_offsets[s + 1] - first, 1);
+      }
+    });
+  }
+
+ private:
+
+  static Int32 _digit(UnsignedType v, Int32 pass)
+  {
+    return static_cast<Int32>((v >> (pass * NB_DIGIT_BIT)) & (NB_BUCKET - 1));
+  }
+
+  static void _copy(const KeyType* keys_in, KeyType* keys_out,
+                    const ValueType* values_in, ValueType* values_out,
+                    Int32 begin, Int32 size)
+  {
+    for (Int32 i = begin, end = begin + size; i < end; ++i) {
+      keys_out[i] = keys_in[i];
+      if constexpr (HasValue)
+        values_out[i] = values_in[i];
+    }
+  }
+
+  //! Tri par insertion (stable) des \a nb_item premiers éléments
+  static void _insertionSort(KeyType* keys, ValueType* values, Int32 nb_item)
+  {
+    for (Int32 i = 1; i < nb_item; ++i) {
+      KeyType key = keys[i];
+      const UnsignedType radix = KeyTraits::toRadix(key);
+      Int32 j = i;
+      if constexpr (HasValue) {
+        ValueType value = values[i];
+        for (; j > 0 && KeyTraits::toRadix(keys[j - 1]) > radix; --j) {
+          keys[j] = keys[j - 1];
+          values[j] = values[j - 1];
+        }
+        values[j] = value;
+      }
+      else {
+        for (; j > 0 && KeyTraits::toRadix(keys[j - 1]) > radix; --j)
+          keys[j] = keys[j - 1];
+      }
+      keys[j] = key;
+    }
+  }
+
+  static void _applyPass(const KeyType* src_keys, KeyType* dst_keys,
+                         const ValueType* src_values, ValueType* dst_values,
+                         Int32 pass, Int32 nb_item, Int32 nb_block,
+                         Array<Int32>& offsets)
+  {
+    MultiThreadAlgoHelper::applyByBlock(nb_item, nb_block, [&](Int32 block_index, Int32 begin, Int32 size) {
+      Int32* counts = offsets.data() + block_index * NB_BUCKET;
+      std::fill(counts, counts + NB_BUCKET, 0);
+      for (Int32 i = begin, end = begin + size; i < end; ++i)
+        ++counts[_digit(KeyTraits::toRadix(src_keys[i]), pass)];
+    });
+    // Calcule la position du premier élément de chaque couple (paquet,bloc).
+    Int32 position = 0;
+    for (Int32 d = 0; d < NB_BUCKET; ++d) {
+      for (Int32 b = 0; b < nb_block; ++b) {
+        Int32& v = offsets[b * NB_BUCKET + d];
+        const Int32 count = v;
+        v = position;
+        position += count;
+      }
+    }
+    MultiThreadAlgoHelper::applyByBlock(nb_item, nb_block, [&](Int32 block_index, Int32 begin, Int32 size) {
+      Int32* positions = offsets.data() + block_index * NB_BUCKET;
+      for (Int32 i = begin, end = begin + size; i < end; ++i) {
+        const Int32 pos = positions[_digit(KeyTraits::toRadix(src_keys[i]), pass)]++;
+        dst_keys[pos] = src_keys[i];
+        if constexpr (HasValue)
+          dst_values[pos] = src_values[i];
+      }
+    });
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Classe de base pour effectuer un tri.
+ */
+class ARCANE_ACCELERATOR_EXPORT GenericSorterBase
+{
+ public:
+
+  explicit GenericSorterBase(RunQueue* queue);
+
+ protected:
+
+  eExecutionPolicy _executionPolicy() const;
+
+  /*!
+   * \brief Trie les clés \a keys_in et éventuellement les valeurs associées.
+   *
+   * Si \a values_in est vide, seules les clés sont triées.
+   */
+  template <typename KeyType, typename ValueType>
+  void _apply(SmallSpan<const KeyType> keys_in, SmallSpan<KeyType> keys_out,
+              SmallSpan<const ValueType> values_in, SmallSpan<ValueType> values_out)
+  {
+    constexpr bool HasValue = !std::is_same_v<ValueType, RadixSortNoValue>;
+    const Int32 nb_item = keys_in.size();
+    _checkSizes(nb_item, keys_out.size());
+    if constexpr (HasValue) {
+      _checkSizes(nb_item, values_in.size());
+      _checkSizes(nb_item, values_out.size());
+    }
+    [[maybe_unused]] const KeyType* keys_in_data = keys_in.data();
+    [[maybe_unused]] KeyType* keys_out_data = keys_out.data();
+    [[maybe_unused]] const ValueType* values_in_data = values_in.data();
+    [[maybe_unused]] ValueType* values_out_data = values_out.data();
+    [[maybe_unused]] constexpr int nb_bit = sizeof(KeyType) * 8;
+    eExecutionPolicy exec_policy = _executionPolicy();
+    switch (exec_policy) {
+#if defined(ARCANE_COMPILING_CUDA)
+    case eExecutionPolicy::CUDA: {
+      size_t temp_storage_size = 0;
+      cudaStream_t stream = impl::CudaUtils::toNativeStream(m_queue);
+      // Premier appel pour connaitre la taille pour l'allocation
+      if constexpr (HasValue)
+        ARCANE_CHECK_CUDA(::cub::DeviceRadixSort::SortPairs(nullptr, temp_storage_size, keys_in_data, keys_out_data,
+                                                            values_in_data, values_out_data, nb_item, 0, nb_bit, stream));
+      else
+        ARCANE_CHECK_CUDA(::cub::DeviceRadixSort::SortKeys(nullptr, temp_storage_size, keys_in_data, keys_out_data,
+                                                           nb_item, 0, nb_bit, stream));
+
+      m_algo_storage.allocate(temp_storage_size);
+      void* temp_storage = m_algo_storage.address();
+      if constexpr (HasValue)
+        ARCANE_CHECK_CUDA(::cub::DeviceRadixSort::SortPairs(temp_storage, temp_storage_size, keys_in_data, keys_out_data,
+                                                            values_in_data, values_out_data, nb_item, 0, nb_bit, stream));
+      else
+        ARCANE_CHECK_CUDA(::cub::DeviceRadixSort::SortKeys(temp_storage, temp_storage_size, keys_in_data, keys_out_data,
+                                                           nb_item, 0, nb_bit, stream));
+    } break;
+#endif
+#if defined(ARCANE_COMPILING_HIP)
+    case eExecutionPolicy::HIP: {
+      size_t temp_storage_size = 0;
+      // Premier appel pour connaitre la taille pour l'allocation
+      hipStream_t stream = impl::HipUtils::toNativeStream(m_queue);
+      if constexpr (HasValue)
+        ARCANE_CHECK_HIP(rocprim::radix_sort_pairs(nullptr, temp_storage_size, keys_in_data, keys_out_data,
+                                                   values_in_data, values_out_data, nb_item, 0, nb_bit, stream));
+      else
+        ARCANE_CHECK_HIP(rocprim::radix_sort_keys(nullptr, temp_storage_size, keys_in_data, keys_out_data,
+                                                  nb_item, 0, nb_bit, stream));
+
+      m_algo_storage.allocate(temp_storage_size);
+      void* temp_storage = m_algo_storage.address();
+
+      if constexpr (HasValue)
+        ARCANE_CHECK_HIP(rocprim::radix_sort_pairs(temp_storage, temp_storage_size, keys_in_data, keys_out_data,
+                                                   values_in_data, values_out_data, nb_item, 0, nb_bit, stream));
+      else
+        ARCANE_CHECK_HIP(rocprim::radix_sort_keys(temp_storage, temp_storage_size, keys_in_data, keys_out_data,
+                                                  nb_item, 0, nb_bit, stream));
+    } break;
+#endif
+    case eExecutionPolicy::Thread: {
+      const Int32 nb_block = MultiThreadAlgoHelper::computeNbBlock(nb_item);
+      HostRadixSorter<KeyType, ValueType>::sort(keys_in_data, keys_out_data, values_in_data, values_out_data, nb_item, nb_block);
+    } break;
+    case eExecutionPolicy::Sequential:
+      HostRadixSorter<KeyType, ValueType>::sort(keys_in_data, keys_out_data, values_in_data, values_out_data, nb_item, 1);
+      break;
+    default:
+      ARCANE_FATAL(getBadPolicyMessage(exec_policy));
+    }
+  }
+
+  /*!
+   * \brief Trie indépendamment chaque segment de \a keys_in.
+   *
+   * \a segment_offsets contient (nb_segment+1) valeurs et le segment \a i
+   * correspond aux indices [segment_offsets[i],segment_offsets[i+1][.
+   */
+  template <typename KeyType, typename ValueType>
+  void _applySegmented(SmallSpan<const Int32> segment_offsets,
+                       SmallSpan<const KeyType> keys_in, SmallSpan<KeyType> keys_out,
+                       SmallSpan<const ValueType> values_in, SmallSpan<ValueType> values_out)
+  {
+    constexpr bool HasValue = !std::is_same_v<ValueType, RadixSortNoValue>;
+    const Int32 nb_item = keys_in.size();
+    _checkSizes(nb_item, keys_out.size());
+    if constexpr (HasValue) {
+      _checkSizes(nb_item, values_in.size());
+      _checkSizes(nb_item, values_out.size());
+    }
+    const Int32 nb_segment = segment_offsets.size() - 1;
+    if (nb_segment <= 0)
+      return;
+    [[maybe_unused]] const Int32* offsets_data = segment_offsets.data();
+    [[maybe_unused]] const KeyType* keys_in_data = keys_in.data();
+    [[maybe_unused]] KeyType* keys_out_data = keys_out.data();
+    [[maybe_unused]] const ValueType* values_in_data = values_in.data();
+    [[maybe_unused]] ValueType* values_out_data = values_out.data();
+    [[maybe_unused]] constexpr int nb_bit = sizeof(KeyType) * 8;
+    eExecutionPolicy exec_policy = _executionPolicy();
+    switch (exec_policy) {
+#if defined(ARCANE_COMPILING_CUDA)
+    case eExecutionPolicy::CUDA: {
+      size_t temp_storage_size = 0;
+      cudaStream_t stream = impl::CudaUtils::toNativeStream(m_queue);
+      // Premier appel pour connaitre la taille pour l'allocation
+      if constexpr (HasValue)
+        ARCANE_CHECK_CUDA(::cub::DeviceSegmentedRadixSort::SortPairs(nullptr, temp_storage_size, keys_in_data, keys_out_data,
+                                                                     values_in_data, values_out_data, nb_item, nb_segment,
+                                                                     offsets_data, offsets_data + 1, 0, nb_bit, stream));
+      else
+        ARCANE_CHECK_CUDA(::cub::DeviceSegmentedRadixSort::SortKeys(nullptr, temp_storage_size, keys_in_data, keys_out_data,
+                                                                    nb_item, nb_segment, offsets_data, offsets_data + 1,
+                                                                    0, nb_bit, stream));
+
+      m_algo_storage.allocate(temp_storage_size);
+      void* temp_storage = m_algo_storage.address();
+      if constexpr (HasValue)
+        ARCANE_CHECK_CUDA(::cub::DeviceSegmentedRadixSort::SortPairs(temp_storage, temp_storage_size, keys_in_data, keys_out_data,
+                                                                     values_in_data, values_out_data, nb_item, nb_segment,
+                                                                     offsets_data, offsets_data + 1, 0, nb_bit, stream));
+      else
+        ARCANE_CHECK_CUDA(::cub::DeviceSegmentedRadixSort::SortKeys(temp_storage, temp_storage_size, keys_in_data, keys_out_data,
+                                                                    nb_item, nb_segment, offsets_data, offsets_data + 1,
+                                                                    0, nb_bit, stream));
+    } break;
+#endif
+#if defined(ARCANE_COMPILING_HIP)
+    case eExecutionPolicy::HIP: {
+      size_t temp_storage_size = 0;
+      // Premier appel pour connaitre la taille pour l'allocation
+      hipStream_t stream = impl::HipUtils::toNativeStream(m_queue);
+      if constexpr (HasValue)
+        ARCANE_CHECK_HIP(rocprim::segmented_radix_sort_pairs(nullptr, temp_storage_size, keys_in_data, keys_out_data,
+                                                             values_in_data, values_out_data, nb_item, nb_segment,
+                                                             offsets_data, offsets_data + 1, 0, nb_bit, stream));
+      else
+        ARCANE_CHECK_HIP(rocprim::segmented_radix_sort_keys(nullptr, temp_storage_size, keys_in_data, keys_out_data,
+                                                            nb_item, nb_segment, offsets_data, offsets_data + 1,
+                                                            0, nb_bit, stream));
+
+      m_algo_storage.allocate(temp_storage_size);
+      void* temp_storage = m_algo_storage.address();
+
+      if constexpr (HasValue)
+        ARCANE_CHECK_HIP(rocprim::segmented_radix_sort_pairs(temp_storage, temp_storage_size, keys_in_data, keys_out_data,
+                                                             values_in_data, values_out_data, nb_item, nb_segment,
+                                                             offsets_data, offsets_data + 1, 0, nb_bit, stream));
+      else
+        ARCANE_CHECK_HIP(rocprim::segmented_radix_sort_keys(temp_storage, temp_storage_size, keys_in_data, keys_out_data,
+                                                            nb_item, nb_segment, offsets_data, offsets_data + 1,
+                                                            0, nb_bit, stream));
+    } break;
+#endif
+    case eExecutionPolicy::Thread:
+      HostRadixSorter<KeyType, ValueType>::sortSegments(keys_in_data, keys_out_data, values_in_data, values_out_data,
+                                                        nb_item, segment_offsets, true);
+      break;
+    case eExecutionPolicy::Sequential:
+      HostRadixSorter<KeyType, ValueType>::sortSegments(keys_in_data, keys_out_data, values_in_data, values_out_data,
+                                                        nb_item, segment_offsets, false);
+      break;
+    default:
+      ARCANE_FATAL(getBadPolicyMessage(exec_policy));
+    }
+  }
+
+ private:
+
+  void _checkSizes(Int32 nb_input, Int32 nb_output) const;
+
+ protected:
+
+  RunQueue* m_queue = nullptr;
+  GenericDeviceStorage m_algo_storage;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Accelerator::impl
+
+namespace Arcane::Accelerator
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Algorithme de tri par base (radix sort) sur accélérateur.
+ *
+ * \a KeyType est le type des clés, qui doit être un type entier ou flottant.
+ * Si \a ValueType est spécifié, il est possible de trier en même temps que
+ * les clés des valeurs associées.
+ *
+ * Le tri est croissant et stable: deux éléments de même clé restent
+ * dans le même ordre qu'en entrée. Pour les flottants, l'ordre est celui de
+ * la représentation binaire, ce qui place `-0.0` avant `+0.0`.
+ *
+ * Dans les méthodes suivantes, l'argument \a queue peut être nul auquel cas
+ * l'algorithme s'applique sur l'hôte en séquentiel. Si la politique d'exécution
+ * de \a queue est eExecutionPolicy::Thread, l'algorithme utilise plusieurs
+ * threads. Le résultat ne dépend pas de la politique d'exécution.
+ *
+ * Les tableaux d'entrée et de sortie ne doivent pas se recouvrir. Comme pour
+ * les autres algorithmes, l'appel peut être asynchrone si \a queue l'est.
+ *
+ * \code
+ * Arcane::Accelerator::GenericSorter<Int64, Int32> sorter(queue);
+ * sorter.apply(keys_in, keys_out, values_in, values_out);
+ * \endcode
+ */
+template <typename KeyType, typename ValueType = impl::RadixSortNoValue>
+class GenericSorter
+: private impl::GenericSorterBase
+{
+ public:
+
+  explicit GenericSorter(RunQueue* queue)
+  : impl::GenericSorterBase(queue)
+  {}
+
+ public:
+
+  //! Trie \a input et range le résultat dans \a output
+  void apply(SmallSpan<const KeyType> input, SmallSpan<KeyType> output)
+  {
+    _apply(input, output, SmallSpan<const impl::RadixSortNoValue>(), SmallSpan<impl::RadixSortNoValue>());
+  }
+
+  /*!
+   * \brief Trie les couples (clé,valeur).
+   *
+   * Après appel, \a keys_output contient les clés de \a keys_input triées et
+   * \a values_output les valeurs de \a values_input associées.
+   */
+  void apply(SmallSpan<const KeyType> keys_input, SmallSpan<KeyType> keys_output,
+             SmallSpan<const ValueType> values_input, SmallSpan<ValueType> values_output)
+  {
+    static_assert(!std::is_same_v<ValueType, impl::RadixSortNoValue>, "ValueType has to be specified");
+    _apply(keys_input, keys_output, values_input, values_output);
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Algorithme de tri par segment sur accélérateur.
+ *
+ * Fonctionne comme GenericSorter mais trie indépendamment chaque segment
+ * des tableaux d'entrée. Les segments sont décrits par un tableau
+ * \a segment_offsets de (nb_segment+1) éléments: le segment \a i correspond
+ * aux indices [segment_offsets[i],segment_offsets[i+1][. Ce tableau doit
+ * être accessible depuis l'accélérateur. Les éléments qui ne sont dans
+ * aucun segment ne sont pas recopiés dans la sortie.
+ *
+ * Avec la politique eExecutionPolicy::Thread, les segments sont répartis
+ * entre les threads et chaque segment est trié séquentiellement.
+ */
+template <typename KeyType, typename ValueType = impl::RadixSortNoValue>
+class GenericSegmentedSorter
+: private impl::GenericSorterBase
+{
+ public:
+
+  explicit GenericSegmentedSorter(RunQueue* queue)
+  : impl::GenericSorterBase(queue)
+  {}
+
+ public:
+
+  //! Trie chaque segment de \a input et range le résultat dans \a output
+  void apply(SmallSpan<const Int32> segment_offsets, SmallSpan<const KeyType> input, SmallSpan<KeyType> output)
+  {
+    _applySegmented(segment_offsets, input, output,
+                    SmallSpan<const impl::RadixSortNoValue>(), SmallSpan<impl::RadixSortNoValue>());
+  }
+
+  //! Trie les couples (clé,valeur) de chaque segment
+  void apply(SmallSpan<const Int32> segment_offsets,
+             SmallSpan<const KeyType> keys_input, SmallSpan<KeyType> keys_output,
+             SmallSpan<const ValueType> values_input, SmallSpan<ValueType> values_output)
+  {
+    static_assert(!std::is_same_v<ValueType, impl::RadixSortNoValue>, "ValueType has to be specified");
+    _applySegmented(segment_offsets, keys_input, keys_output, values_input, values_output);
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Accelerator
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,95 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* Unique.cc                                                   (C) 2000-2023 */
+/*                                                                           */
+/* Algorithmes de suppression des doublons et de codage par plages.          */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/accelerator/Unique.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Accelerator::impl
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+GenericUniqueBase::
+GenericUniqueBase(RunQueue* queue)
+: m_queue(queue)
+{
+  _allocate();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Int32 GenericUniqueBase::
+_nbOutputElement() const
+{
+  if (m_queue)
+    m_queue->barrier();
+  return m_host_nb_out_storage[0];
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+eExecutionPolicy GenericUniqueBase::
+_executionPolicy() const
+{
+  if (m_queue)
+    return m_queue->executionPolicy();
+  return eExecutionPolicy::Sequential;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Int32 GenericUniqueBase::
+_nbHostBlock(eExecutionPolicy policy, Int32 nb_item) const
+{
+  if (policy == eExecutionPolicy::Thread)
+    return MultiThreadAlgoHelper::computeNbBlock(nb_item);
+  return 1;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void GenericUniqueBase::
+_allocate()
+{
+  eMemoryRessource r = eMemoryRessource::Host;
+  if (m_queue && isAcceleratorPolicy(m_queue->executionPolicy()))
+    r = eMemoryRessource::HostPinned;
+  if (m_host_nb_out_storage.memoryRessource() != r)
+    m_host_nb_out_storage = NumArray<Int32, MDDim1>(r);
+  m_host_nb_out_storage.resize(1);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void GenericUniqueBase::
+_checkSizes(Int32 nb_input, Int32 nb_output) const
+{
+  if (nb_input != nb_output)
+    ARCANE_FATAL("Sizes are not equals: input={0} output={1}", nb_input, nb_output);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Accelerator::impl
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
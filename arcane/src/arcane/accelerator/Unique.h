@@ -0,0 +1,311 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* Unique.h                                                    (C) 2000-2023 */
+/*                                                                           */
+/* Algorithmes de suppression des doublons et de codage par plages.          */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_ACCELERATOR_UNIQUE_H
+#define ARCANE_ACCELERATOR_UNIQUE_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/ArrayView.h"
+#include "arcane/utils/Array.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/NumArray.h"
+
+#include "arcane/accelerator/AcceleratorGlobal.h"
+#include "arcane/accelerator/core/RunQueue.h"
+#include "arcane/accelerator/CommonUtils.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Accelerator::impl
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Classe de base pour la suppression des doublons consécutifs.
+ *
+ * Un élément est le premier d'une plage s'il est le premier du tableau ou
+ * s'il est différent de l'élément précédent. Sur l'hôte, les algorithmes
+ * calculent la position en sortie de chaque début de plage de la même
+ * manière que le filtrage.
+ */
+class ARCANE_ACCELERATOR_EXPORT GenericUniqueBase
+{
+ public:
+
+  explicit GenericUniqueBase(RunQueue* queue);
+
+ protected:
+
+  Int32 _nbOutputElement() const;
+
+  template <typename DataType>
+  void _applyUnique(SmallSpan<const DataType> input, SmallSpan<DataType> output)
+  {
+    const Int32 nb_item = input.size();
+    _checkSizes(nb_item, output.size());
+    [[maybe_unused]] const DataType* input_data = input.data();
+    [[maybe_unused]] DataType* output_data = output.data();
+    eExecutionPolicy exec_policy = _executionPolicy();
+    switch (exec_policy) {
+#if defined(ARCANE_COMPILING_CUDA)
+    case eExecutionPolicy::CUDA: {
+      size_t temp_storage_size = 0;
+      cudaStream_t stream = impl::CudaUtils::toNativeStream(m_queue);
+      // Premier appel pour connaitre la taille pour l'allocation
+      int* nb_out_ptr = nullptr;
+      ARCANE_CHECK_CUDA(::cub::DeviceSelect::Unique(nullptr, temp_storage_size,
+                                                    input_data, output_data, nb_out_ptr, nb_item, stream));
+
+      m_algo_storage.allocate(temp_storage_size);
+      m_device_nb_out_storage.allocate();
+      nb_out_ptr = m_device_nb_out_storage.address();
+      ARCANE_CHECK_CUDA(::cub::DeviceSelect::Unique(m_algo_storage.address(), temp_storage_size,
+                                                    input_data, output_data, nb_out_ptr, nb_item, stream));
+      ARCANE_CHECK_CUDA(::cudaMemcpyAsync(m_host_nb_out_storage.bytes().data(), nb_out_ptr, sizeof(int), cudaMemcpyDeviceToHost, stream));
+    } break;
+#endif
+#if defined(ARCANE_COMPILING_HIP)
+    case eExecutionPolicy::HIP: {
+      size_t temp_storage_size = 0;
+      // Premier appel pour connaitre la taille pour l'allocation
+      hipStream_t stream = impl::HipUtils::toNativeStream(m_queue);
+      int* nb_out_ptr = nullptr;
+      ARCANE_CHECK_HIP(rocprim::unique(nullptr, temp_storage_size, input_data, output_data,
+                                       nb_out_ptr, nb_item, rocprim::equal_to<DataType>(), stream));
+
+      m_algo_storage.allocate(temp_storage_size);
+      m_device_nb_out_storage.allocate();
+      nb_out_ptr = m_device_nb_out_storage.address();
+
+      ARCANE_CHECK_HIP(rocprim::unique(m_algo_storage.address(), temp_storage_size, input_data, output_data,
+                                       nb_out_ptr, nb_item, rocprim::equal_to<DataType>(), stream));
+      ARCANE_CHECK_HIP(::hipMemcpyAsync(m_host_nb_out_storage.bytes().data(), nb_out_ptr, sizeof(int), hipMemcpyDeviceToHost, stream));
+    } break;
+#endif
+    case eExecutionPolicy::Thread:
+    case eExecutionPolicy::Sequential: {
+      auto is_run_begin = [&](Int32 i) { return (i == 0 || !(input[i] == input[i - 1])); };
+      const Int32 nb_block = _nbHostBlock(exec_policy, nb_item);
+      UniqueArray<Int32> block_offsets(nb_block + 1);
+      MultiThreadAlgoHelper::computeSelectedBlockOffsets(nb_item, nb_block, is_run_begin, block_offsets);
+      MultiThreadAlgoHelper::applyByBlock(nb_item, nb_block, [&](Int32 block_index, Int32 begin, Int32 size) {
+        Int32 index = block_offsets[block_index];
+        for (Int32 i = begin, end = begin + size; i < end; ++i) {
+          if (is_run_begin(i)) {
+            output[index] = input[i];
+            ++index;
+          }
+        }
+      });
+      m_host_nb_out_storage[0] = block_offsets[nb_block];
+    } break;
+    default:
+      ARCANE_FATAL(getBadPolicyMessage(exec_policy));
+    }
+  }
+
+  template <typename DataType>
+  void _applyRunLengthEncode(SmallSpan<const DataType> input, SmallSpan<DataType> unique_output,
+                             SmallSpan<Int32> counts_output)
+  {
+    const Int32 nb_item = input.size();
+    _checkSizes(nb_item, unique_output.size());
+    _checkSizes(nb_item, counts_output.size());
+    [[maybe_unused]] const DataType* input_data = input.data();
+    [[maybe_unused]] DataType* unique_output_data = unique_output.data();
+    [[maybe_unused]] Int32* counts_output_data = counts_output.data();
+    eExecutionPolicy exec_policy = _executionPolicy();
+    switch (exec_policy) {
+#if defined(ARCANE_COMPILING_CUDA)
+    case eExecutionPolicy::CUDA: {
+      size_t temp_storage_size = 0;
+      cudaStream_t stream = impl::CudaUtils::toNativeStream(m_queue);
+      // Premier appel pour connaitre la taille pour l'allocation
+      int* nb_out_ptr = nullptr;
+      ARCANE_CHECK_CUDA(::cub::DeviceRunLengthEncode::Encode(nullptr, temp_storage_size, input_data, unique_output_data,
+                                                             counts_output_data, nb_out_ptr, nb_item, stream));
+
+      m_algo_storage.allocate(temp_storage_size);
+      m_device_nb_out_storage.allocate();
+      nb_out_ptr = m_device_nb_out_storage.address();
+      ARCANE_CHECK_CUDA(::cub::DeviceRunLengthEncode::Encode(m_algo_storage.address(), temp_storage_size, input_data, unique_output_data,
+                                                             counts_output_data, nb_out_ptr, nb_item, stream));
+      ARCANE_CHECK_CUDA(::cudaMemcpyAsync(m_host_nb_out_storage.bytes().data(), nb_out_ptr, sizeof(int), cudaMemcpyDeviceToHost, stream));
+    } break;
+#endif
+#if defined(ARCANE_COMPILING_HIP)
+    case eExecutionPolicy::HIP: {
+      size_t temp_storage_size = 0;
+      // Premier appel pour connaitre la taille pour l'allocation
+      hipStream_t stream = impl::HipUtils::toNativeStream(m_queue);
+      int* nb_out_ptr = nullptr;
+      ARCANE_CHECK_HIP(rocprim::run_length_encode(nullptr, temp_storage_size, input_data, nb_item,
+                                                  unique_output_data, counts_output_data, nb_out_ptr, stream));
+
+      m_algo_storage.allocate(temp_storage_size);
+      m_device_nb_out_storage.allocate();
+      nb_out_ptr = m_device_nb_out_storage.address();
+
+      ARCANE_CHECK_HIP(rocprim::run_length_encode(m_algo_storage.address(), temp_storage_size, input_data, nb_item,
+                                                  unique_output_data, counts_output_data, nb_out_ptr, stream));
+      ARCANE_CHECK_HIP(::hipMemcpyAsync(m_host_nb_out_storage.bytes().data(), nb_out_ptr, sizeof(int), hipMemcpyDeviceToHost, stream));
+    } break;
+#endif
+    case eExecutionPolicy::Thread:
+    case eExecutionPolicy::Sequential: {
+      auto is_run_begin = [&](Int32 i) { return (i == 0 || !(input[i] == input[i - 1])); };
+      const Int32 nb_block = _nbHostBlock(exec_policy, nb_item);
+      UniqueArray<Int32> block_offsets(nb_block + 1);
+      MultiThreadAlgoHelper::computeSelectedBlockOffsets(nb_item, nb_block, is_run_begin, block_offsets);
+      MultiThreadAlgoHelper::applyByBlock(nb_item, nb_block, [&](Int32 block_index, Int32 begin, Int32 size) {
+        Int32 index = block_offsets[block_index];
+        for (Int32 i = begin, end = begin + size; i < end; ++i) {
+          if (is_run_begin(i)) {
+            // La plage peut continuer dans les blocs suivants.
+            Int32 run_end = i + 1;
+            while (run_end < nb_item && input[run_end] == input[i])
+              ++run_end;
+            unique_output[index] = input[i];
+            counts_output[index] = run_end - i;
+            ++index;
+          }
+        }
+      });
+      m_host_nb_out_storage[0] = block_offsets[nb_block];
+    } break;
+    default:
+      ARCANE_FATAL(getBadPolicyMessage(exec_policy));
+    }
+  }
+
+ private:
+
+  eExecutionPolicy _executionPolicy() const;
+  Int32 _nbHostBlock(eExecutionPolicy policy, Int32 nb_item) const;
+  void _allocate();
+  void _checkSizes(Int32 nb_input, Int32 nb_output) const;
+
+ protected:
+
+  RunQueue* m_queue = nullptr;
+  GenericDeviceStorage m_algo_storage;
+  DeviceStorage<int> m_device_nb_out_storage;
+  NumArray<Int32, MDDim1> m_host_nb_out_storage;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Accelerator::impl
+
+namespace Arcane::Accelerator
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Algorithme de suppression des doublons consécutifs sur accélérateur.
+ *
+ * Seul le premier élément de chaque suite d'éléments égaux consécutifs est
+ * conservé. Si le tableau d'entrée est trié (par exemple avec GenericSorter),
+ * le tableau de sortie contient donc une seule fois chaque valeur.
+ *
+ * L'algorithme séquentiel est le suivant:
+ *
+ * \code
+ * Int32 index = 0;
+ * for (Int32 i = 0; i < nb_item; ++i) {
+ *   if (i == 0 || input[i] != input[i - 1]) {
+ *     output[index] = input[i];
+ *     ++index;
+ *   }
+ * }
+ * \endcode
+ *
+ * Il faut appeler nbOutputElement() pour obtenir le nombre d'éléments en sortie.
+ *
+ * Si \a queue est nul, l'algorithme s'applique sur l'hôte en séquentiel. Si
+ * la politique d'exécution de \a queue est eExecutionPolicy::Thread,
+ * l'algorithme utilise plusieurs threads. Dans tous les cas, l'entrée et
+ * la sortie ne doivent pas se recouvrir.
+ */
+template <typename DataType>
+class GenericUnique
+: private impl::GenericUniqueBase
+{
+ public:
+
+  explicit GenericUnique(RunQueue* queue)
+  : impl::GenericUniqueBase(queue)
+  {}
+
+ public:
+
+  //! Recopie dans \a output les éléments de \a input sans les doublons consécutifs
+  void apply(SmallSpan<const DataType> input, SmallSpan<DataType> output)
+  {
+    _applyUnique(input, output);
+  }
+
+  //! Nombre d'éléments en sortie.
+  Int32 nbOutputElement() const { return _nbOutputElement(); }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Algorithme de codage par plages (run-length encoding) sur accélérateur.
+ *
+ * Pour chaque suite d'éléments égaux consécutifs de l'entrée, range la valeur
+ * dans \a unique_output et le nombre d'éléments de la suite dans
+ * \a counts_output. Les tableaux de sortie doivent avoir la même taille que
+ * l'entrée. Il faut appeler nbRun() pour obtenir le nombre de plages.
+ *
+ * Les remarques de GenericUnique sur les politiques d'exécution s'appliquent.
+ */
+template <typename DataType>
+class GenericRunLengthEncode
+: private impl::GenericUniqueBase
+{
+ public:
+
+  explicit GenericRunLengthEncode(RunQueue* queue)
+  : impl::GenericUniqueBase(queue)
+  {}
+
+ public:
+
+  //! Calcule les plages de \a input
+  void apply(SmallSpan<const DataType> input, SmallSpan<DataType> unique_output, SmallSpan<Int32> counts_output)
+  {
+    _applyRunLengthEncode(input, unique_output, counts_output);
+  }
+
+  //! Nombre de plages.
+  Int32 nbRun() const { return _nbOutputElement(); }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Accelerator
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -8,6 +8,8 @@ set( ARCANE_SOURCES
   CommonCudaHipAtomicImpl.h
   CommonUtils.h
   CommonUtils.cc
+  HostReduceBlockInfo.h
+  HostReduceBlockInfo.cc
   IReduceMemoryImpl.h
   IRunQueueStream.h
   MaterialVariableViews.h
@@ -31,6 +33,12 @@ set( ARCANE_SOURCES
   Filter.h
   Filterer.cc
   Scan.cc
+  Sort.h
+  Sort.cc
+  Partition.h
+  Partition.cc
+  Unique.h
+  Unique.cc
   SpanViews.h
   VariableViews.h
   Views.h
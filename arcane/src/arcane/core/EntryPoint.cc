@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* EntryPoint.cc                                               (C) 2000-2022 */
+/* EntryPoint.cc                                               (C) 2000-2023 */
 /*                                                                           */
 /* Point d'entrée d'un module.                                               */
 /*---------------------------------------------------------------------------*/
@@ -16,11 +16,14 @@
 #include "arcane/utils/ITraceMng.h"
 #include "arcane/utils/PlatformUtils.h"
 #include "arcane/utils/StringBuilder.h"
+#include "arcane/utils/FatalErrorException.h"
 
 #include "arcane/IModule.h"
 #include "arcane/IEntryPointMng.h"
 #include "arcane/ISubDomain.h"
 #include "arcane/Timer.h"
+#include "arcane/IVariableMng.h"
+#include "arcane/IVariableSynchronizerMng.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -146,12 +149,83 @@ executeEntryPoint()
     m_caller->executeFunctor();
   }
 
+  // Effectue les synchronisations différées demandées pendant le point d'entrée.
+  {
+    IVariableSynchronizerMng* vsm = m_sub_domain->variableMng()->synchronizerMng();
+    if (vsm->nbDeferredSynchronization() != 0)
+      vsm->flushDeferredSynchronizations();
+  }
+
   ++m_nb_call;
 }
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void EntryPoint::
+executeEntryPointConcurrent()
+{
+  if (m_module->disabled() && m_where == WComputeLoop)
+    return;
+
+  {
+    Timer::Sentry ts_elapsed(m_elapsed_timer);
+    m_caller->executeFunctor();
+  }
+
+  ++m_nb_call;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void EntryPoint::
+addReadDepend(IVariable* var, const TraceInfo& tinfo)
+{
+  ARCANE_CHECK_POINTER(var);
+  m_read_depends.add(VariableDependInfo(var, IVariable::DPT_CurrentTime, tinfo));
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void EntryPoint::
+addWriteDepend(IVariable* var, const TraceInfo& tinfo)
+{
+  ARCANE_CHECK_POINTER(var);
+  m_write_depends.add(VariableDependInfo(var, IVariable::DPT_CurrentTime, tinfo));
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool EntryPoint::
+hasVariableDepends() const
+{
+  return !m_read_depends.empty() || !m_write_depends.empty();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void EntryPoint::
+readDependInfos(Array<VariableDependInfo>& infos) const
+{
+  infos.addRange(m_read_depends);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void EntryPoint::
+writeDependInfos(Array<VariableDependInfo>& infos) const
+{
+  infos.addRange(m_write_depends);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 Real EntryPoint::
 lastCPUTime() const
 {
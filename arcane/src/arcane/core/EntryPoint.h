@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* EntryPoint.h                                                (C) 2000-2022 */
+/* EntryPoint.h                                                (C) 2000-2023 */
 /*                                                                           */
 /* Point d'entrée d'un module.                                               */
 /*---------------------------------------------------------------------------*/
@@ -16,7 +16,9 @@
 
 #include "arcane/utils/String.h"
 #include "arcane/utils/FunctorWithAddress.h"
+#include "arcane/utils/UniqueArray.h"
 #include "arcane/IEntryPoint.h"
+#include "arcane/VariableDependInfo.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -121,6 +123,28 @@ class ARCANE_CORE_EXPORT EntryPoint
   String where() const override { return m_where; }
   int property() const override { return m_property; }
 
+  using IEntryPoint::addReadDepend;
+  using IEntryPoint::addWriteDepend;
+  void addReadDepend(IVariable* var, const TraceInfo& tinfo) override;
+  void addWriteDepend(IVariable* var, const TraceInfo& tinfo) override;
+  bool hasVariableDepends() const override;
+  void readDependInfos(Array<VariableDependInfo>& infos) const override;
+  void writeDependInfos(Array<VariableDependInfo>& infos) const override;
+
+ public:
+
+  /*!
+   * \internal
+   * \brief Appelle le point d'entrée depuis une tâche concurrente.
+   *
+   * Contrairement à executeEntryPoint(), cette méthode ne met à jour que le
+   * temps propre du point d'entrée et pas les statistiques du sous-domaine
+   * (ITimeStats) qui ne supportent pas les appels concurrents. Les
+   * synchronisations différées ne sont pas effectuées et doivent l'être
+   * par l'appelant.
+   */
+  void executeEntryPointConcurrent();
+
  private:
 
   ISubDomain* m_sub_domain = nullptr; //!< Gestionnaire de sous-domaine
@@ -133,6 +157,8 @@ class ARCANE_CORE_EXPORT EntryPoint
   int m_property = 0; //!< Propriétés du point d'entrée
   Integer m_nb_call = 0; //!< Nombre de fois que le point d'entrée a été exécuté
   bool m_is_destroy_caller = false; //!< Indique si on doit détruire le functor d'appel.
+  UniqueArray<VariableDependInfo> m_read_depends; //!< Variables lues
+  UniqueArray<VariableDependInfo> m_write_depends; //!< Variables modifiées
 
  private:
 
@@ -161,14 +187,17 @@ class ARCANE_CORE_EXPORT EntryPoint
  * \param where endroit ou est appelé le point d'entrée
  * \param property propriétés du point d'entrée (voir IEntryPoint)
  * \param name nom de la fonction pour Arcane
+ *
+ * Retourne le point d'entrée créé, ce qui permet par exemple de déclarer
+ * ses dépendances via IEntryPoint::addReadDepend() et IEntryPoint::addWriteDepend().
  */
-template<typename ModuleType> inline void
+template<typename ModuleType> inline EntryPoint*
 addEntryPoint(ModuleType* module,const char* name,void (ModuleType::*func)(),
               const String& where = IEntryPoint::WComputeLoop,
               int property = IEntryPoint::PNone)
 {
   IFunctorWithAddress* caller = new FunctorWithAddressT<ModuleType>(module,func);
-  EntryPoint::create(EntryPointBuildInfo(module,name,caller,where,property,true));
+  return EntryPoint::create(EntryPointBuildInfo(module,name,caller,where,property,true));
 }
 
 /*---------------------------------------------------------------------------*/
@@ -184,14 +213,17 @@ addEntryPoint(ModuleType* module,const char* name,void (ModuleType::*func)(),
  * \param where endroit ou est appelé le point d'entrée
  * \param property propriétés du point d'entrée (voir IEntryPoint)
  * \param name nom de la fonction pour Arcane
+ *
+ * Retourne le point d'entrée créé, ce qui permet par exemple de déclarer
+ * ses dépendances via IEntryPoint::addReadDepend() et IEntryPoint::addWriteDepend().
  */
-template<typename ModuleType> inline void
+template<typename ModuleType> inline EntryPoint*
 addEntryPoint(ModuleType* module,const String& name,void (ModuleType::*func)(),
               const String& where = IEntryPoint::WComputeLoop,
               int property = IEntryPoint::PNone)
 {
   IFunctorWithAddress* caller = new FunctorWithAddressT<ModuleType>(module,func);
-  EntryPoint::create(EntryPointBuildInfo(module,name,caller,where,property,true));
+  return EntryPoint::create(EntryPointBuildInfo(module,name,caller,where,property,true));
 }
 
 /*---------------------------------------------------------------------------*/
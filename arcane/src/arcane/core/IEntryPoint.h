@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IEntryPoint.h                                               (C) 2000-2022 */
+/* IEntryPoint.h                                               (C) 2000-2023 */
 /*                                                                           */
 /* Interface du point d'entrée d'un module.                                  */
 /*---------------------------------------------------------------------------*/
@@ -14,6 +14,8 @@
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+#include "arcane/utils/TraceInfo.h"
+
 #include "arcane/ArcaneTypes.h"
 #include "arcane/Timer.h"
 
@@ -23,6 +25,7 @@
 namespace Arcane
 {
 class IModule;
+class VariableDependInfo;
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -148,6 +151,49 @@ class ARCANE_CORE_EXPORT IEntryPoint
 
   //! Retourne les propriétés du point d'entrée.
   virtual int property() const = 0;
+
+ public:
+
+  /*!
+   * \brief Indique que le point d'entrée lit la variable \a var.
+   *
+   * Lorsque la variable d'environnement ARCANE_ENTRY_POINT_GRAPH_SCHEDULER
+   * vaut 1 et que le multi-threading est actif, les dépendances en lecture
+   * et en écriture des points d'entrée sont utilisées pour exécuter en
+   * concurrence les points d'entrée indépendants de la boucle en temps.
+   * Un point d'entrée pour lequel aucune dépendance n'a été déclarée est
+   * toujours exécuté seul. Les points d'entrée exécutés en concurrence ne
+   * doivent pas effectuer d'opérations collectives.
+   *
+   * \a tinfo contient (si disponible) l'endroit dans le code source où la
+   * dépendance a été ajoutée.
+   *
+   * L'implémentation par défaut ne conserve pas la dépendance. Le point
+   * d'entrée est alors toujours exécuté seul.
+   */
+  virtual void addReadDepend([[maybe_unused]] IVariable* var, [[maybe_unused]] const TraceInfo& tinfo) {}
+
+  //! Indique que le point d'entrée lit la variable \a var.
+  void addReadDepend(IVariable* var) { addReadDepend(var, TraceInfo()); }
+
+  /*!
+   * \brief Indique que le point d'entrée modifie la variable \a var.
+   *
+   * \sa addReadDepend().
+   */
+  virtual void addWriteDepend([[maybe_unused]] IVariable* var, [[maybe_unused]] const TraceInfo& tinfo) {}
+
+  //! Indique que le point d'entrée modifie la variable \a var.
+  void addWriteDepend(IVariable* var) { addWriteDepend(var, TraceInfo()); }
+
+  //! Indique si des dépendances sur des variables ont été déclarées
+  virtual bool hasVariableDepends() const { return false; }
+
+  //! Liste des variables lues par le point d'entrée
+  virtual void readDependInfos([[maybe_unused]] Array<VariableDependInfo>& infos) const {}
+
+  //! Liste des variables modifiées par le point d'entrée
+  virtual void writeDependInfos([[maybe_unused]] Array<VariableDependInfo>& infos) const {}
 };
 
 /*---------------------------------------------------------------------------*/
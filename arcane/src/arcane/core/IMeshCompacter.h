@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IMeshCompacter.h                                            (C) 2000-2016 */
+/* IMeshCompacter.h                                            (C) 2000-2023 */
 /*                                                                           */
 /* Gestion d'un compactage de familles du maillage.                          */
 /*---------------------------------------------------------------------------*/
@@ -137,6 +137,26 @@ class ARCANE_CORE_EXPORT IMeshCompacter
   //! Indique si souhaite trier les entités en plus de les compacter.
   virtual bool isSorted() const =0;
 
+  /*!
+   * \brief Positionne le seuil de fragmentation pour le compactage incrémental.
+   *
+   * La fragmentation d'une famille est le rapport entre le nombre de
+   * numéros locaux libres et le plus grand numéro local utilisé. Si elle
+   * est non nulle et inférieure ou égale à \a v, la famille est compactée
+   * de manière incrémentale : seules les entités situées après le
+   * nbItem()-ième numéro local sont déplacées dans les trous et les autres
+   * entités conservent leur numéro local. Comme ce mode ne respecte pas
+   * l'ordre des entités, il n'est utilisé que si isSorted() est faux.
+   *
+   * Si \a v vaut 0 (le défaut), le compactage incrémental n'est pas utilisé.
+   *
+   * \pre phase()==ePhase::Init.
+   */
+  virtual void setIncrementalThreshold(Real v) =0;
+
+  //! Seuil de fragmentation pour le compactage incrémental.
+  virtual Real incrementalThreshold() const =0;
+
   //! Familles dont les entités sont compactées.
   virtual ItemFamilyCollection families() const =0;
 
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IMeshUniqueIdMng.h                                          (C) 2000-2022 */
+/* IMeshUniqueIdMng.h                                          (C) 2000-2023 */
 /*                                                                           */
 /* Interface du gestionnaire de numérotation des uniqueId() d'un maillage.   */
 /*---------------------------------------------------------------------------*/
@@ -45,7 +45,10 @@ class ARCANE_CORE_EXPORT IMeshUniqueIdMng
   /*!
    * \brief Positionne la version de la numérotation des faces.
    *
-   * Les valeurs valides sont 0, 1, 2 et 3. La valeur par défaut est 1.
+   * Les valeurs valides sont 0, 1, 2, 3, 4 et 5. La valeur par défaut est 1.
+   * La version 5 calcule les uniqueId() à partir d'un hachage des
+   * uniqueId() des noeuds de la face et ne nécessite pas de tri parallèle.
+   * La numérotation obtenue est indépendante du découpage.
    * Si la version vaut 0 alors il n'y a pas de renumérotation. En parallèle,
    * il faut alors que les uniqueId() des faces soient cohérents entre
    * les sous-domaines.
@@ -58,10 +61,12 @@ class ARCANE_CORE_EXPORT IMeshUniqueIdMng
   /*!
    * \brief Positionne la version de la numérotation des arêtes.
    *
-   * Les valeurs valides sont 0, 1 et 2. La valeur 1 fonctionne quel que
+   * Les valeurs valides sont 0, 1, 2 et 3. La valeur 1 fonctionne quel que
    * soit le nombre de mailles mais il faut que le maillage soit lu par
    * un seul processeur. La valeur 2 ne fonctionne que si le maximum des
-   * uniqueId() des noeuds ne dépasse pas 2^31.
+   * uniqueId() des noeuds ne dépasse pas 2^31. La valeur 3 calcule les
+   * uniqueId() à partir d'un hachage des uniqueId() des noeuds de l'arête
+   * et fonctionne quel que soit le découpage.
    *
    * Si la version vaut 0 alors il n'y a pas de renumérotation. En parallèle,
    * il faut alors que les uniqueId() des faces soient cohérents entre
@@ -15,6 +15,8 @@
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+#include "arcane/utils/Ref.h"
+
 #include "arcane/core/ArcaneTypes.h"
 
 /*---------------------------------------------------------------------------*/
@@ -22,6 +24,8 @@
 
 namespace Arcane
 {
+class IVariableSynchronizerRequest;
+class IDataCompressor;
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -79,9 +83,31 @@ class ARCANE_CORE_EXPORT IVariableSynchronizer
    *
    * Toutes les variables doivent être issues de la même famille
    * et de ce groupe d'entité.
+   *
+   * Les variables sont envoyées en un seul message par rang voisin sauf
+   * si l'une d'elles est partielle ou synchronisée par différence. Dans ce
+   * cas, les variables sont synchronisées une par une.
    */
   virtual void synchronize(VariableCollection vars) = 0;
 
+  /*!
+   * \brief Commence la synchronisation de la variable \a var en mode non bloquant.
+   *
+   * Les messages sont envoyés dès l'appel à cette méthode et la synchronisation
+   * se termine lors de l'appel à IVariableSynchronizerRequest::wait() sur
+   * l'instance retournée. Entre les deux, il est possible d'effectuer
+   * des calculs sur innerItems(), qui n'ont pas besoin des valeurs des entités
+   * fantômes. Les valeurs de \a var ne doivent pas être modifiées avant
+   * l'appel à IVariableSynchronizerRequest::wait().
+   *
+   * Cette opération est collective et les appels doivent être effectués
+   * dans le même ordre sur tous les rangs. Il est possible d'avoir plusieurs
+   * synchronisations non bloquantes en cours pour des variables différentes.
+   * Il n'est pas possible d'appeler compute() ou changeLocalIds() tant que des
+   * synchronisations non bloquantes sont en cours.
+   */
+  virtual Ref<IVariableSynchronizerRequest> synchronizeAsync(IVariable* var) = 0;
+
   /*!
    * \brief Rangs des sous-domaines avec lesquels on communique.
    */
@@ -101,6 +127,27 @@ class ARCANE_CORE_EXPORT IVariableSynchronizer
    */
   virtual Int32ConstArrayView ghostItems(Int32 index) = 0;
 
+  /*!
+   * \brief Groupe des entités propres de itemGroup() qui ne sont pas partagées.
+   *
+   * Ces entités ne sont envoyées à aucun sous-domaine lors des
+   * synchronisations. Avec boundaryItems(), ce groupe forme une partition des
+   * entités propres de itemGroup().
+   *
+   * Le groupe est mis à jour lors de l'appel à compute().
+   */
+  virtual ItemGroup innerItems() = 0;
+
+  /*!
+   * \brief Groupe des entités partagées avec au moins un sous-domaine.
+   *
+   * Il s'agit de l'union des listes sharedItems() pour l'ensemble des
+   * rangs de communicatingRanks().
+   *
+   * Le groupe est mis à jour lors de l'appel à compute().
+   */
+  virtual ItemGroup boundaryItems() = 0;
+
   /*!
    * \brief Synchronise la donnée \a data.
    *
@@ -120,6 +167,27 @@ class ARCANE_CORE_EXPORT IVariableSynchronizer
    * il faut utiliser IVariableMng::synchronizerMng().
    */
   virtual EventObservable<const VariableSynchronizerEventArgs&>& onSynchronized() = 0;
+
+  /*!
+   * \brief Positionne le service de compression des messages de synchronisation.
+   *
+   * Si \a compressor n'est pas nul, les messages dont la taille dépasse
+   * IDataCompressor::minCompressSize() sont compressés avant d'être envoyés.
+   * Cela peut être intéressant pour les grosses variables lorsque la
+   * synchronisation est limitée par le débit du réseau. Si \a compressor est nul,
+   * les messages ne sont plus compressés.
+   *
+   * Il est aussi possible de spécifier un service de compression pour
+   * tous les synchroniseurs via la variable d'environnement
+   * ARCANE_SYNCHRONIZE_COMPRESSOR (par exemple 'LZ4DataCompressor').
+   *
+   * Cette opération est collective et ne doit pas être appelée lorsque des
+   * synchronisations non bloquantes sont en cours.
+   */
+  virtual void setDataCompressor(Ref<IDataCompressor> compressor) = 0;
+
+  //! Service de compression des messages de synchronisation (peut être nul)
+  virtual Ref<IDataCompressor> dataCompressor() const = 0;
 };
 
 /*---------------------------------------------------------------------------*/
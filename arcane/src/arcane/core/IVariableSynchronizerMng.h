@@ -71,6 +71,17 @@ class ARCANE_CORE_EXPORT IVariableSynchronizerMng
    */
   virtual void dumpStats(std::ostream& ostr) const = 0;
 
+  /*!
+   * \brief Écrit au format JSON les informations de profilage des synchronisations.
+   *
+   * Les informations ne sont collectées que si la variable d'environnement
+   * ARCANE_SYNCHRONIZE_PROFILING vaut 1. Elles sont données par synchroniseur
+   * et par variable et contiennent le nombre de synchronisations, le volume
+   * échangé, le temps passé dans les recopies, le temps restant (attente des
+   * messages) et le déséquilibre entre les messages envoyés aux rangs voisins.
+   */
+  virtual void dumpStatsJSON(JSONWriter& writer) const = 0;
+
   /*!
    * \brief Traite les statistiques en cours.
    *
@@ -80,6 +91,82 @@ class ARCANE_CORE_EXPORT IVariableSynchronizerMng
    */
   virtual void flushPendingStats() = 0;
 
+  /*!
+   * \brief Ajoute la variable \a var à la liste des synchronisations différées.
+   *
+   * La synchronisation de \a var n'est pas effectuée immédiatement mais lors du
+   * prochain appel à flushDeferredSynchronizations(). Les variables en attente
+   * sont regroupées par synchroniseur et les variables d'un même
+   * synchroniseur sont envoyées en un seul message par rang voisin.
+   *
+   * Ce regroupement n'est pas possible pour les variables partielles et
+   * pour les variables synchronisées par différence (voir
+   * setDeltaSynchronization()). Ces variables sont synchronisées une par une
+   * lors de l'appel à flushDeferredSynchronizations(), les variables
+   * partielles via le synchroniseur de leur groupe.
+   *
+   * Les valeurs des entités fantômes de \a var ne sont donc pas valides
+   * tant que flushDeferredSynchronizations() n'a pas été appelée. Ajouter
+   * plusieurs fois la même variable est équivalent à ne l'ajouter qu'une
+   * seule fois.
+   *
+   * Les synchronisations en attente sont automatiquement effectuées à la
+   * fin de chaque point d'entrée.
+   *
+   * Comme pour les synchronisations classiques, les variables doivent être
+   * ajoutées dans le même ordre sur tous les rangs de parallelMng().
+   * Pour les points d'entrée exécutés en concurrence (voir
+   * IEntryPoint::addReadDepend()), les variables sont conservées pour chaque
+   * point d'entrée et les synchronisations sont effectuées après la fin du
+   * groupe de points d'entrée, dans l'ordre des points d'entrée puis par nom
+   * de variable. Cet ordre ne dépend donc pas de l'ordre d'exécution.
+   *
+   * Cette méthode n'est pas thread-safe en dehors de ce cas.
+   */
+  virtual void addDeferredSynchronization(IVariable* var) = 0;
+
+  /*!
+   * \brief Effectue les synchronisations différées en attente.
+   *
+   * Cette méthode est collective sur parallelMng().
+   */
+  virtual void flushDeferredSynchronizations() = 0;
+
+  //! Nombre de variables dont la synchronisation est en attente
+  virtual Int32 nbDeferredSynchronization() const = 0;
+
+  /*!
+   * \brief Active ou désactive la synchronisation par différence pour \a var.
+   *
+   * Lorsque ce mode est actif, les synchronisations de \a var effectuées via
+   * IVariableSynchronizer::synchronize(IVariable*) n'envoient que les valeurs
+   * des entités partagées qui ont été modifiées depuis la précédente
+   * synchronisation de la variable. Si la proportion de valeurs modifiées
+   * pour un rang est trop importante, toutes les valeurs sont envoyées à ce rang.
+   * Ce mode est intéressant pour les variables dont seule une petite partie
+   * des valeurs est modifiée entre deux synchronisations.
+   *
+   * Le seuil au-delà duquel toutes les valeurs sont envoyées peut être modifié
+   * via la variable d'environnement ARCANE_SYNCHRONIZE_DELTA_THRESHOLD qui
+   * indique la proportion (entre 0.0 et 1.0) de valeurs modifiées. Par défaut,
+   * ce seuil correspond à la proportion pour laquelle les deux messages
+   * ont la même taille.
+   *
+   * Comme les valeurs des entités fantômes sont toujours recopiées à partir
+   * des valeurs reçues, le résultat de la synchronisation est identique
+   * à celui d'une synchronisation classique.
+   *
+   * La comparaison avec les valeurs précédentes est effectuée sur l'hôte.
+   * Si les valeurs de \a var sont allouées dans la mémoire d'un accélérateur,
+   * \a var est synchronisée de manière classique.
+   *
+   * Cette opération doit être appelée de manière collective sur parallelMng().
+   */
+  virtual void setDeltaSynchronization(IVariable* var, bool is_enabled) = 0;
+
+  //! Indique si la synchronisation par différence est active pour \a var
+  virtual bool isDeltaSynchronization(IVariable* var) const = 0;
+
  public:
 
   virtual IVariableSynchronizerMngInternal* _internalApi() = 0;
@@ -0,0 +1,71 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* IVariableSynchronizerRequest.h                              (C) 2000-2023 */
+/*                                                                           */
+/* Interface d'une requête de synchronisation non bloquante.                 */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_CORE_IVARIABLESYNCHRONIZERREQUEST_H
+#define ARCANE_CORE_IVARIABLESYNCHRONIZERREQUEST_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/core/ArcaneTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Interface d'une requête de synchronisation non bloquante.
+ *
+ * Une instance de cette classe est retournée par
+ * IVariableSynchronizer::synchronizeAsync(). Les valeurs des entités
+ * fantômes de la variable associée ne sont valides qu'après l'appel
+ * à wait().
+ *
+ * Si wait() n'a pas été appelé lors de la destruction de l'instance,
+ * la synchronisation est terminée dans le destructeur. Comme wait() est
+ * une opération collective, il est préférable de l'appeler explicitement.
+ */
+class ARCANE_CORE_EXPORT IVariableSynchronizerRequest
+{
+ public:
+
+  virtual ~IVariableSynchronizerRequest() = default;
+
+ public:
+
+  //! Variable en cours de synchronisation
+  virtual IVariable* variable() const = 0;
+
+  /*!
+   * \brief Attend la fin de la synchronisation.
+   *
+   * Cette opération est collective sur le IParallelMng du synchroniseur.
+   * Les appels successifs après le premier n'ont pas d'effet.
+   */
+  virtual void wait() = 0;
+
+  //! Indique si wait() a déjà été appelé
+  virtual bool isDone() const = 0;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IndexedItemConnectivityView.cc                              (C) 2000-2022 */
+/* IndexedItemConnectivityView.cc                              (C) 2000-2023 */
 /*                                                                           */
 /* Vues sur les connectivités utilisant des index.                           */
 /*---------------------------------------------------------------------------*/
@@ -13,6 +13,8 @@
 
 #include "arcane/IndexedItemConnectivityView.h"
 
+#include "arcane/utils/FatalErrorException.h"
+
 #include "arcane/ItemGroup.h"
 
 /*---------------------------------------------------------------------------*/
@@ -21,6 +23,47 @@
 namespace Arcane
 {
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool IndexedItemConnectivityViewBase::
+isFixedSize(Int32 n) const
+{
+  if (n <= 0)
+    return false;
+  const Int32 nb_item = m_container_view.nbItem();
+  if (nb_item == 0)
+    return true;
+  SmallSpan<const Int32> nb_connected_items = m_container_view.nbConnectedItems();
+  SmallSpan<const Int32> indexes = m_container_view.indexes();
+  const Int64 first_index = indexes[0];
+  if ((first_index + static_cast<Int64>(nb_item) * n) > m_container_view.m_list_data_size)
+    return false;
+  for (Int32 i = 0; i < nb_item; ++i) {
+    if (nb_connected_items[i] != n)
+      return false;
+    if (indexes[i] != (first_index + static_cast<Int64>(i) * n))
+      return false;
+  }
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+SmallSpan<const Int32> IndexedItemConnectivityViewBase::
+_fixedSizeConnectedItems(Int32 n) const
+{
+  if (!isFixedSize(n))
+    ARCANE_FATAL("Connectivity ({0},{1}) is not of fixed size '{2}'",
+                 m_source_kind, m_target_kind, n);
+  const Int32 nb_item = m_container_view.nbItem();
+  if (nb_item == 0)
+    return {};
+  const Int32* ptr = m_container_view.m_list_data + m_container_view.indexes()[0];
+  return { ptr, nb_item * n };
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 // Fonction utilisée pour tester la compilation avec accès aux connectivités
@@ -58,6 +101,10 @@ _internalItemTestCompile()
   IndexedDoFCellConnectivityView dof_cell;
   IndexedDoFDoFConnectivityView dof_dof;
 
+  IndexedCellNodeFixedSizeConnectivityView<8> cell_node_fixed;
+  IndexedCellFaceFixedSizeConnectivityView<6> cell_face_fixed;
+  IndexedFaceNodeFixedSizeConnectivityView<4> face_node_fixed;
+
   ItemGroup items;
   Int64 total = 0;
 
@@ -97,6 +144,12 @@ _internalItemTestCompile()
     for (DoFLocalId dof : cell_dof.dofs(xcell)) {
       total += dof.localId();
     }
+    for (NodeLocalId node : cell_node_fixed.items(xcell)) {
+      total += node.localId();
+    }
+    for (Int32 i = 0; i < cell_face_fixed.nbItemPerSource(); ++i) {
+      total += cell_face_fixed.itemId(xcell, i).localId();
+    }
   }
 
   ENUMERATE_ (Edge, iedge, items) {
@@ -135,6 +188,9 @@ _internalItemTestCompile()
     for (DoFLocalId dof : face_dof.dofs(xface)) {
       total += dof.localId();
     }
+    for (NodeLocalId node : face_node_fixed.itemIds(xface)) {
+      total += node.localId();
+    }
   }
 
   ENUMERATE_ (DoF, idof, items) {
@@ -60,6 +60,20 @@ class ARCANE_CORE_EXPORT IndexedItemConnectivityViewBase
   eItemKind sourceItemKind() const { return m_source_kind; }
   eItemKind targetItemKind() const { return m_target_kind; }
 
+  /*!
+   * \brief Indique si la connectivité est de taille fixe \a n.
+   *
+   * C'est le cas si chaque entité source est connectée à exactement \a n
+   * entités et si les connectivités sont rangées de manière contigue dans
+   * l'ordre des localId() des entités source, ce qui est le cas après un
+   * compactage pour une famille ne contenant qu'un seul type d'entité
+   * (par exemple un maillage uniquement composé d'hexaèdres).
+   *
+   * Cette méthode parcourt toutes les entités source et n'est donc
+   * pas destinée à être appelée dans une boucle.
+   */
+  bool isFixedSize(Int32 n) const;
+
   //! Initialise la vue
   ARCANE_DEPRECATED_REASON("Y2022: This method is internal to Arcane and should be replaced by call to constructor")
   void init(SmallSpan<const Int32> nb_item, SmallSpan<const Int32> indexes,
@@ -91,6 +105,14 @@ class ARCANE_CORE_EXPORT IndexedItemConnectivityViewBase
 
  public:
 
+  /*!
+   * \internal
+   * \brief Liste dense des connectivités pour une taille fixe \a n.
+   *
+   * Lance une exception si isFixedSize(n) est faux.
+   */
+  SmallSpan<const Int32> _fixedSizeConnectedItems(Int32 n) const;
+
   inline void _checkValid(eItemKind k1, eItemKind k2) const
   {
     if (k1 != m_source_kind || k2 != m_target_kind)
@@ -185,6 +207,17 @@ class IndexedItemConnectivityGenericViewT
   {
     return m_container_view.template itemId<ItemLocalId2>(lid, index);
   }
+
+ public:
+
+  //! Vue non typée sur la connectivité
+  IndexedItemConnectivityViewBase toBaseView() const
+  {
+    return { m_container_view, ItemTraitsT<ItemType1>::kind(), ItemTraitsT<ItemType2>::kind() };
+  }
+
+  //! Indique si la connectivité est de taille fixe \a n (voir IndexedItemConnectivityViewBase::isFixedSize())
+  bool isFixedSize(Int32 n) const { return toBaseView().isFixedSize(n); }
 };
 
 /*---------------------------------------------------------------------------*/
@@ -327,6 +360,111 @@ class IndexedItemConnectivityViewT<ItemType,DoF>
   ARCCORE_HOST_DEVICE ItemLocalId2 dofId(ItemLocalIdType lid,Int32 index) const { return BaseClass::itemId(lid,index); }
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vue sur une connectivité de taille fixe entre deux entités.
+ *
+ * Cette vue est utilisable lorsque toutes les entités de type \a ItemType1
+ * sont connectées à exactement \a N entités de type \a ItemType2, ce qui est
+ * le cas par exemple pour la connectivité Cell->Node d'un maillage
+ * uniquement composé d'hexaèdres (avec \a N valant 8).
+ *
+ * Les connectivités sont alors rangées dans un tableau dense de dimensions
+ * [nbSourceItem()][N] et le nombre d'entités connectées est connu à la
+ * compilation. Contrairement à IndexedItemConnectivityViewT, l'accès à une
+ * connectivité ne nécessite pas de passer par le tableau des index et des
+ * nombres d'entités connectées, ce qui permet au compilateur de dérouler les
+ * boucles et de vectoriser les accès. Cette vue est utilisable sur
+ * accélérateur.
+ *
+ * La vue est construite à partir d'une vue classique. Il est possible
+ * de tester au préalable si cela est possible via
+ * IndexedItemConnectivityViewBase::isFixedSize(). Le constructeur lance
+ * une exception si ce n'est pas le cas.
+ *
+ * Comme toute les vues, les instances de cette classe sont temporaires et
+ * ne doivent pas être conservées entre deux évolutions du maillage.
+ */
+template <typename ItemType1, typename ItemType2, Int32 N>
+class IndexedItemConnectivityFixedSizeViewT
+{
+  static_assert(N > 0, "Number of connected items has to be positive");
+
+ public:
+
+  using ItemType1Type = ItemType1;
+  using ItemType2Type = ItemType2;
+  using ItemLocalId1 = typename ItemType1::LocalIdType;
+  using ItemLocalId2 = typename ItemType2::LocalIdType;
+  using ItemLocalIdViewType = ItemLocalIdListViewT<ItemType2>;
+
+ public:
+
+  explicit IndexedItemConnectivityFixedSizeViewT(IndexedItemConnectivityViewBase view)
+  : m_list_data(view._fixedSizeConnectedItems(N))
+  {
+#ifdef ARCANE_CHECK
+    eItemKind k1 = ItemTraitsT<ItemType1>::kind();
+    eItemKind k2 = ItemTraitsT<ItemType2>::kind();
+    view._checkValid(k1, k2);
+#endif
+  }
+  explicit IndexedItemConnectivityFixedSizeViewT(const IndexedItemConnectivityGenericViewT<ItemType1, ItemType2>& view)
+  : IndexedItemConnectivityFixedSizeViewT(view.toBaseView())
+  {
+  }
+  IndexedItemConnectivityFixedSizeViewT() = default;
+
+ public:
+
+  //! Nombre d'entités connectées à chaque entité source
+  static constexpr ARCCORE_HOST_DEVICE Int32 nbItemPerSource() { return N; }
+  //! Nombre d'entités source
+  constexpr ARCCORE_HOST_DEVICE Int32 nbSourceItem() const { return m_list_data.size() / N; }
+  //! Nombre d'entités connectées à l'entité \a lid
+  constexpr ARCCORE_HOST_DEVICE Int32 nbItem(ItemLocalId1) const { return N; }
+
+  //! Liste des entités connectées à l'entité \a lid
+  constexpr ARCCORE_HOST_DEVICE ItemLocalIdViewType items(ItemLocalId1 lid) const
+  {
+    return { _ptr(lid), N, 0 };
+  }
+
+  //! Liste des entités connectées à l'entité \a lid
+  constexpr ARCCORE_HOST_DEVICE ItemLocalIdViewType itemIds(ItemLocalId1 lid) const
+  {
+    return { _ptr(lid), N, 0 };
+  }
+
+  //! i-ème entitée connectée à l'entité \a lid
+  constexpr ARCCORE_HOST_DEVICE ItemLocalId2 itemId(ItemLocalId1 lid, Int32 index) const
+  {
+    ARCANE_CHECK_AT(index, N);
+    return ItemLocalId2(_ptr(lid)[index]);
+  }
+
+  /*!
+   * \brief Tableau dense des localId() des entités connectées.
+   *
+   * Les \a N entités connectées à l'entité source de localId() \a lid sont
+   * aux indices [lid*N,(lid+1)*N[.
+   */
+  constexpr ARCCORE_HOST_DEVICE SmallSpan<const Int32> data() const { return m_list_data; }
+
+ private:
+
+  SmallSpan<const Int32> m_list_data;
+
+ private:
+
+  constexpr ARCCORE_HOST_DEVICE const Int32* _ptr(ItemLocalId1 lid) const
+  {
+    ARCANE_CHECK_AT(lid.localId(), nbSourceItem());
+    return m_list_data.data() + static_cast<Int64>(lid.localId()) * N;
+  }
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -360,6 +498,16 @@ using IndexedDoFFaceConnectivityView = IndexedItemConnectivityViewT<DoF,Face>;
 using IndexedDoFCellConnectivityView = IndexedItemConnectivityViewT<DoF,Cell>;
 using IndexedDoFDoFConnectivityView = IndexedItemConnectivityViewT<DoF,DoF>;
 
+//! Vue sur la connectivité Cell->Node de taille fixe \a N (8 pour les hexaèdres)
+template <Int32 N>
+using IndexedCellNodeFixedSizeConnectivityView = IndexedItemConnectivityFixedSizeViewT<Cell, Node, N>;
+//! Vue sur la connectivité Cell->Face de taille fixe \a N (6 pour les hexaèdres)
+template <Int32 N>
+using IndexedCellFaceFixedSizeConnectivityView = IndexedItemConnectivityFixedSizeViewT<Cell, Face, N>;
+//! Vue sur la connectivité Face->Node de taille fixe \a N (4 pour les quadrangles)
+template <Int32 N>
+using IndexedFaceNodeFixedSizeConnectivityView = IndexedItemConnectivityFixedSizeViewT<Face, Node, N>;
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -149,6 +149,27 @@ class ItemGroupComputeFunctor
  public:
   void setGroup(ItemGroupImpl* group) { m_group = group; }
  public:
+  /*!
+   * \brief Indique si l'appartenance au groupe est un prédicat sur chaque entité.
+   *
+   * Si c'est le cas, le fait qu'une entité du groupe parent appartienne
+   * au groupe ne dépend que de cette entité et le groupe peut être mis
+   * à jour de manière incrémentale via filterItems() lorsque des entités
+   * sont ajoutées ou supprimées du groupe parent.
+   */
+  virtual bool hasItemPredicate() const { return false; }
+  /*!
+   * \brief Ajoute à \a selected_lids les entités de \a parent_lids
+   * qui appartiennent au groupe.
+   *
+   * Cette méthode n'est appelée que si hasItemPredicate() est vrai. Les
+   * entités supprimées ne doivent pas être sélectionnées.
+   */
+  virtual void filterItems(Int32ConstArrayView parent_lids,Array<Int32>& selected_lids)
+  {
+    ARCANE_UNUSED(parent_lids);
+    ARCANE_UNUSED(selected_lids);
+  }
  protected:
   ItemGroupImpl* m_group;
 };
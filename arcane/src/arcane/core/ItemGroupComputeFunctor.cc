@@ -59,6 +59,20 @@ executeFunctor()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void OwnItemGroupComputeFunctor::
+filterItems(Int32ConstArrayView parent_lids,Array<Int32>& selected_lids)
+{
+  ItemInfoListView items(m_group->itemInfoListView());
+  for( Int32 lid : parent_lids ){
+    Item item = items[lid];
+    if (!item.itemBase().isSuppressed() && item.isOwn())
+      selected_lids.add(lid);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void GhostItemGroupComputeFunctor::
 executeFunctor()
 {
@@ -87,6 +101,20 @@ executeFunctor()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void GhostItemGroupComputeFunctor::
+filterItems(Int32ConstArrayView parent_lids,Array<Int32>& selected_lids)
+{
+  ItemInfoListView items(m_group->itemInfoListView());
+  for( Int32 lid : parent_lids ){
+    Item item = items[lid];
+    if (!item.itemBase().isSuppressed() && !item.isOwn())
+      selected_lids.add(lid);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void InterfaceItemGroupComputeFunctor::
 executeFunctor()
 {
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ItemGroupComputeFunctor.h                                   (C) 2000-2016 */
+/* ItemGroupComputeFunctor.h                                   (C) 2000-2023 */
 /*                                                                           */
 /* Functors de calcul des éléments d'un groupe en fonction d'un autre groupe */
 /*---------------------------------------------------------------------------*/
@@ -39,6 +39,8 @@ class OwnItemGroupComputeFunctor
  public:
 
   void executeFunctor() override;
+  bool hasItemPredicate() const override { return true; }
+  void filterItems(Int32ConstArrayView parent_lids,Array<Int32>& selected_lids) override;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -49,6 +51,8 @@ class GhostItemGroupComputeFunctor
 {
  public:
 	void executeFunctor() override;
+  bool hasItemPredicate() const override { return true; }
+  void filterItems(Int32ConstArrayView parent_lids,Array<Int32>& selected_lids) override;
 };
 
 /*---------------------------------------------------------------------------*/
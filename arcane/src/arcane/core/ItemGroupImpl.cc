@@ -632,9 +632,13 @@ createSubGroup(const String& suffix, IItemFamily* family, ItemGroupComputeFuncto
   ItemGroupImpl* ii = ig.internal();
   ii->setComputeFunctor(functor);
   functor->setGroup(ii);
-  // Observer par défaut : le sous groupe n'est pas intéressé par les infos détaillées de transition
-  attachObserver(ii,newItemGroupObserverT(ii,
-                                          &ItemGroupImpl::_executeInvalidate));
+  // Si l'appartenance au sous-groupe est un prédicat sur chaque entité, il peut
+  // être mis à jour à partir des entités ajoutées ou supprimées du parent.
+  if (ii->m_p->m_use_incremental_update && functor->hasItemPredicate())
+    ii->m_p->m_incremental_functor = functor;
+  // Observer par défaut : le sous groupe n'est pas intéressé par les infos détaillées
+  // de transition sauf s'il est mis à jour de manière incrémentale.
+  ii->_attachToParentObserver();
   m_p->m_sub_groups[sub_name] = ii;
   ii->invalidate(false);
   return ii;
@@ -854,11 +858,19 @@ removeItems(Int32ConstArrayView items_local_id,bool check_if_present)
   IMesh* amesh = mesh();
   if (!amesh)
     throw ArgumentException(A_FUNCINFO,"null group");
-  ITraceMng* trace = amesh->traceMng();
   if (isOwn() && amesh->meshPartInfo().nbPart()!=1){
     ARCANE_THROW(NotSupportedException,"Cannot remove items if isOwn() is true");
   }
+  _removeItems(items_local_id);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
 
+void ItemGroupImpl::
+_removeItems(Int32ConstArrayView items_local_id)
+{
+  ITraceMng* trace = mesh()->traceMng();
   Integer nb_item_to_remove = items_local_id.size();
   Int32UniqueArray removed_ids, removed_lids;
 
@@ -924,6 +936,11 @@ removeItems(Int32ConstArrayView items_local_id,bool check_if_present)
   }
 
   Int32ConstArrayView observation_info(removed_lids.size(), removed_lids.unguardedBasePointer());
+  // Pour le groupe de toutes les entités, les entités supprimées sont exactement
+  // celles de \a items_local_id. Elles ne sont transmises qu'en cas de mise à jour
+  // incrémentale pour ne pas changer le comportement des autres observers.
+  if (isAllItems() && m_p->m_use_incremental_update)
+    observation_info = items_local_id;
   m_p->notifyReduceObservers(&observation_info);
 }
 
@@ -982,6 +999,19 @@ removeAddItems(Int32ConstArrayView removed_items_lids,
                        << ")";
       }
     }
+    // Transmet les entités supprimées puis ajoutées pour que les sous-groupes
+    // puissent être mis à jour de manière incrémentale. Une entité ajoutée
+    // puis supprimée lors de la même modification n'est pas transmise.
+    if (m_p->m_use_incremental_update && m_p->m_observer_need_info){
+      Int32UniqueArray valid_added_lids;
+      valid_added_lids.reserve(added_items_lids.size());
+      for( Int32 lid : added_items_lids )
+        if (!internals[lid]->isSuppressed())
+          valid_added_lids.add(lid);
+      m_p->notifyReduceObservers(&removed_items_lids);
+      Int32ConstArrayView added_info(valid_added_lids);
+      m_p->notifyExtendObservers(&added_info);
+    }
   }
   else {
     removeItems(removed_items_lids,check_if_present);
@@ -1269,6 +1299,7 @@ checkNeedUpdate()
     // bool need_invalidate_on_recompute = m_p->m_need_invalidate_on_recompute; // #B
     // m_p->m_need_invalidate_on_recompute = false;                             // #B
     if (m_p->m_compute_functor) {
+      ++m_p->m_nb_recompute;
       m_p->m_compute_functor->executeFunctor();
     }
     //     if (need_invalidate_on_recompute) { // #B
@@ -1523,6 +1554,8 @@ setComputeFunctor(IFunctor* functor)
 {
   delete m_p->m_compute_functor;
   m_p->m_compute_functor = functor;
+  // Le fonctor incrémental éventuel est positionné par createSubGroup().
+  m_p->m_incremental_functor = nullptr;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1537,6 +1570,33 @@ hasComputeFunctor() const
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+bool ItemGroupImpl::
+isIncrementalUpdate() const
+{
+  return (m_p->m_incremental_functor);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Int64 ItemGroupImpl::
+nbRecompute() const
+{
+  return m_p->m_nb_recompute;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Int64 ItemGroupImpl::
+nbIncrementalUpdate() const
+{
+  return m_p->m_nb_incremental_update;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void ItemGroupImpl::
 _initChildrenByType()
 {
@@ -1665,13 +1725,36 @@ _computeChildrenByTypeV2()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+bool ItemGroupImpl::
+_canUpdateIncrementally(const Int32ConstArrayView* info) const
+{
+  // Il faut que le groupe soit à jour pour lui appliquer la transformation
+  return (m_p->m_incremental_functor && info && !m_p->m_need_recompute);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void ItemGroupImpl::
 _executeExtend(const Int32ConstArrayView* info)
 {
-  ARCANE_UNUSED(info);
-  // On ne sait encore calculer appliquer des transformations à des groupes calculés
-  // On choisit l'invalidation systématique
-  m_p->notifyInvalidateObservers();
+  if (!_canUpdateIncrementally(info)){
+    // On ne sait pas appliquer la transformation à ce groupe calculé.
+    // On choisit l'invalidation systématique en différé (évaluée lors du prochain checkNeedUpdate)
+    _executeInvalidate();
+    return;
+  }
+  // Ajoute les nouvelles entités du parent qui appartiennent au groupe
+  Int32UniqueArray added_lids;
+  m_p->m_incremental_functor->filterItems(*info,added_lids);
+  beginTransaction();
+  addItems(added_lids,true);
+  endTransaction();
+  ++m_p->m_nb_incremental_update;
+  m_p->mesh()->traceMng()->debug(Trace::High) << "ItemGroupImpl::_executeExtend() group <" << name() << ">"
+                                              << " nb_added=" << added_lids.size()
+                                              << " nb_incremental_update=" << m_p->m_nb_incremental_update
+                                              << " nb_recompute=" << m_p->m_nb_recompute;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1680,10 +1763,111 @@ _executeExtend(const Int32ConstArrayView* info)
 void ItemGroupImpl::
 _executeReduce(const Int32ConstArrayView* info)
 {
-  ARCANE_UNUSED(info);
-  // On ne sait encore calculer appliquer des transformations à des groupes calculés
-  // On choisit l'invalidation systématique
-  m_p->notifyInvalidateObservers();
+  if (!_canUpdateIncrementally(info)){
+    // On ne sait pas appliquer la transformation à ce groupe calculé.
+    // On choisit l'invalidation systématique en différé (évaluée lors du prochain checkNeedUpdate)
+    _executeInvalidate();
+    return;
+  }
+  // Les entités supprimées du parent qui ne sont pas dans le groupe sont ignorées
+  beginTransaction();
+  _removeItems(*info);
+  endTransaction();
+  ++m_p->m_nb_incremental_update;
+  m_p->mesh()->traceMng()->debug(Trace::High) << "ItemGroupImpl::_executeReduce() group <" << name() << ">"
+                                              << " nb_removed=" << info->size()
+                                              << " nb_incremental_update=" << m_p->m_nb_incremental_update
+                                              << " nb_recompute=" << m_p->m_nb_recompute;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool ItemGroupImpl::
+computeItemsOwnerChanged(Array<Int32>& changed_items_local_id)
+{
+  changed_items_local_id.clear();
+  if (!isAllItems())
+    ARCANE_FATAL("Group '{0}' is not the group of all items",name());
+
+  // Recherche un sous-groupe à jour dont le contenu correspond
+  // aux anciens propriétaires.
+  ItemGroupImpl* ref_group = nullptr;
+  bool ref_is_own = true;
+  ItemGroupImpl* own_group = m_p->m_own_group;
+  ItemGroupImpl* ghost_group = m_p->m_ghost_group;
+  if (own_group && own_group!=this && own_group->isIncrementalUpdate() && !own_group->m_p->m_need_recompute)
+    ref_group = own_group;
+  else if (ghost_group && ghost_group->isIncrementalUpdate() && !ghost_group->m_p->m_need_recompute){
+    ref_group = ghost_group;
+    ref_is_own = false;
+  }
+  if (!ref_group)
+    return false;
+
+  BoolUniqueArray is_in_ref_group(m_p->maxLocalId(),false);
+  for( Int32 lid : ref_group->itemsLocalId() )
+    is_in_ref_group[lid] = true;
+  ItemInfoListView items(itemInfoListView());
+  for( Int32 lid : itemsLocalId() ){
+    Item item = items[lid];
+    if (item.itemBase().isSuppressed())
+      continue;
+    const bool was_own = (is_in_ref_group[lid]==ref_is_own);
+    if (item.isOwn()!=was_own)
+      changed_items_local_id.add(lid);
+  }
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ItemGroupImpl::
+updateItemsOwnerChanged(Int32ConstArrayView changed_items_local_id)
+{
+  ItemGroupImpl* parent = m_p->m_parent;
+  if (!_canUpdateIncrementally(&changed_items_local_id) || !parent || !parent->isAllItems()){
+    invalidate(false);
+    return;
+  }
+  // Les entités qui vérifient le prédicat sont ajoutées si elles ne sont
+  // pas déjà présentes et les autres sont supprimées si elles sont présentes.
+  // Comme filterItems() conserve l'ordre de \a changed_items_local_id, les
+  // entités sélectionnées forment une sous-suite de cette liste.
+  Int32UniqueArray selected_lids;
+  m_p->m_incremental_functor->filterItems(changed_items_local_id,selected_lids);
+  Int32UniqueArray removed_lids;
+  Int32 selected_index = 0;
+  const Int32 nb_selected = selected_lids.size();
+  for( Int32 lid : changed_items_local_id ){
+    if (selected_index<nb_selected && selected_lids[selected_index]==lid)
+      ++selected_index;
+    else
+      removed_lids.add(lid);
+  }
+  beginTransaction();
+  _removeItems(removed_lids);
+  addItems(selected_lids,true);
+  endTransaction();
+  ++m_p->m_nb_incremental_update;
+  m_p->mesh()->traceMng()->debug(Trace::High) << "ItemGroupImpl::updateItemsOwnerChanged() group <" << name() << ">"
+                                              << " nb_changed=" << changed_items_local_id.size()
+                                              << " nb_selected=" << nb_selected
+                                              << " nb_incremental_update=" << m_p->m_nb_incremental_update
+                                              << " nb_recompute=" << m_p->m_nb_recompute;
+
+  if (m_p->m_check_incremental_update){
+    // Compare avec le résultat d'un calcul complet
+    Int32UniqueArray expected_lids;
+    m_p->m_incremental_functor->filterItems(parent->itemsLocalId(),expected_lids);
+    Int32UniqueArray current_lids(itemsLocalId());
+    std::sort(std::begin(expected_lids),std::end(expected_lids));
+    std::sort(std::begin(current_lids),std::end(current_lids));
+    if (expected_lids!=current_lids)
+      ARCANE_FATAL("Bad incremental update after owner change for group '{0}' nb_expected={1} nb_current={2}",
+                   name(),expected_lids.size(),current_lids.size());
+  }
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1695,7 +1879,7 @@ _executeCompact(const Int32ConstArrayView* info)
   ARCANE_UNUSED(info);
   // On ne sait encore calculer appliquer des transformations à des groupes calculés
   // On choisit l'invalidation systématique en différé (évaluée lors du prochain checkNeedUpdate)
-  m_p->notifyInvalidateObservers();
+  _executeInvalidate();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1721,16 +1905,30 @@ _updateNeedInfoFlag(const bool flag)
   ItemGroupImpl * parent = m_p->m_parent;
   if (parent) {
     parent->detachObserver(this);
-    if (m_p->m_observer_need_info) {
-      parent->attachObserver(this,newItemGroupObserverT(this,
-                                                        &ItemGroupImpl::_executeExtend,
-                                                        &ItemGroupImpl::_executeReduce,
-                                                        &ItemGroupImpl::_executeCompact,
-                                                        &ItemGroupImpl::_executeInvalidate));
-    } else {
-      parent->attachObserver(this,newItemGroupObserverT(this,
-                                                        &ItemGroupImpl::_executeInvalidate));
-    }
+    _attachToParentObserver();
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ItemGroupImpl::
+_attachToParentObserver()
+{
+  ItemGroupImpl * parent = m_p->m_parent;
+  if (!parent)
+    return;
+  // Les infos de transition sont nécessaires si un observer de ce groupe en a
+  // besoin ou si le groupe est mis à jour de manière incrémentale.
+  if (m_p->m_observer_need_info || m_p->m_incremental_functor) {
+    parent->attachObserver(this,newItemGroupObserverT(this,
+                                                      &ItemGroupImpl::_executeExtend,
+                                                      &ItemGroupImpl::_executeReduce,
+                                                      &ItemGroupImpl::_executeCompact,
+                                                      &ItemGroupImpl::_executeInvalidate));
+  } else {
+    parent->attachObserver(this,newItemGroupObserverT(this,
+                                                      &ItemGroupImpl::_executeInvalidate));
   }
 }
 
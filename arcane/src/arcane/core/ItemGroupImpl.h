@@ -387,6 +387,49 @@ class ARCANE_CORE_EXPORT ItemGroupImpl
   //! Indique si le groupe est calculé
   bool hasComputeFunctor() const;
 
+  /*!
+   * \brief Indique si le groupe calculé est mis à jour de manière incrémentale.
+   *
+   * C'est le cas si la variable d'environnement ARCANE_ITEMGROUP_INCREMENTAL_UPDATE
+   * est positionnée et que le fonctor de calcul du groupe est un prédicat
+   * sur chaque entité du parent (par exemple pour les groupes des entités
+   * propres ou fantômes). Dans ce cas, lorsque des entités sont ajoutées
+   * ou supprimées du groupe parent, le groupe est modifié à partir de
+   * ces listes au lieu d'être entièrement recalculé.
+   */
+  bool isIncrementalUpdate() const;
+
+  //! Nombre de recalculs complets du groupe via son fonctor de calcul
+  Int64 nbRecompute() const;
+
+  //! Nombre de mises à jour incrémentales du groupe
+  Int64 nbIncrementalUpdate() const;
+
+  /*!
+   * \brief Calcule la liste des entités dont le propriétaire a changé.
+   *
+   * Cette méthode ne doit être appelée que sur le groupe de toutes les
+   * entités, après la modification des propriétaires et avant la mise à jour
+   * des groupes calculés. La liste est déduite du contenu du sous-groupe
+   * des entités propres (ou à défaut fantômes) de ce groupe, qui n'a pas
+   * encore été modifié. Retourne \a false si aucun de ces sous-groupes n'est
+   * mis à jour de manière incrémentale et à jour. Dans ce cas, la liste
+   * \a changed_items_local_id n'est pas valide.
+   */
+  bool computeItemsOwnerChanged(Array<Int32>& changed_items_local_id);
+
+  /*!
+   * \brief Met à jour le groupe suite au changement de propriétaire d'entités.
+   *
+   * \a changed_items_local_id contient les numéros locaux des entités du
+   * groupe parent dont le propriétaire a changé, par exemple calculé par
+   * computeItemsOwnerChanged(). Si le groupe n'est pas mis à jour de manière
+   * incrémentale ou si son parent n'est pas le groupe de toutes les entités,
+   * le groupe est invalidé. Si ARCANE_ITEMGROUP_INCREMENTAL_UPDATE vaut 2,
+   * le résultat est comparé à celui d'un calcul complet.
+   */
+  void updateItemsOwnerChanged(Int32ConstArrayView changed_items_local_id);
+
   /*!
    * \brief Détruit le groupe. Après cet appel, le groupe devient un groupe nul.
    *
@@ -465,6 +508,12 @@ class ARCANE_CORE_EXPORT ItemGroupImpl
   void _executeInvalidate();
   //! Mise à jour forcée du flag d'information de restructuration
   void _updateNeedInfoFlag(const bool flag);
+  //! Attache au groupe parent l'observer adapté aux besoins de ce groupe
+  void _attachToParentObserver();
+  //! Indique si on peut mettre à jour le groupe de manière incrémentale avec \a info
+  bool _canUpdateIncrementally(const Int32ConstArrayView* info) const;
+  //! Supprime les entités \a items_local_id sans vérifier la validité de l'opération
+  void _removeItems(Int32ConstArrayView items_local_id);
   //! Invalidate forcée récursive
   /*! Ne notifie pas les observers. Devra être suivi d'un invalidate() normal */
   void _forceInvalidate(const bool self_invalidate);
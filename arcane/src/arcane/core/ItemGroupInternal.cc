@@ -114,6 +114,13 @@ _init()
 
   if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_DEBUG_APPLYOPERATION", true))
     m_is_debug_apply_operation = (v.value()>0);
+
+  // Regarde si on met à jour les sous-groupes calculés de manière incrémentale.
+  // Avec la valeur 2, on vérifie en plus ces mises à jour.
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_ITEMGROUP_INCREMENTAL_UPDATE", true)){
+    m_use_incremental_update = (v.value()>0);
+    m_check_incremental_update = (v.value()>1);
+  }
 }
 
 /*---------------------------------------------------------------------------*/
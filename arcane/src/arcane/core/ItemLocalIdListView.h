@@ -228,6 +228,8 @@ class ItemLocalIdListViewT
 : public ItemLocalIdListView
 {
   friend class ItemConnectivityContainerView;
+  template <typename ItemType1, typename ItemType2, Int32 N>
+  friend class IndexedItemConnectivityFixedSizeViewT;
   friend mesh::IndexedItemConnectivityAccessor;
   friend ArcaneTest::MeshUnitTest;
   friend class Item;
@@ -119,6 +119,8 @@ using ItemLocalIdView ARCANE_DEPRECATED_REASON("Use 'ItemLocalIdViewT' instead")
 
 template<typename ItemType1,typename ItemType2>
 class IndexedItemConnectivityViewT;
+template<typename ItemType1,typename ItemType2,Int32 N>
+class IndexedItemConnectivityFixedSizeViewT;
 
 // (Avril 2022) Fait un typedef de 'IndexedItemConnectivityView' vers 'IndexedItemConnectivityViewT'
 // pour compatibilité avec l'existant. A supprimer dès que possible.
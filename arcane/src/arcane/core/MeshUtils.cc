@@ -49,9 +49,12 @@
 #include "arcane/core/IVariableSynchronizer.h"
 #include "arcane/core/UnstructuredMeshConnectivity.h"
 #include "arcane/core/datatype/DataAllocationInfo.h"
+#include "arcane/core/IItemInternalSortFunction.h"
+#include "arcane/core/internal/IItemFamilyInternal.h"
 
 #include <algorithm>
 #include <map>
+#include <numeric>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -1863,6 +1866,332 @@ checkUniqueIdsHashCollective(IItemFamily* family, IHashAlgorithm* hash_algo,
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+namespace
+{
+/*!
+ * \brief Fonction de tri des entités suivant une clé associée à leur numéro local.
+ *
+ * Les entités supprimées sont placées à la fin. Les entités de même clé
+ * sont triées par uniqueId() croissant.
+ */
+class LocalIdKeyItemSortFunction
+: public IItemInternalSortFunction
+{
+ public:
+
+  explicit LocalIdKeyItemSortFunction(UniqueArray<Int64>&& keys)
+  : m_name("LocalityRenumbering")
+  , m_keys(std::move(keys))
+  {}
+
+ public:
+
+  const String& name() const override { return m_name; }
+
+  void sortItems(ItemInternalMutableArrayView items) override
+  {
+    auto compare = [&](const ItemInternal* item1, const ItemInternal* item2) {
+      bool s1 = item1->isSuppressed();
+      bool s2 = item2->isSuppressed();
+      if (s1 != s2)
+        return s2;
+      if (s1)
+        return item1->uniqueId() < item2->uniqueId();
+      Int64 k1 = m_keys[item1->localId()];
+      Int64 k2 = m_keys[item2->localId()];
+      if (k1 != k2)
+        return k1 < k2;
+      return item1->uniqueId() < item2->uniqueId();
+    };
+    std::sort(std::begin(items), std::end(items), compare);
+  }
+
+ private:
+
+  String m_name;
+  UniqueArray<Int64> m_keys;
+};
+
+/*!
+ * \brief Calcule l'indice de Hilbert à partir des coordonnées entières \a x.
+ *
+ * Utilise l'algorithme de J. Skilling ("Programming the Hilbert curve",
+ * AIP Conf. Proc. 707, 2004) avec \a nb_bit bits par dimension.
+ */
+UInt64 _hilbertIndex(UInt64* x, Int32 nb_dim, Int32 nb_bit)
+{
+  const UInt64 m = UInt64(1) << (nb_bit - 1);
+  // Transformation inverse
+  for (UInt64 q = m; q > 1; q >>= 1) {
+    const UInt64 p = q - 1;
+    for (Int32 i = 0; i < nb_dim; ++i) {
+      if (x[i] & q)
+        x[0] ^= p;
+      else {
+        UInt64 t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+  // Encodage de Gray
+  for (Int32 i = 1; i < nb_dim; ++i)
+    x[i] ^= x[i - 1];
+  UInt64 t = 0;
+  for (UInt64 q = m; q > 1; q >>= 1)
+    if (x[nb_dim - 1] & q)
+      t ^= q - 1;
+  for (Int32 i = 0; i < nb_dim; ++i)
+    x[i] ^= t;
+  UInt64 index = 0;
+  for (Int32 b = nb_bit - 1; b >= 0; --b)
+    for (Int32 i = 0; i < nb_dim; ++i)
+      index = (index << 1) | ((x[i] >> b) & 1);
+  return index;
+}
+
+//! Calcule l'indice de Morton en entrelaçant les bits de \a x.
+UInt64 _mortonIndex(const UInt64* x, Int32 nb_dim, Int32 nb_bit)
+{
+  UInt64 index = 0;
+  for (Int32 b = nb_bit - 1; b >= 0; --b)
+    for (Int32 i = 0; i < nb_dim; ++i)
+      index = (index << 1) | ((x[i] >> b) & 1);
+  return index;
+}
+
+/*!
+ * \brief Calcule la position de chaque maille suivant une courbe
+ * remplissant l'espace appliquée aux centres des mailles.
+ */
+void _computeSpaceFillingCurveCellKeys(IMesh* mesh, bool use_hilbert, Array<Int64>& cell_keys)
+{
+  const Int32 nb_dim = math::max(1, math::min(3, mesh->dimension()));
+  const Int32 nb_bit = 63 / nb_dim;
+  SharedVariableNodeReal3 nodes_coordinates(mesh->sharedNodesCoordinates());
+  CellGroup all_cells = mesh->allCells();
+  const Int32 nb_cell = all_cells.size();
+
+  UniqueArray<Real3> centers(nb_cell);
+  UniqueArray<Int32> cells_local_id(nb_cell);
+  Real3 min_bound(FloatInfo<Real>::maxValue(), FloatInfo<Real>::maxValue(), FloatInfo<Real>::maxValue());
+  Real3 max_bound(-FloatInfo<Real>::maxValue(), -FloatInfo<Real>::maxValue(), -FloatInfo<Real>::maxValue());
+  ENUMERATE_ (Cell, icell, all_cells) {
+    Cell cell = *icell;
+    Real3 center;
+    for (Node node : cell.nodes())
+      center += nodes_coordinates[node];
+    if (cell.nbNode() != 0)
+      center /= static_cast<Real>(cell.nbNode());
+    centers[icell.index()] = center;
+    cells_local_id[icell.index()] = cell.localId();
+    min_bound = math::min(min_bound, center);
+    max_bound = math::max(max_bound, center);
+  }
+
+  const Real max_coord = static_cast<Real>((UInt64(1) << nb_bit) - 1);
+  Real scale[3];
+  for (Int32 i = 0; i < 3; ++i) {
+    Real length = max_bound[i] - min_bound[i];
+    scale[i] = (length > 0.0) ? (max_coord / length) : 0.0;
+  }
+
+  UniqueArray<UInt64> curve_indexes(nb_cell);
+  for (Int32 i = 0; i < nb_cell; ++i) {
+    UInt64 x[3];
+    for (Int32 d = 0; d < nb_dim; ++d)
+      x[d] = static_cast<UInt64>((centers[i][d] - min_bound[d]) * scale[d]);
+    curve_indexes[i] = (use_hilbert) ? _hilbertIndex(x, nb_dim, nb_bit) : _mortonIndex(x, nb_dim, nb_bit);
+  }
+
+  // Trie les mailles suivant leur indice sur la courbe et utilise la
+  // position dans la liste triée comme clé.
+  UniqueArray<Int32> order(nb_cell);
+  std::iota(order.begin(), order.end(), 0);
+  ItemInfoListView cells_info(mesh->cellFamily());
+  std::sort(order.begin(), order.end(), [&](Int32 a, Int32 b) {
+    if (curve_indexes[a] != curve_indexes[b])
+      return curve_indexes[a] < curve_indexes[b];
+    return cells_info[cells_local_id[a]].uniqueId() < cells_info[cells_local_id[b]].uniqueId();
+  });
+  for (Int32 i = 0; i < nb_cell; ++i)
+    cell_keys[cells_local_id[order[i]]] = i;
+}
+
+/*!
+ * \brief Calcule la position de chaque maille via l'algorithme
+ * Reverse Cuthill-McKee sur le graphe des mailles connectées par une face.
+ */
+void _computeReverseCuthillMcKeeCellKeys(IMesh* mesh, Array<Int64>& cell_keys)
+{
+  IItemFamily* cell_family = mesh->cellFamily();
+  const Int32 max_local_id = cell_family->maxLocalId();
+  CellGroup all_cells = mesh->allCells();
+  const Int32 nb_cell = all_cells.size();
+
+  // Graphe maille/maille au format CSR (indexé par numéro local).
+  UniqueArray<Int32> neighbour_index(max_local_id + 1, 0);
+  ENUMERATE_ (Cell, icell, all_cells) {
+    Cell cell = *icell;
+    Int32 n = 0;
+    for (Face face : cell.faces())
+      if (face.nbCell() == 2)
+        ++n;
+    neighbour_index[cell.localId() + 1] = n;
+  }
+  for (Int32 i = 0; i < max_local_id; ++i)
+    neighbour_index[i + 1] += neighbour_index[i];
+  UniqueArray<Int32> neighbours(neighbour_index[max_local_id]);
+  ENUMERATE_ (Cell, icell, all_cells) {
+    Cell cell = *icell;
+    Int32 pos = neighbour_index[cell.localId()];
+    for (Face face : cell.faces()) {
+      if (face.nbCell() != 2)
+        continue;
+      Cell other = (face.cell(0) == cell) ? face.cell(1) : face.cell(0);
+      neighbours[pos] = other.localId();
+      ++pos;
+    }
+  }
+  auto degree = [&](Int32 lid) { return neighbour_index[lid + 1] - neighbour_index[lid]; };
+  ItemInfoListView cells_info(cell_family);
+  auto compare_degree = [&](Int32 a, Int32 b) {
+    Int32 da = degree(a);
+    Int32 db = degree(b);
+    if (da != db)
+      return da < db;
+    return cells_info[a].uniqueId() < cells_info[b].uniqueId();
+  };
+
+  // Les points de départ sont choisis parmi les mailles de plus petit degré.
+  UniqueArray<Int32> start_candidates(all_cells.view().localIds());
+  std::sort(start_candidates.begin(), start_candidates.end(), compare_degree);
+
+  UniqueArray<bool> is_visited(max_local_id, false);
+  UniqueArray<Int32> order;
+  order.reserve(nb_cell);
+  UniqueArray<Int32> current_neighbours;
+  for (Int32 start : start_candidates) {
+    if (is_visited[start])
+      continue;
+    // Parcours en largeur de la composante connexe.
+    Int32 queue_index = order.size();
+    order.add(start);
+    is_visited[start] = true;
+    while (queue_index < order.size()) {
+      Int32 lid = order[queue_index];
+      ++queue_index;
+      current_neighbours.clear();
+      for (Int32 z = neighbour_index[lid], zn = neighbour_index[lid + 1]; z < zn; ++z) {
+        Int32 neighbour = neighbours[z];
+        if (!is_visited[neighbour]) {
+          is_visited[neighbour] = true;
+          current_neighbours.add(neighbour);
+        }
+      }
+      std::sort(current_neighbours.begin(), current_neighbours.end(), compare_degree);
+      order.addRange(current_neighbours);
+    }
+  }
+
+  for (Int32 i = 0; i < nb_cell; ++i)
+    cell_keys[order[nb_cell - 1 - i]] = i;
+}
+
+/*!
+ * \brief Calcule pour chaque entité de \a items la plus petite clé
+ * des mailles auxquelles elle est connectée.
+ */
+template <typename ItemType> void
+_computeKeysFromCells(ItemGroupT<ItemType> items, ConstArrayView<Int64> cell_keys, Array<Int64>& keys)
+{
+  ENUMERATE_ (ItemType, iitem, items) {
+    ItemType item = *iitem;
+    Int64 key = INT64_MAX;
+    for (CellLocalId cell_id : item.cellIds())
+      key = math::min(key, cell_keys[cell_id]);
+    keys[item.localId()] = key;
+  }
+}
+
+/*!
+ * \brief Renumérote les entités de \a family suivant les clés \a keys.
+ *
+ * La fonction de tri de la famille est temporairement remplacée puis
+ * remise en place sans être détruite.
+ */
+void _applyKeys(IItemFamily* family, UniqueArray<Int64>&& keys)
+{
+  if (family->nbItem() == 0)
+    return;
+  IItemFamilyInternal* family_internal = family->_internalApi();
+  LocalIdKeyItemSortFunction sort_function(std::move(keys));
+  IItemInternalSortFunction* old_sort_function = family_internal->swapItemSortFunction(&sort_function);
+  try {
+    family->compactItems(true);
+  }
+  catch (...) {
+    family_internal->swapItemSortFunction(old_sort_function);
+    throw;
+  }
+  family_internal->swapItemSortFunction(old_sort_function);
+}
+
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshUtils::
+computeCellLocalityKeys(IMesh* mesh, eLocalityRenumberingAlgorithm algorithm, Array<Int64>& cell_keys)
+{
+  ARCANE_CHECK_POINTER(mesh);
+  switch (algorithm) {
+  case eLocalityRenumberingAlgorithm::Morton:
+    _computeSpaceFillingCurveCellKeys(mesh, false, cell_keys);
+    break;
+  case eLocalityRenumberingAlgorithm::Hilbert:
+    _computeSpaceFillingCurveCellKeys(mesh, true, cell_keys);
+    break;
+  case eLocalityRenumberingAlgorithm::ReverseCuthillMcKee:
+    _computeReverseCuthillMcKeeCellKeys(mesh, cell_keys);
+    break;
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshUtils::
+renumberItemsForLocality(IMesh* mesh, eLocalityRenumberingAlgorithm algorithm)
+{
+  ARCANE_CHECK_POINTER(mesh);
+  ITraceMng* tm = mesh->traceMng();
+  tm->info(4) << "Renumbering mesh items for locality mesh=" << mesh->name()
+              << " algorithm=" << static_cast<int>(algorithm);
+
+  IItemFamily* cell_family = mesh->cellFamily();
+  UniqueArray<Int64> cell_keys(cell_family->maxLocalId(), INT64_MAX);
+  computeCellLocalityKeys(mesh, algorithm, cell_keys);
+
+  // Calcule les clés des autres familles avant de modifier les
+  // numéros locaux des mailles.
+  UniqueArray<Int64> node_keys(mesh->nodeFamily()->maxLocalId(), INT64_MAX);
+  _computeKeysFromCells(mesh->allNodes(), cell_keys, node_keys);
+  UniqueArray<Int64> edge_keys(mesh->edgeFamily()->maxLocalId(), INT64_MAX);
+  _computeKeysFromCells(mesh->allEdges(), cell_keys, edge_keys);
+  UniqueArray<Int64> face_keys(mesh->faceFamily()->maxLocalId(), INT64_MAX);
+  _computeKeysFromCells(mesh->allFaces(), cell_keys, face_keys);
+
+  _applyKeys(cell_family, std::move(cell_keys));
+  _applyKeys(mesh->nodeFamily(), std::move(node_keys));
+  _applyKeys(mesh->edgeFamily(), std::move(edge_keys));
+  _applyKeys(mesh->faceFamily(), std::move(face_keys));
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 } // End namespace Arcane
 
 /*---------------------------------------------------------------------------*/
@@ -242,6 +242,58 @@ computeConnectivityPatternOccurence(IMesh* mesh);
 extern "C++" ARCANE_CORE_EXPORT void
 markMeshConnectivitiesAsMostlyReadOnly(IMesh* mesh);
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Algorithme de renumérotation des entités pour la localité mémoire.
+ * \sa renumberItemsForLocality().
+ */
+enum class eLocalityRenumberingAlgorithm
+{
+  //! Courbe de Morton (Z-order) sur les centres des mailles
+  Morton,
+  //! Courbe de Hilbert sur les centres des mailles
+  Hilbert,
+  //! Reverse Cuthill-McKee sur le graphe maille/maille via les faces
+  ReverseCuthillMcKee
+};
+
+/*!
+ * \brief Renumérote les entités du maillage pour améliorer la localité mémoire.
+ *
+ * Les mailles sont ordonnées suivant l'algorithme \a algorithm. Les
+ * noeuds, arêtes et faces sont ensuite ordonnés suivant la plus petite
+ * position des mailles auxquelles ils sont connectés. Les nouveaux
+ * numéros locaux sont appliqués via IItemFamily::compactItems() en
+ * utilisant temporairement une fonction de tri spécifique
+ * (IItemInternalSortFunction). Après l'appel, chaque famille retrouve
+ * la fonction de tri qu'elle avait avant l'appel
+ * (IItemFamily::itemSortFunction()).
+ *
+ * Seuls les numéros locaux sont modifiés. Cette opération n'est pas
+ * collective et peut être appelée par exemple après la lecture ou le
+ * partitionnement du maillage.
+ *
+ * \warning L'ordre obtenu n'est pas conservé par les compactages
+ * ultérieurs avec tri (par exemple lors d'un IMeshModifier::endUpdate()
+ * si la propriété 'sort' du maillage est vraie) : ces derniers
+ * utilisent la fonction de tri de la famille et remplacent donc l'ordre
+ * calculé ici. Il faut dans ce cas appeler à nouveau cette méthode.
+ */
+extern "C++" ARCANE_CORE_EXPORT void
+renumberItemsForLocality(IMesh* mesh, eLocalityRenumberingAlgorithm algorithm);
+
+/*!
+ * \brief Calcule la position des mailles pour la renumérotation.
+ *
+ * Remplit \a cell_keys, indexé par le numéro local des mailles, avec la
+ * position de chaque maille suivant l'algorithme \a algorithm. Il s'agit
+ * de l'ordre utilisé par renumberItemsForLocality() pour les mailles.
+ * \a cell_keys doit avoir au moins cellFamily()->maxLocalId() éléments.
+ */
+extern "C++" ARCANE_CORE_EXPORT void
+computeCellLocalityKeys(IMesh* mesh, eLocalityRenumberingAlgorithm algorithm, Array<Int64>& cell_keys);
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*
@@ -1,20 +1,29 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MeshVariable.cc                                             (C) 2000-2020 */
+/* MeshVariable.cc                                             (C) 2000-2023 */
 /*                                                                           */
 /* Variable du maillage.                                                     */
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
 #include "arcane/MeshVariableRef.h"
+
+#include "arcane/utils/FatalErrorException.h"
+
 #include "arcane/ItemGroup.h"
 #include "arcane/IMesh.h"
 #include "arcane/MeshHandle.h"
+#include "arcane/IVariable.h"
+#include "arcane/IVariableMng.h"
+#include "arcane/IVariableSynchronizerMng.h"
+#include "arcane/IVariableSynchronizer.h"
+#include "arcane/IVariableSynchronizerRequest.h"
+#include "arcane/IItemFamily.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -87,6 +96,34 @@ synchronize()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void MeshVariableRef::
+deferSynchronize()
+{
+  IVariable* var = variable();
+  var->variableMng()->synchronizerMng()->addDeferredSynchronization(var);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Ref<IVariableSynchronizerRequest> MeshVariableRef::
+synchronizeAsync()
+{
+  IVariable* var = variable();
+  IItemFamily* family = var->itemFamily();
+  if (!family)
+    ARCANE_FATAL("Variable '{0}' has no family and can not be synchronized", var->fullName());
+  IVariableSynchronizer* synchronizer = nullptr;
+  if (var->isPartial())
+    synchronizer = var->itemGroup().synchronizer();
+  else
+    synchronizer = family->allItemsSynchronizer();
+  return synchronizer->synchronizeAsync(var);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 } // End namespace Arcane
 
 /*---------------------------------------------------------------------------*/
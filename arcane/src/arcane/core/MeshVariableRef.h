@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MeshVariableRef.h                                           (C) 2000-2022 */
+/* MeshVariableRef.h                                           (C) 2000-2023 */
 /*                                                                           */
 /* Classe gérant une variable sur une entité du maillage.                    */
 /*---------------------------------------------------------------------------*/
@@ -22,6 +22,7 @@
 
 namespace Arcane
 {
+class IVariableSynchronizerRequest;
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -49,6 +50,25 @@ class ARCANE_CORE_EXPORT MeshVariableRef
 
   void synchronize();
 
+  /*!
+   * \brief Demande une synchronisation différée de la variable.
+   *
+   * La synchronisation est effectuée au plus tard à la fin du point d'entrée
+   * courant, en même temps que celles des autres variables demandées de la
+   * même manière. Voir IVariableSynchronizerMng::addDeferredSynchronization()
+   * pour plus d'informations.
+   */
+  void deferSynchronize();
+
+  /*!
+   * \brief Commence une synchronisation non bloquante de la variable.
+   *
+   * Les valeurs des entités fantômes ne sont valides qu'après l'appel à
+   * IVariableSynchronizerRequest::wait() sur l'instance retournée. Voir
+   * IVariableSynchronizer::synchronizeAsync() pour plus d'informations.
+   */
+  Ref<IVariableSynchronizerRequest> synchronizeAsync();
+
  protected:
 
   void _internalInit(IVariable*);
@@ -17,6 +17,7 @@
 #include "arcane/utils/Real2x2.h"
 #include "arcane/utils/Real3x3.h"
 #include "arcane/utils/HPReal.h"
+#include "arcane/utils/ExactRealSum.h"
 #include "arcane/utils/NotImplementedException.h"
 #include "arcane/utils/ScopedPtr.h"
 #include "arcane/utils/Ref.h"
@@ -28,6 +29,7 @@
 #include "arcane/core/Timer.h"
 #include "arcane/core/ITimeStats.h"
 #include "arcane/core/IParallelNonBlockingCollective.h"
+#include "arcane/core/ParallelMngUtils.h"
 #include "arcane/core/internal/IParallelMngInternal.h"
 
 #include "arcane/accelerator/core/Runner.h"
@@ -226,6 +228,8 @@ class ParallelMngDispatcher::Impl
   {
     if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_DISABLE_ACCELERATOR_AWARE_MESSAGE_PASSING", true))
       m_is_accelerator_aware_disabled = (v.value()!=0);
+    if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_REPRODUCIBLE_REDUCE_SUM", true))
+      m_is_reproducible_reduce_sum = (v.value()!=0);
   }
   ~Impl()
   {
@@ -243,6 +247,7 @@ class ParallelMngDispatcher::Impl
       return false;
     return m_parallel_mng->_isAcceleratorAware();
   }
+  bool isReproducibleReduceSum() const override { return m_is_reproducible_reduce_sum; }
   void setDefaultRunner(Runner* runner) override
   {
     m_runner = runner;
@@ -256,6 +261,7 @@ class ParallelMngDispatcher::Impl
     else
       m_queue.reset();
   }
+  void setReproducibleReduceSum(bool v) override { m_is_reproducible_reduce_sum = v; }
 
  private:
 
@@ -264,6 +270,7 @@ class ParallelMngDispatcher::Impl
   Ref<RunQueue> m_queue;
   Runner m_runner_ref;
   bool m_is_accelerator_aware_disabled = false;
+  bool m_is_reproducible_reduce_sum = false;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -561,6 +568,32 @@ testSomeRequests(ArrayView<Request> requests)
   return _doWaitRequests(requests,Parallel::WaitSomeNonBlocking);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Effectue une somme reproductible de \a values si ce mode est actif.
+ *
+ * Chaque valeur est convertie en un accumulateur exact et ce sont ces
+ * accumulateurs qui sont sommés. Le résultat ne dépend donc pas de l'ordre
+ * dans lequel l'implémentation combine les contributions des rangs.
+ *
+ * Retourne \a false si la réduction n'a pas été effectuée.
+ */
+bool ParallelMngDispatcher::
+_reduceReproducibleSum(eReduceType rt,ArrayView<Real> values)
+{
+  if (rt!=Parallel::ReduceSum || !m_parallel_mng_internal->isReproducibleReduceSum())
+    return false;
+  const Int32 n = values.size();
+  UniqueArray<ExactRealSum> sums(n);
+  for( Int32 i=0; i<n; ++i )
+    sums[i].add(values[i]);
+  ParallelMngUtils::reduceExactSum(this,sums);
+  for( Int32 i=0; i<n; ++i )
+    values[i] = sums[i].toReal();
+  return true;
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -599,12 +632,16 @@ type ParallelMngDispatcher::\
 reduce(eReduceType rt,type v)\
 {\
   Timer::Phase tphase(timeStats(),TP_Communication);\
+  if (_reduceReproducibleSum(rt,ArrayView<type>(1,&v)))\
+    return v;\
   return field->allReduce(rt,v);\
 }\
 void ParallelMngDispatcher::\
 reduce(eReduceType rt,ArrayView<type> v)\
 {\
   Timer::Phase tphase(timeStats(),TP_Communication);\
+  if (_reduceReproducibleSum(rt,v))\
+    return;\
   field->allReduce(rt,v);\
 }\
 void ParallelMngDispatcher::\
@@ -295,6 +295,13 @@ class ARCANE_CORE_EXPORT ParallelMngDispatcher
   void _setControlDispatcher(MP::IControlDispatcher* d);
   void _setSerializeDispatcher(MP::ISerializeDispatcher* d);
 
+ private:
+
+  // Seule la somme de 'Real' peut être reproductible.
+  template<typename DataType> bool
+  _reduceReproducibleSum(eReduceType,ArrayView<DataType>) { return false; }
+  bool _reduceReproducibleSum(eReduceType rt,ArrayView<Real> values);
+
  private:
   
   ITimeStats* m_time_stats = nullptr;
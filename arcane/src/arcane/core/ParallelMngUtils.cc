@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ParallelMngUtils.cc                                         (C) 2000-2021 */
+/* ParallelMngUtils.cc                                         (C) 2000-2023 */
 /*                                                                           */
 /* Fonctions utilitaires associées aux 'IParallelMng'.                       */
 /*---------------------------------------------------------------------------*/
@@ -13,8 +13,12 @@
 
 #include "arcane/ParallelMngUtils.h"
 
+#include "arcane/utils/Array.h"
+#include "arcane/utils/ExactRealSum.h"
+
 #include "arcane/IParallelMng.h"
 #include "arcane/IParallelMngUtilsFactory.h"
+#include "arcane/core/internal/IParallelMngInternal.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -132,6 +136,42 @@ createTopologyRef(IParallelMng* pm)
   return ParallelMngUtilsAccessor::createTopology(pm);
 }
 
+void
+setReproducibleReduceSum(IParallelMng* pm,bool v)
+{
+  ARCANE_CHECK_POINTER(pm);
+  pm->_internalApi()->setReproducibleReduceSum(v);
+}
+
+bool
+isReproducibleReduceSum(IParallelMng* pm)
+{
+  ARCANE_CHECK_POINTER(pm);
+  return pm->_internalApi()->isReproducibleReduceSum();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void
+reduceExactSum(IParallelMng* pm,ArrayView<ExactRealSum> values)
+{
+  ARCANE_CHECK_POINTER(pm);
+  // Les chiffres normalisés sont inférieurs à 2^32 donc leur somme sur
+  // tous les rangs tient dans un Int64. Cette somme entière est exacte et
+  // ne dépend pas de l'ordre des opérations.
+  const Int32 nb_word = ExactRealSum::NB_WORD;
+  const Int32 n = values.size();
+  UniqueArray<Int64> words(n * nb_word);
+  for( Int32 i=0; i<n; ++i ){
+    values[i].normalize();
+    words.subView(i * nb_word, nb_word).copy(values[i].words());
+  }
+  pm->reduce(Parallel::ReduceSum,words.view());
+  for( Int32 i=0; i<n; ++i )
+    values[i] = ExactRealSum::fromWords(words.subConstView(i * nb_word, nb_word));
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
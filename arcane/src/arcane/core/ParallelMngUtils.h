@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ParallelMngUtils.h                                          (C) 2000-2021 */
+/* ParallelMngUtils.h                                          (C) 2000-2023 */
 /*                                                                           */
 /* Fonctions utilitaires associées aux 'IParallelMng'.                       */
 /*---------------------------------------------------------------------------*/
@@ -69,6 +69,41 @@ createSynchronizerRef(IParallelMng* pm,const ItemGroup& group);
 extern "C++" ARCANE_CORE_EXPORT Ref<IParallelTopology>
 createTopologyRef(IParallelMng* pm);
 
+/*!
+ * \brief Active ou désactive le mode de somme reproductible de \a pm.
+ *
+ * Dans ce mode, les appels à IParallelMng::reduce() avec
+ * Parallel::ReduceSum pour le type Real donnent un résultat identique au
+ * bit près quel que soit l'ordre dans lequel les contributions des rangs
+ * sont combinées. Ce mode est plus coûteux qu'une réduction classique car
+ * il échange ExactRealSum::NB_WORD entiers par valeur. Il peut aussi être
+ * activé en positionnant la variable d'environnement
+ * ARCANE_REPRODUCIBLE_REDUCE_SUM à 1.
+ *
+ * Le résultat dépend toujours de la valeur fournie par chaque rang. Pour
+ * qu'il ne dépende pas non plus du nombre de rangs, il faut accumuler les
+ * valeurs locales dans un ExactRealSum et utiliser reduceExactSum().
+ *
+ * Cette opération n'est pas collective mais tous les rangs doivent
+ * utiliser le même mode.
+ */
+extern "C++" ARCANE_CORE_EXPORT void
+setReproducibleReduceSum(IParallelMng* pm,bool v);
+
+//! Indique si le mode de somme reproductible de \a pm est actif
+extern "C++" ARCANE_CORE_EXPORT bool
+isReproducibleReduceSum(IParallelMng* pm);
+
+/*!
+ * \brief Somme sur tous les rangs de \a pm les accumulateurs \a values.
+ *
+ * La somme est exacte et ne dépend ni du nombre de rangs ni de l'ordre
+ * des opérations. En retour, \a values contient la somme des
+ * accumulateurs de tous les rangs. Cette opération est collective.
+ */
+extern "C++" ARCANE_CORE_EXPORT void
+reduceExactSum(IParallelMng* pm,ArrayView<ExactRealSum> values);
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* SimdItem.h                                                  (C) 2000-2022 */
+/* SimdItem.h                                                  (C) 2000-2023 */
 /*                                                                           */
 /* Types des entités et des énumérateurs des entités pour la vectorisation.  */
 /*---------------------------------------------------------------------------*/
@@ -508,6 +508,76 @@ typedef SimdItemT<Particle> SimdParticle;
 typedef SimdItemT<Cell> SimdCell;
 #endif
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \ingroup ArcaneSimd
+ * \brief Index vectoriel des entités connectées à un vecteur d'entités.
+ *
+ * Pour un vecteur d'entités de type \a ItemType1 (par exemple un SimdCell),
+ * cette classe contient pour chaque composante du vecteur le localId() de
+ * la \a index-ème entité de type \a ItemType2 qui lui est connectée. Elle
+ * s'utilise comme un SimdItemIndexT<ItemType2> pour accéder aux vues sur les
+ * variables. Par exemple, pour récupérer les coordonnées des noeuds des
+ * mailles:
+ *
+ * \code
+ * UnstructuredMeshConnectivityView connectivity_view(mesh);
+ * auto cell_node = connectivity_view.cellNode();
+ * auto in_coords = viewIn(mesh->nodesCoordinates());
+ * ENUMERATE_SIMD_CELL(icell,cells){
+ *   SimdCell vi(*icell);
+ *   SimdReal3 center(SimdReal(0.0),SimdReal(0.0),SimdReal(0.0));
+ *   for( Int32 n=0; n<8; ++n ){
+ *     SimdConnectedItemIndexT<Cell,Node> node_index(cell_node,vi,n);
+ *     center = center + in_coords[node_index];
+ *   }
+ * }
+ * \endcode
+ *
+ * \a ConnectivityViewType peut être une vue de type
+ * IndexedItemConnectivityViewT ou IndexedItemConnectivityFixedSizeViewT.
+ *
+ * Pour les composantes non valides d'un vecteur (au dela de
+ * SimdItemEnumeratorBase::nbValid()), les entités des groupes sont
+ * complétées par la dernière entité valide et donc les indices
+ * restent valides. Toutes les entités du vecteur doivent avoir au
+ * moins (\a index + 1) entités connectées.
+ */
+template<typename ItemType1,typename ItemType2>
+class SimdConnectedItemIndexT
+{
+ public:
+
+  typedef SimdInfo::SimdInt32IndexType SimdIndexType;
+
+ public:
+
+  template<typename ConnectivityViewType>
+  SimdConnectedItemIndexT(const ConnectivityViewType& view,const SimdItemT<ItemType1>& simd_item,Int32 index)
+  {
+    for( Integer i=0; i<SimdIndexType::Length; ++i )
+      m_local_ids[i] = view.itemId(typename ItemType1::LocalIdType(simd_item.localId(i)),index).localId();
+  }
+
+ public:
+
+  //! Liste des numéros locaux des entités connectées
+  const SimdIndexType& ARCANE_RESTRICT simdLocalIds() const { return m_local_ids; }
+
+  //! Numéro local de l'entité connectée pour la composante \a index
+  Int32 localId(Int32 index) const { return m_local_ids[index]; }
+
+  operator SimdItemIndexT<ItemType2>() const
+  {
+    return SimdItemIndexT<ItemType2>(m_local_ids);
+  }
+
+ private:
+
+  SimdIndexType m_local_ids;
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -17,6 +17,7 @@
 #include "arcane/utils/Array.h"
 #include "arcane/utils/ITraceMng.h"
 #include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/ValueConvert.h"
 
 #include "arcane/core/IPrimaryMesh.h"
 #include "arcane/core/ItemTypeId.h"
@@ -39,6 +40,8 @@ class UnstructuredMeshAllocateBuildInfo::Impl
   : m_mesh(mesh)
   {
     m_internal.m_p = this;
+    if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_UNSTRUCTURED_MESH_ALLOCATE_MULTI_THREADING", true))
+      m_use_multi_threading = (v.value() != 0);
   }
 
   void addCell(ItemTypeId type_id, Int64 cell_uid, SmallSpan<const Int64> nodes_uid)
@@ -55,6 +58,7 @@ class UnstructuredMeshAllocateBuildInfo::Impl
   Int32 m_mesh_dimension = -1;
   UniqueArray<Int64> m_cells_infos;
   Int32 m_nb_cell = 0;
+  bool m_use_multi_threading = false;
   UnstructuredMeshAllocateBuildInfoInternal m_internal;
 };
 
@@ -88,6 +92,12 @@ nbCell() const
   return m_p->m_nb_cell;
 }
 
+bool UnstructuredMeshAllocateBuildInfoInternal::
+isUseMultiThreading() const
+{
+  return m_p->m_use_multi_threading;
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -130,6 +140,15 @@ addCell(ItemTypeId type_id, Int64 cell_uid, SmallSpan<const Int64> nodes_uid)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void UnstructuredMeshAllocateBuildInfo::
+setUseMultiThreading(bool v)
+{
+  m_p->m_use_multi_threading = v;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void UnstructuredMeshAllocateBuildInfo::
 allocateMesh()
 {
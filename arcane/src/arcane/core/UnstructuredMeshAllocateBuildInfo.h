@@ -76,6 +76,19 @@ class ARCANE_CORE_EXPORT UnstructuredMeshAllocateBuildInfo
   //! Ajoute une maille au maillage
   void addCell(ItemTypeId type_id, Int64 cell_uid, SmallSpan<const Int64> nodes_uid);
 
+  /*!
+   * \brief Indique si on utilise le multi-threading pour allouer le maillage.
+   *
+   * Si vrai et si le mécanisme des tâches est actif, la détermination des
+   * faces lors de l'appel à allocateMesh() est faite en parallèle.
+   * Le maillage obtenu est identique à celui obtenu sans multi-threading.
+   *
+   * La valeur par défaut est celle de la variable d'environnement
+   * ARCANE_UNSTRUCTURED_MESH_ALLOCATE_MULTI_THREADING si elle est
+   * positionnée et \a false sinon.
+   */
+  void setUseMultiThreading(bool v);
+
   /*!
    * \brief Alloue le maillage avec les mailles ajoutées lors de l'appel à addCell().
    *
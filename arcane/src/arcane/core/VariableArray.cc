@@ -499,8 +499,34 @@ compact(Int32ConstArrayView new_to_old_ids)
     return;
   }
 
-  UniqueArray<T> old_value(constValueView());
   Integer new_size = new_to_old_ids.size();
+
+  // Si les seules entités déplacées proviennent de la fin de la numérotation
+  // (cas du compactage incrémental), on peut faire la copie sur place et
+  // ne recopier que les valeurs des entités déplacées.
+  {
+    bool is_in_place = true;
+    for( Integer i=0; i<new_size; ++i ){
+      Int32 old_id = new_to_old_ids[i];
+      if (old_id!=i && old_id<new_size){
+        is_in_place = false;
+        break;
+      }
+    }
+    if (is_in_place){
+      ArrayView<T> current_value = m_value->view();
+      for( Integer i=0; i<new_size; ++i ){
+        Int32 old_id = new_to_old_ids[i];
+        if (old_id!=i)
+          current_value[i] = current_value[old_id];
+      }
+      m_value->resize(new_size);
+      syncReferences();
+      return;
+    }
+  }
+
+  UniqueArray<T> old_value(constValueView());
   m_value->resize(new_size);
   ArrayView<T> current_value = m_value->view();
   if (arcaneIsCheck()){
@@ -322,6 +322,22 @@ class ItemVariableRealNScalarOutViewT
     return SimdDirectSetter<DataType>(m_values+simd_item.baseLocalId());
   }
 
+  /*!
+   * \brief Ajoute vectoriellement \a v aux valeurs des entités de \a simd_item.
+   *
+   * Seules les \a nb_valid premières composantes sont prises en compte.
+   * Plusieurs composantes de \a simd_item peuvent référencer la même entité,
+   * ce qui permet par exemple d'accumuler aux noeuds des valeurs calculées
+   * aux mailles via SimdConnectedItemIndexT.
+   *
+   * Cette méthode n'est disponible que pour les variables de type Real3.
+   */
+  void simdAdd(SimdItemIndexT<ItemType> simd_item,Integer nb_valid,
+               const typename SimdTypeTraits<DataType>::SimdType& v) const
+  {
+    v.scatterAdd(m_values,simd_item.simdLocalIds(),nb_valid);
+  }
+
   //! Opérateur d'accès pour l'entité \a item
   Accessor operator[](ItemIndexType item) const
   {
@@ -88,6 +88,18 @@ class ARCANE_CORE_EXPORT IItemFamilyInternal
 
   virtual void addSourceConnectivity(IIncrementalItemSourceConnectivity* connectivity) = 0;
   virtual void addTargetConnectivity(IIncrementalItemTargetConnectivity* connectivity) = 0;
+
+  /*!
+   * \brief Échange la fonction de tri des entités.
+   *
+   * Positionne \a sort_function, qui ne doit pas être nul, comme fonction
+   * de tri et retourne la fonction précédente. Contrairement à
+   * IItemFamily::setItemSortFunction(), aucune des deux fonctions n'est
+   * détruite par la famille : l'appelant reste propriétaire de
+   * \a sort_function et devient propriétaire de la valeur retournée
+   * jusqu'à ce qu'il la remette en place avec cette même méthode.
+   */
+  virtual IItemInternalSortFunction* swapItemSortFunction(IItemInternalSortFunction* sort_function) = 0;
 };
 
 /*---------------------------------------------------------------------------*/
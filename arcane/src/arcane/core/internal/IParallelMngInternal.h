@@ -50,9 +50,19 @@ class ARCANE_CORE_EXPORT IParallelMngInternal
    */
   virtual bool isAcceleratorAware() const = 0;
 
+  /*!
+   * \brief Indique si les sommes de réels sont reproductibles.
+   *
+   * \sa ParallelMngUtils::setReproducibleReduceSum().
+   */
+  virtual bool isReproducibleReduceSum() const = 0;
+
  public:
 
   virtual void setDefaultRunner(Runner* runner) = 0;
+
+  //! Active ou désactive le mode de somme reproductible pour les réels
+  virtual void setReproducibleReduceSum(bool v) = 0;
 };
 
 /*---------------------------------------------------------------------------*/
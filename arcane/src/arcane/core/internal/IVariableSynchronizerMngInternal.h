@@ -15,6 +15,8 @@
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+#include "arcane/utils/Event.h"
+
 #include "arcane/core/ArcaneTypes.h"
 
 /*---------------------------------------------------------------------------*/
@@ -24,6 +26,29 @@ namespace Arcane
 {
 class MemoryBuffer;
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Informations de profilage d'une synchronisation.
+ */
+class ARCANE_CORE_EXPORT VariableSynchronizeProfilingInfo
+{
+ public:
+
+  //! Temps (en seconde) total de la synchronisation
+  Real m_elapsed_time = 0.0;
+  //! Temps (en seconde) passé dans les recopies entre les variables et les buffers
+  Real m_copy_time = 0.0;
+  //! Taille totale (en octet) des messages envoyés
+  Int64 m_send_size = 0;
+  //! Taille totale (en octet) des messages reçus
+  Int64 m_receive_size = 0;
+  //! Taille (en octet) du plus gros message envoyé à un rang voisin
+  Int64 m_max_send_message_size = 0;
+  //! Nombre de rangs voisins
+  Int32 m_nb_neighbour_rank = 0;
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -39,6 +64,83 @@ class ARCANE_CORE_EXPORT IVariableSynchronizerMngInternal
 
   virtual Ref<MemoryBuffer> createSynchronizeBuffer(IMemoryAllocator* allocator) = 0;
   virtual void releaseSynchronizeBuffer(IMemoryAllocator* allocator,MemoryBuffer* v) = 0;
+
+  /*!
+   * \brief Identifiant de la synchronisation par différence pour \a var.
+   *
+   * Retourne 0 si la synchronisation par différence n'est pas active pour \a var.
+   * L'identifiant change à chaque activation, ce qui permet aux synchroniseurs
+   * d'invalider les informations qu'ils conservent pour \a var.
+   */
+  virtual Int64 deltaSynchronizationId(IVariable* var) const = 0;
+
+  //! Ajoute les statistiques d'une synchronisation par différence
+  virtual void addDeltaSynchronizeStats(Int64 nb_sparse_message, Int64 nb_dense_message,
+                                        Int64 sent_size, Int64 full_size) = 0;
+
+  /*!
+   * \brief Évènement envoyé lorsque la synchronisation par différence
+   * n'est plus utilisée pour une variable.
+   *
+   * C'est le cas lorsque le mode est désactivé ou lorsque la variable est
+   * détruite. Les synchroniseurs doivent alors libérer les valeurs qu'ils
+   * conservent pour cette variable.
+   */
+  virtual EventObservable<IVariable*>& onDeltaSynchronizationReleased() = 0;
+
+  /*!
+   * \brief Débute une phase pendant laquelle \a nb_task tâches concurrentes
+   * peuvent ajouter des synchronisations différées.
+   *
+   * Pendant cette phase, les variables ajoutées via
+   * IVariableSynchronizerMng::addDeferredSynchronization() depuis la tâche
+   * d'indice \a i (voir enterConcurrentDeferredTask()) sont conservées dans une
+   * liste propre à cette tâche. Les variables ajoutées depuis un thread qui
+   * n'est associé à aucune tâche sont conservées dans une liste protégée
+   * par un verrou.
+   *
+   * L'ordre d'exécution des tâches pouvant être différent sur chaque rang,
+   * endConcurrentDeferredSynchronizations() fusionne ces listes dans un
+   * ordre indépendant de l'exécution: par indice de tâche puis, pour une
+   * tâche, par nom complet de variable.
+   */
+  virtual void beginConcurrentDeferredSynchronizations(Int32 nb_task) = 0;
+
+  //! Termine la phase débutée par beginConcurrentDeferredSynchronizations().
+  virtual void endConcurrentDeferredSynchronizations() = 0;
+
+  /*!
+   * \brief Associe le thread courant à la tâche d'indice \a task_index.
+   *
+   * Chaque appel doit être suivi d'un appel à exitConcurrentDeferredTask()
+   * depuis le même thread. Les appels peuvent être imbriqués.
+   */
+  virtual void enterConcurrentDeferredTask(Int32 task_index) = 0;
+
+  //! Termine l'association effectuée par enterConcurrentDeferredTask().
+  virtual void exitConcurrentDeferredTask() = 0;
+
+  /*!
+   * \brief Ajoute le choix effectué par la sélection automatique de l'implémentation.
+   *
+   * \a size_class est la classe de taille des données (logarithme en base 2
+   * de la taille en octet d'une entité), \a name le nom de l'implémentation
+   * choisie et \a time le temps mesuré pour cette implémentation.
+   */
+  virtual void addAutoTuneSelection(Int32 size_class, const String& name, Real time) = 0;
+
+  //! Indique si le profilage des synchronisations est actif
+  virtual bool isProfilingEnabled() const = 0;
+
+  /*!
+   * \brief Ajoute les informations de profilage d'une synchronisation.
+   *
+   * \a var_syncer est le synchroniseur utilisé et \a vars la liste des variables
+   * synchronisées.
+   */
+  virtual void addSynchronizeProfilingInfo(IVariableSynchronizer* var_syncer,
+                                           ConstArrayView<IVariable*> vars,
+                                           const VariableSynchronizeProfilingInfo& info) = 0;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -27,6 +27,7 @@
 namespace Arcane
 {
 class ItemGroupImpl;
+class ItemGroupComputeFunctor;
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -140,6 +141,14 @@ class ItemGroupInternal
   bool m_transaction_mode = false; //!< Vrai si le groupe est en mode de transaction directe
   bool m_is_local_to_sub_domain = false; //!< Vrai si le groupe est local au sous-domaine
   IFunctor* m_compute_functor = nullptr; //!< Fonction de calcul du groupe
+  //! Fonction de calcul si le groupe est mis à jour de manière incrémentale (nullptr sinon)
+  ItemGroupComputeFunctor* m_incremental_functor = nullptr;
+  //! Vrai si les sous-groupes calculés peuvent être mis à jour de manière incrémentale
+  bool m_use_incremental_update = false;
+  //! Vrai si on vérifie les mises à jour incrémentales après un changement de propriétaire
+  bool m_check_incremental_update = false;
+  Int64 m_nb_recompute = 0; //!< Nombre de recalculs complets via \a m_compute_functor
+  Int64 m_nb_incremental_update = 0; //!< Nombre de mises à jour incrémentales
   bool m_is_all_items = false; //!< Indique s'il s'agit du groupe de toutes les entités
 
   SharedPtrT<GroupIndexTable> m_group_index_table; //!< Table de hachage du local id des items vers leur position en enumeration
@@ -36,6 +36,7 @@ class ARCANE_CORE_EXPORT UnstructuredMeshAllocateBuildInfoInternal
   ConstArrayView<Int64> cellsInfos() const;
   Int32 meshDimension() const;
   Int32 nbCell() const;
+  bool isUseMultiThreading() const;
 
  private:
 
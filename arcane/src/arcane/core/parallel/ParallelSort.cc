@@ -0,0 +1,55 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* ParallelSort.cc                                             (C) 2000-2023 */
+/*                                                                           */
+/* Choix de l'algorithme de tri parallèle.                                   */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/core/parallel/ParallelSort.h"
+
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/String.h"
+#include "arcane/utils/FatalErrorException.h"
+
+#include "arcane/core/IParallelMng.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Parallel
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+eParallelSortAlgorithm
+getDefaultParallelSortAlgorithm(IParallelMng* pm)
+{
+  String s = platform::getEnvironmentVariable("ARCANE_PARALLEL_SORT_ALGORITHM");
+  if (!s.null()) {
+    if (s == "Bitonic")
+      return eParallelSortAlgorithm::Bitonic;
+    if (s == "Sample")
+      return eParallelSortAlgorithm::Sample;
+    ARCANE_FATAL("Invalid value '{0}' for ARCANE_PARALLEL_SORT_ALGORITHM. Valid values are 'Bitonic' or 'Sample'", s);
+  }
+  // Le tri bitonique nécessite O(log²(P)) étapes d'échange et devient
+  // pénalisant pour les grands nombres de rangs.
+  if (pm->commSize() >= 128)
+    return eParallelSortAlgorithm::Sample;
+  return eParallelSortAlgorithm::Bitonic;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Parallel
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,85 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* ParallelSort.h                                              (C) 2000-2023 */
+/*                                                                           */
+/* Choix de l'algorithme de tri parallèle.                                   */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_CORE_PARALLEL_PARALLELSORT_H
+#define ARCANE_CORE_PARALLEL_PARALLELSORT_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/Array.h"
+
+#include "arcane/core/parallel/BitonicSortT.H"
+#include "arcane/core/parallel/SampleSortT.H"
+
+#include <memory>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Parallel
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+//! Algorithme de tri parallèle
+enum class eParallelSortAlgorithm
+{
+  //! Tri bitonique (BitonicSort)
+  Bitonic,
+  //! Tri par échantillonnage (SampleSort)
+  Sample
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Algorithme de tri parallèle à utiliser par défaut pour \a pm.
+ *
+ * Le tri par échantillonnage est utilisé si le nombre de rangs de \a pm
+ * est supérieur ou égal à 128 et le tri bitonique sinon. Il est possible
+ * d'imposer l'algorithme via la variable d'environnement
+ * ARCANE_PARALLEL_SORT_ALGORITHM dont la valeur peut être 'Bitonic' ou 'Sample'.
+ */
+extern "C++" ARCANE_CORE_EXPORT eParallelSortAlgorithm
+getDefaultParallelSortAlgorithm(IParallelMng* pm);
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Créé une instance de tri parallèle utilisant l'algorithme \a algorithm.
+ *
+ * Si \a need_index_and_rank est faux, les rangs et indices d'origine des
+ * clés ne sont pas conservés, ce qui réduit la taille des messages.
+ */
+template <typename KeyType, typename KeyTypeTraits = BitonicSortDefaultTraits<KeyType>>
+std::unique_ptr<IParallelSort<KeyType>>
+createParallelSort(IParallelMng* pm, eParallelSortAlgorithm algorithm, bool need_index_and_rank)
+{
+  if (algorithm == eParallelSortAlgorithm::Sample) {
+    auto* sorter = new SampleSort<KeyType, KeyTypeTraits>(pm);
+    sorter->setNeedIndexAndRank(need_index_and_rank);
+    return std::unique_ptr<IParallelSort<KeyType>>(sorter);
+  }
+  auto* sorter = new BitonicSort<KeyType, KeyTypeTraits>(pm);
+  sorter->setNeedIndexAndRank(need_index_and_rank);
+  return std::unique_ptr<IParallelSort<KeyType>>(sorter);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Parallel
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
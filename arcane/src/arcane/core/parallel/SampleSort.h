@@ -0,0 +1,137 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* SampleSort.h                                                (C) 2000-2023 */
+/*                                                                           */
+/* Algorithme de tri parallèle par échantillonnage.                          */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_CORE_PARALLEL_SAMPLESORT_H
+#define ARCANE_CORE_PARALLEL_SAMPLESORT_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/TraceAccessor.h"
+#include "arcane/utils/UniqueArray.h"
+
+#include "arcane/core/IParallelSort.h"
+#include "arcane/core/parallel/BitonicSort.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Parallel
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Algorithme de tri parallèle par échantillonnage (sample sort).
+ *
+ * Cette classe a la même interface que BitonicSort : après l'appel à
+ * sort(), les clés sont triées par ordre croissant en commençant par le
+ * rang 0, puis le rang 1 et ainsi de suite.
+ * Les rangs et indices d'origine de chaque clé sont disponibles via
+ * keyRanks() et keyIndexes().
+ *
+ * L'algorithme est le suivant :
+ * 1. chaque rang trie localement ses clés,
+ * 2. chaque rang choisit régulièrement nbSamplePerRank() clés dans
+ *    sa liste triée et ces échantillons sont envoyés à tous les rangs,
+ * 3. chaque rang trie l'ensemble des échantillons et en déduit les
+ *    (P-1) séparateurs qui définissent l'intervalle de clés de
+ *    chaque rang,
+ * 4. chaque rang envoie ses clés au rang qui possède leur intervalle
+ *    via un unique allToAllVariable(),
+ * 5. chaque rang fusionne les listes triées reçues.
+ *
+ * Contrairement au tri bitonique qui nécessite O(log²(P)) étapes d'échange
+ * pour P rangs, cet algorithme n'utilise qu'un nombre constant d'opérations
+ * collectives. Il est donc adapté aux grands nombres de rangs.
+ * Par contre, le nombre de clés par rang après le tri n'est pas exactement
+ * le même sur tous les rangs. Il dépend de la qualité des séparateurs et
+ * les clés égales à un séparateur sont toutes sur le même rang. Comme pour
+ * BitonicSort, si certains rangs n'ont pas de clés après le tri, ce sont
+ * les derniers rangs.
+ *
+ * Les clés sont échangées sous forme d'octets. Le type \a KeyType doit
+ * donc pouvoir être copié par recopie mémoire. Seule la méthode
+ * KeyTypeTraits::compareLess() est utilisée. Il est donc possible
+ * d'utiliser les mêmes classes de caractéristiques que pour BitonicSort.
+ */
+template <typename KeyType, typename KeyTypeTraits = BitonicSortDefaultTraits<KeyType>>
+class SampleSort
+: public TraceAccessor
+, public IParallelSort<KeyType>
+{
+ public:
+
+  explicit SampleSort(IParallelMng* parallel_mng);
+
+ public:
+
+  /*!
+   * \brief Trie en parallèle les éléments de \a keys sur tous les rangs.
+   *
+   * Cette opération est collective.
+   */
+  void sort(ConstArrayView<KeyType> keys) override;
+
+  //! Après un tri, retourne la liste des éléments de ce rang.
+  ConstArrayView<KeyType> keys() const override { return m_keys; }
+
+  //! Après un tri, retourne le tableau des rangs d'origine des éléments de keys().
+  Int32ConstArrayView keyRanks() const override { return m_key_ranks; }
+
+  //! Après un tri, retourne le tableau des indices dans la liste d'origine des éléments de keys().
+  Int32ConstArrayView keyIndexes() const override { return m_key_indexes; }
+
+ public:
+
+  void setNeedIndexAndRank(bool want_index_and_rank)
+  {
+    m_want_index_and_rank = want_index_and_rank;
+  }
+
+  /*!
+   * \brief Positionne le nombre d'échantillons choisis par rang.
+   *
+   * Plus ce nombre est grand, plus la répartition des clés entre les rangs
+   * est équilibrée mais plus le volume des échantillons est important.
+   * La valeur doit être la même sur tous les rangs.
+   */
+  void setNbSamplePerRank(Int32 v) { m_nb_sample_per_rank = v; }
+  Int32 nbSamplePerRank() const { return m_nb_sample_per_rank; }
+
+ private:
+
+  //! Clés de ce rang après le tri
+  UniqueArray<KeyType> m_keys;
+  //! Tableau contenant le rang du processeur d'origine de la clé
+  UniqueArray<Int32> m_key_ranks;
+  //! Tableau contenant l'indice de la clé dans le processeur d'origine
+  UniqueArray<Int32> m_key_indexes;
+  IParallelMng* m_parallel_mng = nullptr;
+  //! Indique si on souhaite les infos sur les rangs et index
+  bool m_want_index_and_rank = true;
+  Int32 m_nb_sample_per_rank = 64;
+
+ private:
+
+  void _localSort(ConstArrayView<KeyType> keys);
+  void _computeSplitters(UniqueArray<KeyType>& splitters);
+  void _exchange(ConstArrayView<KeyType> splitters);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Parallel
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
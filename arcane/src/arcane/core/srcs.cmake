@@ -262,6 +262,7 @@ set(ARCANE_ORIGINAL_SOURCES
   IVariableParallelOperation.h
   IVariableSynchronizer.h
   IVariableSynchronizerMng.h
+  IVariableSynchronizerRequest.h
   IVariableUtilities.h
   IVariableWriter.h
   IVerifierService.h
@@ -731,6 +732,10 @@ set(ARCANE_ORIGINAL_SOURCES
   parallel/IRequestList.h
   parallel/IStat.h
   parallel/MultiReduce.cc
+  parallel/ParallelSort.cc
+  parallel/ParallelSort.h
+  parallel/SampleSort.h
+  parallel/SampleSortT.H
   parallel/Stat.cc
   parallel/VariableParallelOperationBase.cc
   parallel/VariableParallelOperationBase.h
@@ -0,0 +1,326 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* AutoTuneDataSynchronizeImplementation.cc                    (C) 2000-2023 */
+/*                                                                           */
+/* Choix automatique de l'implémentation de la synchronisation.              */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/impl/internal/AutoTuneDataSynchronizeImplementation.h"
+
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/ITraceMng.h"
+#include "arcane/utils/MemoryView.h"
+
+#include "arcane/core/IParallelMng.h"
+#include "arcane/core/internal/IVariableSynchronizerMngInternal.h"
+
+#include "arcane/impl/IDataSynchronizeBuffer.h"
+#include "arcane/impl/DataSynchronizeInfo.h"
+
+#include <map>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Implémentation choisissant automatiquement la synchronisation la plus rapide.
+ *
+ * Comme toutes les implémentations candidates ne sont pas forcément
+ * compatibles entre elles (certaines utilisent des opérations collectives),
+ * il est indispensable que tous les rangs utilisent la même implémentation
+ * pour une synchronisation donnée. C'est le cas car les synchronisations
+ * sont collectives et effectuées dans le même ordre sur tous les rangs:
+ * le numéro de l'implémentation utilisée ne dépend que du nombre d'appels
+ * et le choix final est effectué après une réduction sur tous les rangs.
+ *
+ * Une même instance peut synchroniser des données de tailles différentes
+ * (par exemple des variables scalaires et des variables tableaux).
+ * Les mesures et le choix sont donc effectués séparément pour chaque
+ * classe de taille.
+ */
+class AutoTuneDataSynchronizeImplementation
+: public AbstractDataSynchronizeImplementation
+{
+ public:
+
+  class Factory;
+  explicit AutoTuneDataSynchronizeImplementation(Factory* f);
+
+ public:
+
+  void compute() override;
+  void beginSynchronize(IDataSynchronizeBuffer* buf) override;
+  void endSynchronize(IDataSynchronizeBuffer* buf) override;
+
+ private:
+
+  //! État de la sélection pour une classe de taille
+  struct SizeClassState
+  {
+    //! Indice de l'implémentation choisie (-1 si pas encore choisie)
+    Int32 selected_index = -1;
+    //! Nombre de synchronisations effectuées pendant la phase de mesure
+    Int32 nb_trial_call = 0;
+    //! Temps minimum mesuré pour chaque implémentation
+    UniqueArray<Real> min_times;
+  };
+
+ private:
+
+  Factory* m_factory = nullptr;
+  IParallelMng* m_parallel_mng = nullptr;
+  UniqueArray<Ref<IDataSynchronizeImplementation>> m_implementations;
+  //! Informations de synchronisation positionnées sur les implémentations candidates
+  DataSynchronizeInfo* m_candidate_sync_info = nullptr;
+  //! État de la sélection pour chaque classe de taille
+  std::map<Int32, SizeClassState> m_size_class_states;
+  //! Classe de taille de la synchronisation en cours
+  Int32 m_current_size_class = -1;
+  //! Indice de l'implémentation utilisée pour la synchronisation en cours
+  Int32 m_current_index = -1;
+  //! Temps passé dans la synchronisation en cours
+  Real m_current_time = 0.0;
+
+ private:
+
+  void _checkCandidates();
+  static Int32 _computeSizeClass(IDataSynchronizeBuffer* buf);
+  void _selectBest(Int32 size_class, SizeClassState& state);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class AutoTuneDataSynchronizeImplementation::Factory
+: public IDataSynchronizeImplementationFactory
+{
+ public:
+
+  Factory(IParallelMng* pm, IVariableSynchronizerMngInternal* sync_mng,
+          ConstArrayView<DataSynchronizeImplementationCandidate> candidates, Int32 nb_trial)
+  : m_parallel_mng(pm)
+  , m_synchronizer_mng(sync_mng)
+  , m_candidates(candidates)
+  , m_nb_trial(nb_trial)
+  {
+    if (m_candidates.empty())
+      ARCANE_FATAL("No candidate implementation for automatic selection");
+    if (m_nb_trial <= 0)
+      m_nb_trial = 1;
+  }
+
+  Ref<IDataSynchronizeImplementation> createInstance() override
+  {
+    auto* x = new AutoTuneDataSynchronizeImplementation(this);
+    return makeRef<IDataSynchronizeImplementation>(x);
+  }
+
+ public:
+
+  IParallelMng* m_parallel_mng = nullptr;
+  IVariableSynchronizerMngInternal* m_synchronizer_mng = nullptr;
+  UniqueArray<DataSynchronizeImplementationCandidate> m_candidates;
+  Int32 m_nb_trial = 3;
+  //! Implémentation choisie pour chaque classe de taille
+  std::map<Int32, Int32> m_selected_indexes;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateAutoTuneVariableSynchronizerFactory(IParallelMng* pm, IVariableSynchronizerMngInternal* sync_mng,
+                                                ConstArrayView<DataSynchronizeImplementationCandidate> candidates,
+                                                Int32 nb_trial)
+{
+  auto* x = new AutoTuneDataSynchronizeImplementation::Factory(pm, sync_mng, candidates, nb_trial);
+  return makeRef<IDataSynchronizeImplementationFactory>(x);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+AutoTuneDataSynchronizeImplementation::
+AutoTuneDataSynchronizeImplementation(Factory* f)
+: m_factory(f)
+, m_parallel_mng(f->m_parallel_mng)
+{
+  for (const auto& c : f->m_candidates)
+    m_implementations.add(c.factory()->createInstance());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Recommence les mesures.
+ *
+ * Les informations de synchronisation ont changé (par exemple après un
+ * repartitionnement) et le choix précédent n'est donc plus forcément
+ * le meilleur.
+ */
+void AutoTuneDataSynchronizeImplementation::
+compute()
+{
+  if (m_current_index >= 0)
+    ARCANE_FATAL("Can not call compute() during a synchronization");
+  _checkCandidates();
+  for (auto& impl : m_implementations)
+    impl->compute();
+  m_factory->m_selected_indexes.clear();
+  m_size_class_states.clear();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AutoTuneDataSynchronizeImplementation::
+beginSynchronize(IDataSynchronizeBuffer* buf)
+{
+  if (m_current_index >= 0)
+    ARCANE_FATAL("beginSynchronize() has already been called");
+  _checkCandidates();
+
+  m_current_size_class = _computeSizeClass(buf);
+  SizeClassState& state = m_size_class_states[m_current_size_class];
+  if (state.selected_index < 0) {
+    // Regarde si une autre instance a déjà effectué le choix pour cette classe.
+    auto x = m_factory->m_selected_indexes.find(m_current_size_class);
+    if (x != m_factory->m_selected_indexes.end())
+      state.selected_index = x->second;
+  }
+
+  if (state.selected_index >= 0) {
+    m_current_index = state.selected_index;
+    m_current_time = -1.0;
+    m_implementations[m_current_index]->beginSynchronize(buf);
+    return;
+  }
+
+  // Phase de mesure: utilise les implémentations à tour de rôle.
+  if (state.min_times.empty())
+    state.min_times.resize(m_implementations.size());
+  m_current_index = state.nb_trial_call % m_implementations.size();
+  Real begin_time = platform::getRealTime();
+  m_implementations[m_current_index]->beginSynchronize(buf);
+  m_current_time = platform::getRealTime() - begin_time;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AutoTuneDataSynchronizeImplementation::
+endSynchronize(IDataSynchronizeBuffer* buf)
+{
+  if (m_current_index < 0)
+    ARCANE_FATAL("No pending synchronize(). You need to call beginSynchronize() before");
+
+  Int32 index = m_current_index;
+  m_current_index = -1;
+  // Si le temps est négatif, l'implémentation est déjà choisie.
+  if (m_current_time < 0.0) {
+    m_implementations[index]->endSynchronize(buf);
+    return;
+  }
+
+  Real begin_time = platform::getRealTime();
+  m_implementations[index]->endSynchronize(buf);
+  Real total_time = m_current_time + (platform::getRealTime() - begin_time);
+
+  // Conserve le temps minimum pour éliminer l'effet des initialisations
+  // effectuées lors de la première utilisation d'une implémentation.
+  SizeClassState& state = m_size_class_states[m_current_size_class];
+  Int32 trial = state.nb_trial_call / m_implementations.size();
+  if (trial == 0 || total_time < state.min_times[index])
+    state.min_times[index] = total_time;
+
+  ++state.nb_trial_call;
+  if (state.nb_trial_call == (m_factory->m_nb_trial * m_implementations.size()))
+    _selectBest(m_current_size_class, state);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Positionne les informations de synchronisation sur les candidats.
+ */
+void AutoTuneDataSynchronizeImplementation::
+_checkCandidates()
+{
+  DataSynchronizeInfo* sync_info = _syncInfo();
+  if (sync_info == m_candidate_sync_info)
+    return;
+  for (auto& impl : m_implementations)
+    impl->setDataSynchronizeInfo(sync_info);
+  m_candidate_sync_info = sync_info;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule la classe de taille de la donnée de \a buf.
+ *
+ * La classe est le logarithme en base 2 de la taille en octet d'une
+ * entité, arrondie à la puissance de 2 supérieure. La taille d'une entité
+ * est celle du type de donnée des buffers. Elle est connue même si le
+ * rang n'a pas d'entités à envoyer ou à recevoir et elle est identique
+ * sur tous les rangs pour une synchronisation donnée. Il n'y a donc pas
+ * besoin d'opération collective et la classe peut être calculée à chaque
+ * appel.
+ */
+Int32 AutoTuneDataSynchronizeImplementation::
+_computeSizeClass(IDataSynchronizeBuffer* buf)
+{
+  Int64 item_size = buf->globalSendBuffer().datatypeSize();
+  Int32 size_class = 0;
+  while ((Int64(1) << size_class) < item_size)
+    ++size_class;
+  return size_class;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Choisit l'implémentation la plus rapide.
+ *
+ * Pour chaque implémentation, on prend le maximum sur l'ensemble des rangs
+ * du temps minimum mesuré. Le choix est donc identique sur tous les rangs.
+ */
+void AutoTuneDataSynchronizeImplementation::
+_selectBest(Int32 size_class, SizeClassState& state)
+{
+  UniqueArray<Real>& min_times = state.min_times;
+  m_parallel_mng->reduce(Parallel::ReduceMax, min_times.view());
+  Int32 best_index = 0;
+  for (Int32 i = 1, n = min_times.size(); i < n; ++i)
+    if (min_times[i] < min_times[best_index])
+      best_index = i;
+  state.selected_index = best_index;
+  m_factory->m_selected_indexes[size_class] = best_index;
+
+  const String& name = m_factory->m_candidates[best_index].name();
+  ITraceMng* tm = m_parallel_mng->traceMng();
+  tm->info(4) << "Synchronize auto-tuning: size_class=" << size_class
+              << " selected=" << name << " times=" << min_times;
+  if (m_factory->m_synchronizer_mng)
+    m_factory->m_synchronizer_mng->addAutoTuneSelection(size_class, name, min_times[best_index]);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
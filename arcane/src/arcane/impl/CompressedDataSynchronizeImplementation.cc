@@ -0,0 +1,326 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* CompressedDataSynchronizeImplementation.cc                  (C) 2000-2023 */
+/*                                                                           */
+/* Synchronisation avec compression des messages.                            */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/IDataCompressor.h"
+#include "arcane/utils/ITraceMng.h"
+#include "arcane/utils/MemoryView.h"
+#include "arcane/utils/ValueConvert.h"
+
+#include "arcane/core/IParallelMng.h"
+#include "arcane/core/parallel/IStat.h"
+
+#include "arcane/impl/IDataSynchronizeBuffer.h"
+#include "arcane/impl/IDataSynchronizeImplementation.h"
+
+#include <cstring>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Implémentation de la synchronisation avec compression des messages.
+ *
+ * Les buffers d'envoi de chaque rang dont la taille est supérieure à un seuil
+ * sont compressés via un IDataCompressor avant d'être envoyés. Le récepteur
+ * décompresse le message dans le buffer de réception avant de recopier
+ * les valeurs dans la donnée.
+ *
+ * Chaque message commence par un en-tête de taille fixe (Header) qui indique
+ * la taille des données compressées. Si la compression ne permet pas de réduire
+ * la taille du message, les valeurs sont envoyées sans compression. La taille
+ * d'un message est donc toujours inférieure ou égale à la taille de l'en-tête
+ * plus celle du message non compressé, ce qui permet au récepteur de
+ * dimensionner ses buffers sans échange préalable.
+ *
+ * Pour les données dont la taille est un multiple de 4 ou 8 octets (ce qui est
+ * le cas des réels), il est possible de réorganiser les octets avant la
+ * compression pour regrouper les octets de même poids (byte shuffle). Cela
+ * améliore beaucoup le taux de compression des valeurs flottantes, dont les
+ * octets de poids fort (signe et exposant) varient peu, sans aucune perte.
+ *
+ * Les buffers doivent être accessibles depuis l'hôte.
+ */
+class CompressedDataSynchronizeImplementation
+: public AbstractDataSynchronizeImplementation
+{
+ public:
+
+  class Factory;
+  explicit CompressedDataSynchronizeImplementation(Factory* f);
+
+  //! En-tête de chaque message
+  struct Header
+  {
+    //! Taille des données compressées ou (-1) si les données ne sont pas compressées
+    Int64 m_compressed_size = -1;
+    //! Taille (en octet) des éléments si les octets ont été réorganisés, 0 sinon.
+    Int32 m_shuffle_size = 0;
+    Int32 m_padding = 0;
+  };
+  static constexpr Int64 HEADER_SIZE = sizeof(Header);
+
+ protected:
+
+  void compute() override {}
+  void beginSynchronize(IDataSynchronizeBuffer* buf) override;
+  void endSynchronize(IDataSynchronizeBuffer* buf) override;
+
+ private:
+
+  Factory* m_factory = nullptr;
+  IParallelMng* m_parallel_mng = nullptr;
+  UniqueArray<Parallel::Request> m_all_requests;
+  UniqueArray<UniqueArray<Byte>> m_send_messages;
+  UniqueArray<UniqueArray<Byte>> m_receive_messages;
+  UniqueArray<std::byte> m_work_buffer;
+
+ private:
+
+  Int32 _shuffleSize(Int32 datatype_size) const;
+  void _fillSendMessage(Span<const std::byte> values, Int32 datatype_size, Array<Byte>& message);
+  void _readReceiveMessage(Span<const Byte> message, Span<std::byte> values, Int32 rank);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class CompressedDataSynchronizeImplementation::Factory
+: public IDataSynchronizeImplementationFactory
+{
+ public:
+
+  Factory(IParallelMng* pm, Ref<IDataCompressor> compressor)
+  : m_parallel_mng(pm)
+  , m_compressor(compressor)
+  {
+    m_min_compress_size = compressor->minCompressSize();
+    if (auto v = Convert::Type<Int64>::tryParseFromEnvironment("ARCANE_SYNCHRONIZE_COMPRESS_MIN_SIZE", true))
+      m_min_compress_size = v.value();
+    if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_SYNCHRONIZE_COMPRESS_SHUFFLE", true))
+      m_use_shuffle = (v.value() != 0);
+  }
+
+  Ref<IDataSynchronizeImplementation> createInstance() override
+  {
+    auto* x = new CompressedDataSynchronizeImplementation(this);
+    return makeRef<IDataSynchronizeImplementation>(x);
+  }
+
+ public:
+
+  IParallelMng* m_parallel_mng = nullptr;
+  Ref<IDataCompressor> m_compressor;
+  //! Taille minimale (en octet) d'un message pour qu'il soit compressé
+  Int64 m_min_compress_size = 0;
+  //! Indique si on réorganise les octets avant la compression
+  bool m_use_shuffle = true;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+CompressedDataSynchronizeImplementation::
+CompressedDataSynchronizeImplementation(Factory* f)
+: m_factory(f)
+, m_parallel_mng(f->m_parallel_mng)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateCompressedVariableSynchronizerFactory(IParallelMng* pm, Ref<IDataCompressor> compressor)
+{
+  ARCANE_CHECK_POINTER(compressor.get());
+  auto* x = new CompressedDataSynchronizeImplementation::Factory(pm, compressor);
+  return makeRef<IDataSynchronizeImplementationFactory>(x);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CompressedDataSynchronizeImplementation::
+beginSynchronize(IDataSynchronizeBuffer* vs_buf)
+{
+  ARCANE_CHECK_POINTER(vs_buf);
+  IParallelMng* pm = m_parallel_mng;
+  Int32 nb_message = vs_buf->nbRank();
+
+  m_send_messages.resize(nb_message);
+  m_receive_messages.resize(nb_message);
+
+  // Poste les réceptions. La taille maximale d'un message est celle
+  // du message non compressé plus l'en-tête.
+  for (Integer i = 0; i < nb_message; ++i) {
+    Int64 size = vs_buf->receiveBuffer(i).bytes().size();
+    if (size == 0)
+      continue;
+    UniqueArray<Byte>& message = m_receive_messages[i];
+    message.resize(size + HEADER_SIZE);
+    m_all_requests.add(pm->recv(message.view(), vs_buf->targetRank(i), false));
+  }
+
+  vs_buf->copyAllSend();
+
+  Int64 total_size = 0;
+  Int64 total_compressed_size = 0;
+  for (Integer i = 0; i < nb_message; ++i) {
+    MutableMemoryView send_view = vs_buf->sendBuffer(i);
+    Span<const std::byte> values = send_view.bytes();
+    if (values.empty())
+      continue;
+    UniqueArray<Byte>& message = m_send_messages[i];
+    _fillSendMessage(values, send_view.datatypeSize(), message);
+    total_size += values.size();
+    total_compressed_size += message.largeSize();
+    m_all_requests.add(pm->send(message.constView(), vs_buf->targetRank(i), false));
+  }
+
+  if (total_size > 0) {
+    pm->stat()->add("SyncCompressRaw", 0.0, total_size);
+    pm->stat()->add("SyncCompressed", 0.0, total_compressed_size);
+    pm->traceMng()->info(5) << "CompressedSynchronize raw_size=" << total_size
+                            << " compressed_size=" << total_compressed_size
+                            << " ratio=" << ((Real)total_compressed_size / (Real)total_size);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CompressedDataSynchronizeImplementation::
+endSynchronize(IDataSynchronizeBuffer* vs_buf)
+{
+  IParallelMng* pm = m_parallel_mng;
+
+  pm->waitAllRequests(m_all_requests);
+  m_all_requests.clear();
+
+  Int32 nb_message = vs_buf->nbRank();
+  for (Integer i = 0; i < nb_message; ++i) {
+    Span<std::byte> values = vs_buf->receiveBuffer(i).bytes();
+    if (values.empty())
+      continue;
+    _readReceiveMessage(m_receive_messages[i], values, vs_buf->targetRank(i));
+  }
+
+  vs_buf->copyAllReceive();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Taille des éléments pour la réorganisation des octets.
+ *
+ * Retourne 0 si on ne réorganise pas les octets.
+ */
+Int32 CompressedDataSynchronizeImplementation::
+_shuffleSize(Int32 datatype_size) const
+{
+  if (!m_factory->m_use_shuffle)
+    return 0;
+  if ((datatype_size % 8) == 0)
+    return 8;
+  if ((datatype_size % 4) == 0)
+    return 4;
+  return 0;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CompressedDataSynchronizeImplementation::
+_fillSendMessage(Span<const std::byte> values, Int32 datatype_size, Array<Byte>& message)
+{
+  const Int64 size = values.size();
+  Header header;
+  UniqueArray<std::byte> compressed_values;
+  if (size >= m_factory->m_min_compress_size) {
+    Span<const std::byte> to_compress = values;
+    Int32 shuffle_size = _shuffleSize(datatype_size);
+    if (shuffle_size != 0) {
+      // Regroupe les octets de même poids:
+      // le j-ème octet du k-ème élément est rangé à l'indice j*nb_element+k.
+      const Int64 nb_element = size / shuffle_size;
+      m_work_buffer.resize(size);
+      const std::byte* in = values.data();
+      std::byte* out = m_work_buffer.data();
+      for (Int64 k = 0; k < nb_element; ++k)
+        for (Int32 j = 0; j < shuffle_size; ++j)
+          out[j * nb_element + k] = in[k * shuffle_size + j];
+      to_compress = m_work_buffer.span();
+    }
+    m_factory->m_compressor->compress(to_compress, compressed_values);
+    // N'utilise la version compressée que si elle est plus petite.
+    if (compressed_values.largeSize() < size) {
+      header.m_compressed_size = compressed_values.largeSize();
+      header.m_shuffle_size = shuffle_size;
+    }
+  }
+
+  Int64 payload_size = (header.m_compressed_size >= 0) ? header.m_compressed_size : size;
+  message.resize(HEADER_SIZE + payload_size);
+  std::memcpy(message.data(), &header, HEADER_SIZE);
+  const std::byte* payload = (header.m_compressed_size >= 0) ? compressed_values.data() : values.data();
+  std::memcpy(message.data() + HEADER_SIZE, payload, payload_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CompressedDataSynchronizeImplementation::
+_readReceiveMessage(Span<const Byte> message, Span<std::byte> values, Int32 rank)
+{
+  const Int64 size = values.size();
+  Header header;
+  std::memcpy(&header, message.data(), HEADER_SIZE);
+  const std::byte* payload = reinterpret_cast<const std::byte*>(message.data() + HEADER_SIZE);
+
+  if (header.m_compressed_size < 0) {
+    std::memcpy(values.data(), payload, size);
+    return;
+  }
+  if (header.m_compressed_size > size)
+    ARCANE_FATAL("Bad compressed size '{0}' from rank '{1}' (max={2})",
+                 header.m_compressed_size, rank, size);
+
+  Span<const std::byte> compressed_values(payload, header.m_compressed_size);
+  const Int32 shuffle_size = header.m_shuffle_size;
+  if (shuffle_size == 0) {
+    m_factory->m_compressor->decompress(compressed_values, values);
+    return;
+  }
+  m_work_buffer.resize(size);
+  m_factory->m_compressor->decompress(compressed_values, m_work_buffer.span());
+  const Int64 nb_element = size / shuffle_size;
+  const std::byte* in = m_work_buffer.data();
+  std::byte* out = values.data();
+  for (Int64 k = 0; k < nb_element; ++k)
+    for (Int32 j = 0; j < shuffle_size; ++j)
+      out[k * shuffle_size + j] = in[j * nb_element + k];
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -14,6 +14,8 @@
 #include "arcane/impl/internal/DataSynchronizeBuffer.h"
 
 #include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/Math.h"
 #include "arcane/utils/internal/MemoryBuffer.h"
 
 #include "arcane/impl/DataSynchronizeInfo.h"
@@ -27,6 +29,29 @@
 namespace Arcane
 {
 
+namespace
+{
+  //! Ajoute à \a total_time le temps écoulé pendant la durée de vie de l'instance
+  class CopyTimeSentry
+  {
+   public:
+
+    explicit CopyTimeSentry(Real& total_time)
+    : m_total_time(total_time)
+    , m_begin_time(platform::getRealTime())
+    {}
+    ~CopyTimeSentry()
+    {
+      m_total_time += platform::getRealTime() - m_begin_time;
+    }
+
+   private:
+
+    Real& m_total_time;
+    Real m_begin_time;
+  };
+} // namespace
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -121,9 +146,28 @@ targetRank(Int32 index) const
 void DataSynchronizeBufferBase::
 barrier()
 {
+  CopyTimeSentry sentry(m_copy_time);
   m_buffer_copier->barrier();
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void DataSynchronizeBufferBase::
+fillProfilingInfo(DataSynchronizeResult& result) const
+{
+  const DataSynchronizeBufferInfoList& send_info = m_sync_info->sendInfo();
+  Int32 datatype_size = m_share_buffer_info.m_datatype_size;
+  Int64 max_message_size = 0;
+  for (Int32 i = 0; i < m_nb_rank; ++i)
+    max_message_size = math::max(max_message_size, static_cast<Int64>(send_info.nbItem(i)) * datatype_size);
+  result.setCopyTime(m_copy_time);
+  result.setSendSize(m_share_buffer_info.totalSize());
+  result.setReceiveSize(m_ghost_buffer_info.totalSize());
+  result.setMaxSendMessageSize(max_message_size);
+  result.setNbNeighbourRank(m_nb_rank);
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -134,6 +178,7 @@ void DataSynchronizeBufferBase::
 _compute(Int32 datatype_size)
 {
   m_nb_rank = m_sync_info->size();
+  m_copy_time = 0.0;
 
   m_ghost_buffer_info.m_datatype_size = datatype_size;
   m_ghost_buffer_info.m_buffer_info = &m_sync_info->receiveInfo();
@@ -189,6 +234,7 @@ _allocateBuffers(Int32 datatype_size)
 void SingleDataSynchronizeBuffer::
 copyReceiveAsync(Int32 index)
 {
+  CopyTimeSentry sentry(m_copy_time);
   m_ghost_buffer_info.checkValid();
 
   MutableMemoryView var_values = dataView();
@@ -204,6 +250,7 @@ copyReceiveAsync(Int32 index)
 void SingleDataSynchronizeBuffer::
 copySendAsync(Int32 index)
 {
+  CopyTimeSentry sentry(m_copy_time);
   m_share_buffer_info.checkValid();
 
   ConstMemoryView var_values = dataView();
@@ -284,6 +331,7 @@ prepareSynchronize(Int32 datatype_size, [[maybe_unused]] bool is_compare_sync)
 void MultiDataSynchronizeBuffer::
 copyReceiveAsync(Int32 index)
 {
+  CopyTimeSentry sentry(m_copy_time);
   IBufferCopier* copier = m_buffer_copier.get();
   m_ghost_buffer_info.checkValid();
 
@@ -308,6 +356,7 @@ copyReceiveAsync(Int32 index)
 void MultiDataSynchronizeBuffer::
 copySendAsync(Int32 index)
 {
+  CopyTimeSentry sentry(m_copy_time);
   IBufferCopier* copier = m_buffer_copier.get();
   m_ghost_buffer_info.checkValid();
 
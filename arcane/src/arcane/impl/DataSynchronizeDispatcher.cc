@@ -182,6 +182,7 @@ endSynchronize()
   if (!m_is_empty_sync) {
     m_synchronize_implementation->endSynchronize(&m_sync_buffer);
     result = m_sync_buffer.finalizeSynchronize();
+    m_sync_buffer.fillProfilingInfo(result);
   }
   m_is_in_sync = false;
   return result;
@@ -220,7 +221,7 @@ class ARCANE_IMPL_EXPORT DataSynchronizeMultiDispatcher
 
   void compute() override {}
   void setSynchronizeBuffer(Ref<MemoryBuffer>) override {}
-  void synchronize(ConstArrayView<IVariable*> vars) override;
+  DataSynchronizeResult synchronize(ConstArrayView<IVariable*> vars) override;
 
  private:
 
@@ -231,7 +232,7 @@ class ARCANE_IMPL_EXPORT DataSynchronizeMultiDispatcher
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
-void DataSynchronizeMultiDispatcher::
+DataSynchronizeResult DataSynchronizeMultiDispatcher::
 synchronize(ConstArrayView<IVariable*> vars)
 {
   Ref<IParallelExchanger> exchanger{ ParallelMngUtils::createExchangerRef(m_parallel_mng) };
@@ -267,6 +268,10 @@ synchronize(ConstArrayView<IVariable*> vars)
       var->serialize(sbuf, ghost_ids, nullptr);
     }
   }
+  // Les volumes échangés ne sont pas connus avec cette implémentation.
+  DataSynchronizeResult result;
+  result.setNbNeighbourRank(nb_rank);
+  return result;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -294,7 +299,7 @@ class ARCANE_IMPL_EXPORT DataSynchronizeMultiDispatcherV2
 
   void compute() override { _compute(); }
   void setSynchronizeBuffer(Ref<MemoryBuffer> buffer) override { m_sync_buffer.setSynchronizeBuffer(buffer); }
-  void synchronize(ConstArrayView<IVariable*> vars) override;
+  DataSynchronizeResult synchronize(ConstArrayView<IVariable*> vars) override;
 
  private:
 
@@ -304,7 +309,7 @@ class ARCANE_IMPL_EXPORT DataSynchronizeMultiDispatcherV2
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
-void DataSynchronizeMultiDispatcherV2::
+DataSynchronizeResult DataSynchronizeMultiDispatcherV2::
 synchronize(ConstArrayView<IVariable*> vars)
 {
   const Int32 nb_var = vars.size();
@@ -331,6 +336,10 @@ synchronize(ConstArrayView<IVariable*> vars)
 
   m_synchronize_implementation->beginSynchronize(&m_sync_buffer);
   m_synchronize_implementation->endSynchronize(&m_sync_buffer);
+
+  DataSynchronizeResult result;
+  m_sync_buffer.fillProfilingInfo(result);
+  return result;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -57,9 +57,34 @@ class DataSynchronizeResult
   eDataSynchronizeCompareStatus compareStatus() const { return m_compare_status; }
   void setCompareStatus(eDataSynchronizeCompareStatus v) { m_compare_status = v; }
 
+  //! Temps (en seconde) passé dans les recopies entre les données et les buffers
+  Real copyTime() const { return m_copy_time; }
+  void setCopyTime(Real v) { m_copy_time = v; }
+
+  //! Taille totale (en octet) des messages envoyés
+  Int64 sendSize() const { return m_send_size; }
+  void setSendSize(Int64 v) { m_send_size = v; }
+
+  //! Taille totale (en octet) des messages reçus
+  Int64 receiveSize() const { return m_receive_size; }
+  void setReceiveSize(Int64 v) { m_receive_size = v; }
+
+  //! Taille (en octet) du plus gros message envoyé à un rang voisin
+  Int64 maxSendMessageSize() const { return m_max_send_message_size; }
+  void setMaxSendMessageSize(Int64 v) { m_max_send_message_size = v; }
+
+  //! Nombre de rangs voisins
+  Int32 nbNeighbourRank() const { return m_nb_neighbour_rank; }
+  void setNbNeighbourRank(Int32 v) { m_nb_neighbour_rank = v; }
+
  private:
 
   eDataSynchronizeCompareStatus m_compare_status = eDataSynchronizeCompareStatus::Unknown;
+  Real m_copy_time = 0.0;
+  Int64 m_send_size = 0;
+  Int64 m_receive_size = 0;
+  Int64 m_max_send_message_size = 0;
+  Int32 m_nb_neighbour_rank = 0;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,270 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* EntryPointGraphScheduler.cc                                 (C) 2000-2023 */
+/*                                                                           */
+/* Ordonnanceur en graphe de tâches des points d'entrée.                     */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/impl/internal/EntryPointGraphScheduler.h"
+
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/SmallArray.h"
+
+#include "arcane/core/EntryPoint.h"
+#include "arcane/core/IModule.h"
+#include "arcane/core/IVariable.h"
+#include "arcane/core/VariableDependInfo.h"
+#include "arcane/core/Concurrency.h"
+#include "arcane/core/internal/IVariableSynchronizerMngInternal.h"
+
+#include <algorithm>
+#include <set>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+namespace
+{
+  using VariableSet = std::set<IVariable*>;
+
+  //! Ajoute à \a read_vars et \a write_vars les accès induits par la lecture de \a var.
+  void _addReadVariable(IVariable* var, VariableSet& read_vars, VariableSet& write_vars)
+  {
+    if (!read_vars.insert(var).second)
+      return;
+    // Lire une variable qui possède une fonction de recalcul peut
+    // provoquer ce recalcul et donc la lecture des variables dont elle
+    // dépend et la modification de la variable.
+    if (!var->computeFunction())
+      return;
+    write_vars.insert(var);
+    UniqueArray<VariableDependInfo> depends;
+    var->dependInfos(depends);
+    for (const VariableDependInfo& vdi : depends)
+      _addReadVariable(vdi.variable(), read_vars, write_vars);
+  }
+
+  bool _hasIntersection(const VariableSet& a, const VariableSet& b)
+  {
+    if (a.size() > b.size())
+      return _hasIntersection(b, a);
+    for (IVariable* var : a)
+      if (b.find(var) != b.end())
+        return true;
+    return false;
+  }
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+EntryPointGraphScheduler::
+EntryPointGraphScheduler(ITraceMng* tm, IVariableSynchronizerMngInternal* sync_mng)
+: TraceAccessor(tm)
+, m_synchronizer_mng(sync_mng)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool EntryPointGraphScheduler::
+isSchedulable(IEntryPoint* ep)
+{
+  if (!ep->hasVariableDepends())
+    return false;
+  return dynamic_cast<EntryPoint*>(ep) != nullptr;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void EntryPointGraphScheduler::
+build(ConstArrayView<IEntryPoint*> entry_points)
+{
+  std::vector<IEntryPoint*> key(entry_points.data(), entry_points.data() + entry_points.size());
+  std::unique_ptr<Graph>& graph = m_graphs[key];
+  if (!graph) {
+    graph = std::make_unique<Graph>();
+    _buildGraph(*graph, entry_points);
+  }
+  m_current_graph = graph.get();
+
+  const Int32 nb_node = m_current_graph->m_nodes.size();
+  if (nb_node > m_nb_remaining_size) {
+    m_nb_remaining = std::make_unique<std::atomic<Int32>[]>(nb_node);
+    m_nb_remaining_size = nb_node;
+  }
+  m_exceptions.resize(nb_node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void EntryPointGraphScheduler::
+_buildGraph(Graph& graph, ConstArrayView<IEntryPoint*> entry_points)
+{
+  const Int32 nb_entry_point = entry_points.size();
+  UniqueArray<Node>& nodes = graph.m_nodes;
+  nodes.resize(nb_entry_point);
+
+  std::vector<VariableSet> read_vars(nb_entry_point);
+  std::vector<VariableSet> write_vars(nb_entry_point);
+  UniqueArray<VariableDependInfo> depends;
+  for (Int32 i = 0; i < nb_entry_point; ++i) {
+    IEntryPoint* ep = entry_points[i];
+    auto* concrete_ep = dynamic_cast<EntryPoint*>(ep);
+    if (!concrete_ep || !ep->hasVariableDepends())
+      ARCANE_FATAL("Entry point '{0}' can not be scheduled", ep->fullName());
+    nodes[i].m_entry_point = concrete_ep;
+    depends.clear();
+    ep->writeDependInfos(depends);
+    for (const VariableDependInfo& vdi : depends)
+      write_vars[i].insert(vdi.variable());
+    depends.clear();
+    ep->readDependInfos(depends);
+    for (const VariableDependInfo& vdi : depends)
+      _addReadVariable(vdi.variable(), read_vars[i], write_vars[i]);
+  }
+
+  // Calcule les arcs du graphe. Un point d'entrée dépend de tous les
+  // points d'entrée précédents avec lesquels il est en conflit.
+  // Le niveau d'un point d'entrée est la longueur du plus long chemin
+  // depuis une racine.
+  UniqueArray<Int32> levels(nb_entry_point, 0);
+  Int32 nb_edge = 0;
+  Int32 nb_level = 0;
+  for (Int32 j = 0; j < nb_entry_point; ++j) {
+    IModule* module_j = entry_points[j]->module();
+    for (Int32 i = 0; i < j; ++i) {
+      bool has_conflict = (entry_points[i]->module() == module_j) ||
+      _hasIntersection(write_vars[i], read_vars[j]) ||
+      _hasIntersection(write_vars[i], write_vars[j]) ||
+      _hasIntersection(read_vars[i], write_vars[j]);
+      if (!has_conflict)
+        continue;
+      nodes[i].m_successors.add(j);
+      ++nodes[j].m_nb_predecessor;
+      levels[j] = std::max(levels[j], levels[i] + 1);
+      ++nb_edge;
+    }
+    if (nodes[j].m_nb_predecessor == 0)
+      graph.m_roots.add(j);
+    nb_level = std::max(nb_level, levels[j] + 1);
+  }
+  graph.m_nb_level = nb_level;
+
+  info() << "EntryPointGraph: nb_entry_point=" << nb_entry_point
+         << " nb_edge=" << nb_edge << " nb_root=" << graph.m_roots.size()
+         << " nb_level=" << nb_level << " nb_graph=" << m_graphs.size();
+  for (Int32 i = 0; i < nb_entry_point; ++i)
+    info(4) << "EntryPointGraph: entry_point=" << entry_points[i]->fullName()
+            << " level=" << levels[i] << " nb_predecessor=" << nodes[i].m_nb_predecessor
+            << " successors=" << nodes[i].m_successors;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void EntryPointGraphScheduler::
+execute()
+{
+  if (!m_current_graph)
+    ARCANE_FATAL("build() has to be called before execute()");
+  UniqueArray<Node>& nodes = m_current_graph->m_nodes;
+  const Int32 nb_node = nodes.size();
+  for (Int32 i = 0; i < nb_node; ++i) {
+    m_nb_remaining[i] = nodes[i].m_nb_predecessor;
+    m_exceptions[i] = nullptr;
+  }
+  m_has_error = false;
+
+  // Les exceptions des points d'entrée sont conservées dans m_exceptions
+  // donc _executeNodes() ne lève pas d'exception.
+  if (m_synchronizer_mng)
+    m_synchronizer_mng->beginConcurrentDeferredSynchronizations(nb_node);
+  _executeNodes(m_current_graph->m_roots);
+  if (m_synchronizer_mng)
+    m_synchronizer_mng->endConcurrentDeferredSynchronizations();
+
+  if (m_has_error) {
+    for (Int32 i = 0; i < nb_node; ++i)
+      if (m_exceptions[i])
+        std::rethrow_exception(m_exceptions[i]);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Exécute le point d'entrée d'indice \a index puis ceux qui n'attendaient
+ * plus que lui.
+ *
+ * C'est la tâche qui termine le dernier prédécesseur d'un point d'entrée
+ * qui se charge de le lancer. Il n'y a donc jamais d'attente active.
+ */
+void EntryPointGraphScheduler::
+_executeNode(Int32 index)
+{
+  Node& node = m_current_graph->m_nodes[index];
+  // En cas d'erreur, on parcourt quand même le graphe pour
+  // terminer proprement mais sans exécuter les points d'entrée.
+  if (!m_has_error) {
+    if (m_synchronizer_mng)
+      m_synchronizer_mng->enterConcurrentDeferredTask(index);
+    try {
+      node.m_entry_point->executeEntryPointConcurrent();
+    }
+    catch (...) {
+      m_exceptions[index] = std::current_exception();
+      m_has_error = true;
+    }
+    if (m_synchronizer_mng)
+      m_synchronizer_mng->exitConcurrentDeferredTask();
+  }
+
+  SmallArray<Int32> ready_indexes;
+  for (Int32 successor : node.m_successors)
+    if (m_nb_remaining[successor].fetch_sub(1) == 1)
+      ready_indexes.add(successor);
+  _executeNodes(ready_indexes);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void EntryPointGraphScheduler::
+_executeNodes(ConstArrayView<Int32> indexes)
+{
+  const Int32 nb_index = indexes.size();
+  if (nb_index == 0)
+    return;
+  if (nb_index == 1) {
+    _executeNode(indexes[0]);
+    return;
+  }
+  // Chaque point d'entrée est une tâche indépendante.
+  ParallelLoopOptions options;
+  options.setPartitioner(ParallelLoopOptions::Partitioner::Static);
+  arcaneParallelFor(0, nb_index, options, [&](Integer begin, Integer size) {
+    for (Integer i = begin; i < (begin + size); ++i)
+      _executeNode(indexes[i]);
+  });
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -14,6 +14,8 @@
 #include "arcane/utils/Event.h"
 
 #include "arcane/IVariableSynchronizer.h"
+#include "arcane/IVariableSynchronizerRequest.h"
+#include "arcane/IItemFamily.h"
 #include "arcane/VariableSynchronizerEventArgs.h"
 #include "arcane/ItemGroup.h"
 #include "arcane/VariableCollection.h"
@@ -24,6 +26,33 @@
 namespace Arcane
 {
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Requête de synchronisation non bloquante en séquentiel.
+ *
+ * Il n'y a rien à synchroniser donc la requête est terminée dès sa création.
+ */
+class NullVariableSynchronizerRequest
+: public IVariableSynchronizerRequest
+{
+ public:
+
+  explicit NullVariableSynchronizerRequest(IVariable* var)
+  : m_variable(var)
+  {}
+
+ public:
+
+  IVariable* variable() const override { return m_variable; }
+  void wait() override {}
+  bool isDone() const override { return true; }
+
+ private:
+
+  IVariable* m_variable = nullptr;
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -73,6 +102,11 @@ class NullVariableSynchronizer
       m_on_synchronized.notify(args);
     }
   }
+  Ref<IVariableSynchronizerRequest> synchronizeAsync(IVariable* var) override
+  {
+    synchronize(var);
+    return makeRef<IVariableSynchronizerRequest>(new NullVariableSynchronizerRequest(var));
+  }
   Int32ConstArrayView communicatingRanks() override
   {
     return Int32ConstArrayView();
@@ -89,6 +123,17 @@ class NullVariableSynchronizer
     ARCANE_UNUSED(index);
     return Int32ConstArrayView();
   }
+  ItemGroup innerItems() override
+  {
+    return m_item_group.own();
+  }
+  ItemGroup boundaryItems() override
+  {
+    // Aucune entité n'est partagée en séquentiel.
+    if (m_boundary_items.null())
+      m_boundary_items = m_item_group.itemFamily()->findGroup(m_item_group.name() + "_SyncBoundary", true);
+    return m_boundary_items;
+  }
   void synchronizeData(IData* data) override
   {
     ARCANE_UNUSED(data);
@@ -99,10 +144,18 @@ class NullVariableSynchronizer
     return m_on_synchronized;
   }
 
+  void setDataCompressor(Ref<IDataCompressor> compressor) override
+  {
+    m_data_compressor = compressor;
+  }
+  Ref<IDataCompressor> dataCompressor() const override { return m_data_compressor; }
+
  private:
 
   IParallelMng* m_parallel_mng;
   ItemGroup m_item_group;
+  ItemGroup m_boundary_items;
+  Ref<IDataCompressor> m_data_compressor;
   EventObservable<const VariableSynchronizerEventArgs&> m_on_synchronized;
 };
 
@@ -26,6 +26,7 @@
 #include "arcane/utils/OStringStream.h"
 #include "arcane/utils/FloatingPointExceptionSentry.h"
 #include "arcane/utils/JSONWriter.h"
+#include "arcane/utils/ConcurrencyUtils.h"
 
 #include "arcane/core/IApplication.h"
 #include "arcane/core/IServiceLoader.h"
@@ -78,6 +79,7 @@
 #include "arcane/accelerator/core/Runner.h"
 
 #include "arcane/impl/DefaultBackwardMng.h"
+#include "arcane/impl/internal/EntryPointGraphScheduler.h"
 
 #include <algorithm>
 #include <map>
@@ -304,6 +306,11 @@ class TimeLoopMng
   //! Pour test, point d'entrée spécifique à appeler
   String m_specific_entry_point_name;
 
+  //! Indique si on exécute en concurrence les points d'entrée indépendants
+  bool m_use_entry_point_graph = false;
+  //! Ordonnanceur des points d'entrée (si m_use_entry_point_graph est vrai)
+  std::unique_ptr<EntryPointGraphScheduler> m_entry_point_graph_scheduler;
+
  private:
 
   void _execOneEntryPoint(IEntryPoint* ic, Integer index_value = 0, bool do_verif = false);
@@ -316,6 +323,9 @@ class TimeLoopMng
   void _fillModuleFactoryMap();
   void _createSingletonServices(IServiceLoader* service_loader);
   void _callSpecificEntryPoint();
+  void _execLoopEntryPointsWithGraph();
+  bool _execLoopEntryPointGroup(ConstArrayView<IEntryPoint*> entry_points,
+                                ConstArrayView<Integer> indexes);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -438,6 +448,15 @@ build()
       info() << "Do verification only at exit";
     }
   }
+  // Regarde si on exécute en concurrence les points d'entrée de la boucle
+  // en temps qui ont déclaré leurs dépendances.
+  {
+    if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_ENTRY_POINT_GRAPH_SCHEDULER", true)){
+      m_use_entry_point_graph = (v.value()!=0);
+      if (m_use_entry_point_graph)
+        info() << "Use task graph scheduler for entry points of the time loop";
+    }
+  }
   // Regarde si on n'exécute qu'un seul point d'entrée au lieu de la boucle
   // en temps. Cela est utilisé uniquement pour des tests
   {
@@ -924,22 +943,29 @@ doOneIteration()
     Integer index =0;
     sd->timeStats()->notifyNewIterationLoop();
     Timer::Action ts_action(sd,"LoopEntryPoints");
-    for( EntryPointList::Enumerator i(m_loop_entry_points); ++i; ++index ){
-      IEntryPoint* ep = *i;
-      IModule* mod = ep->module();
-      if (mod && mod->disabled()){
-        continue;
-        //warning() << "MODULE " << mod->name() << " is disabled";
-      }
-      try{
-        _execOneEntryPoint(*i, index, true);
-      } catch(const GoBackwardException&){
-        m_backward_mng->goBackward();
-      } catch(...){ // On remonte toute autre exception
-        throw;
-      }
-      if (m_backward_mng->isBackwardEnabled()){
-        break;
+    // Si les tâches ne sont pas actives, il n'y a pas d'intérêt à utiliser le
+    // graphe des points d'entrée.
+    bool use_graph = m_use_entry_point_graph && TaskFactory::isActive();
+    if (use_graph)
+      _execLoopEntryPointsWithGraph();
+    else{
+      for( EntryPointList::Enumerator i(m_loop_entry_points); ++i; ++index ){
+        IEntryPoint* ep = *i;
+        IModule* mod = ep->module();
+        if (mod && mod->disabled()){
+          continue;
+          //warning() << "MODULE " << mod->name() << " is disabled";
+        }
+        try{
+          _execOneEntryPoint(*i, index, true);
+        } catch(const GoBackwardException&){
+          m_backward_mng->goBackward();
+        } catch(...){ // On remonte toute autre exception
+          throw;
+        }
+        if (m_backward_mng->isBackwardEnabled()){
+          break;
+        }
       }
     }
     if (!m_verification_at_entry_point && !m_verification_only_at_exit)
@@ -973,6 +999,104 @@ doOneIteration()
   return 0;
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Exécute les points d'entrée de la boucle en temps via un graphe de tâches.
+ *
+ * Les points d'entrée consécutifs qui ont déclaré leurs dépendances sur les
+ * variables sont regroupés et exécutés via EntryPointGraphScheduler. Les
+ * autres points d'entrée sont exécutés séquentiellement comme dans
+ * doOneIteration() et séparent donc les groupes.
+ */
+void TimeLoopMng::
+_execLoopEntryPointsWithGraph()
+{
+  UniqueArray<IEntryPoint*> group;
+  UniqueArray<Integer> group_indexes;
+  const Integer nb_entry_point = m_loop_entry_points.count();
+  for( Integer index=0; index<=nb_entry_point; ++index ){
+    IEntryPoint* ep = (index<nb_entry_point) ? m_loop_entry_points[index] : nullptr;
+    if (ep){
+      IModule* mod = ep->module();
+      if (mod && mod->disabled())
+        continue;
+      if (EntryPointGraphScheduler::isSchedulable(ep)){
+        group.add(ep);
+        group_indexes.add(index);
+        continue;
+      }
+    }
+    // Exécute le groupe de points d'entrée en attente
+    if (!group.empty()){
+      bool is_backward = _execLoopEntryPointGroup(group,group_indexes);
+      group.clear();
+      group_indexes.clear();
+      if (is_backward)
+        return;
+    }
+    if (!ep)
+      break;
+    try{
+      _execOneEntryPoint(ep, index, true);
+    } catch(const GoBackwardException&){
+      m_backward_mng->goBackward();
+    }
+    if (m_backward_mng->isBackwardEnabled())
+      return;
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Exécute en concurrence le groupe de points d'entrée \a entry_points.
+ *
+ * Les évènements eTimeLoopEventType::BeginEntryPoint et
+ * eTimeLoopEventType::EndEntryPoint ne sont pas envoyés pour ces points
+ * d'entrée. Les synchronisations différées et les vérifications sont
+ * effectuées une fois que tous les points d'entrée du groupe sont terminés.
+ *
+ * Retourne \a true si un retour-arrière a été demandé.
+ */
+bool TimeLoopMng::
+_execLoopEntryPointGroup(ConstArrayView<IEntryPoint*> entry_points,
+                         ConstArrayView<Integer> indexes)
+{
+  if (entry_points.size()==1){
+    try{
+      _execOneEntryPoint(entry_points[0], indexes[0], true);
+    } catch(const GoBackwardException&){
+      m_backward_mng->goBackward();
+    }
+    return m_backward_mng->isBackwardEnabled();
+  }
+
+  IVariableSynchronizerMng* vsm = m_sub_domain->variableMng()->synchronizerMng();
+  if (!m_entry_point_graph_scheduler)
+    m_entry_point_graph_scheduler = std::make_unique<EntryPointGraphScheduler>(traceMng(), vsm->_internalApi());
+  EntryPointGraphScheduler* scheduler = m_entry_point_graph_scheduler.get();
+  scheduler->build(entry_points);
+  {
+    Timer::Action ts_action(m_sub_domain,"EntryPointGraph");
+    Timer::Phase ts_phase(m_sub_domain,TP_Computation);
+    try{
+      scheduler->execute();
+    } catch(const GoBackwardException&){
+      m_backward_mng->goBackward();
+    }
+  }
+
+  if (vsm->nbDeferredSynchronization()!=0)
+    vsm->flushDeferredSynchronizations();
+
+  if (m_verification_at_entry_point && !m_verification_only_at_exit)
+    for( Integer i=0, n=entry_points.size(); i<n; ++i )
+      _checkVerif(entry_points[i]->name(),indexes[i],true);
+
+  return m_backward_mng->isBackwardEnabled();
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -1629,6 +1753,10 @@ _dumpTimeInfos(JSONWriter& json_writer)
     JSONWriter::Object jo(json_writer,"VariablesStats");
     m_sub_domain->variableMng()->dumpStatsJSON(json_writer);
   }
+  {
+    JSONWriter::Object jo(json_writer,"SynchronizeStats");
+    m_sub_domain->variableMng()->synchronizerMng()->dumpStatsJSON(json_writer);
+  }
   {
     JSONWriter::Object jo(json_writer,"TimeStats");
     m_sub_domain->timeStats()->dumpStatsJSON(json_writer);
@@ -0,0 +1,366 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* VariableDeltaSynchronizer.cc                                (C) 2000-2023 */
+/*                                                                           */
+/* Synchronisation des variables par envoi des seules valeurs modifiées.     */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/impl/internal/VariableDeltaSynchronizer.h"
+
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/ValueConvert.h"
+#include "arcane/utils/MemoryView.h"
+#include "arcane/utils/ITraceMng.h"
+
+#include "arcane/core/IParallelMng.h"
+#include "arcane/core/IVariable.h"
+#include "arcane/core/IData.h"
+#include "arcane/core/parallel/IStat.h"
+#include "arcane/core/internal/IDataInternal.h"
+
+#include "arcane/impl/DataSynchronizeInfo.h"
+#include "arcane/impl/internal/IBufferCopier.h"
+
+#include <cstring>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+namespace
+{
+  //! Le message contient toutes les valeurs
+  const Int32 DELTA_MESSAGE_DENSE = 0;
+  //! Le message contient uniquement les valeurs modifiées
+  const Int32 DELTA_MESSAGE_SPARSE = 1;
+  //! Nombre d'entiers de l'en-tête (taille d'un élément, type, nombre de valeurs modifiées)
+  const Int32 DELTA_HEADER_NB_INT32 = 3;
+  const Int64 DELTA_HEADER_SIZE = DELTA_HEADER_NB_INT32 * sizeof(Int32);
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Valeurs de référence pour une variable.
+ */
+class VariableDeltaSynchronizer::VariableState
+{
+ public:
+
+  //! Identifiant de la variable dans le gestionnaire de synchronisation
+  Int64 m_delta_id = 0;
+  //! Taille (en octet) d'un élément de la variable
+  Int32 m_datatype_size = 0;
+  //! Valeurs des entités partagées lors du dernier envoi
+  UniqueArray<Byte> m_send_values;
+  //! Valeurs des entités fantômes lors de la dernière réception
+  UniqueArray<Byte> m_receive_values;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+VariableDeltaSynchronizer::
+VariableDeltaSynchronizer(IParallelMng* pm, Ref<DataSynchronizeInfo> sync_info,
+                          Ref<IBufferCopier> copier)
+: TraceAccessor(pm->traceMng())
+, m_parallel_mng(pm)
+, m_sync_info(sync_info)
+, m_buffer_copier(copier)
+{
+  if (auto v = Convert::Type<Real>::tryParseFromEnvironment("ARCANE_SYNCHRONIZE_DELTA_THRESHOLD", true))
+    m_threshold = v.value();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+VariableDeltaSynchronizer::
+~VariableDeltaSynchronizer()
+{
+  reset();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableDeltaSynchronizer::
+releaseVariable(IVariable* var)
+{
+  auto iter = m_states.find(var);
+  if (iter == m_states.end())
+    return;
+  delete iter->second;
+  m_states.erase(iter);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableDeltaSynchronizer::
+reset()
+{
+  for (const auto& x : m_states)
+    delete x.second;
+  m_states.clear();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+VariableDeltaSynchronizer::VariableState* VariableDeltaSynchronizer::
+_getState(IVariable* var, Int64 delta_id)
+{
+  VariableState*& state = m_states[var];
+  if (!state)
+    state = new VariableState();
+  // Si l'identifiant a changé, il s'agit d'une autre variable qui a la même
+  // adresse ou bien le mode a été désactivé puis réactivé. Dans les deux
+  // cas les valeurs de référence ne sont plus valides.
+  if (state->m_delta_id != delta_id) {
+    *state = VariableState();
+    state->m_delta_id = delta_id;
+  }
+  return state;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableDeltaSynchronizer::
+synchronize(IVariable* var, Int64 delta_id)
+{
+  ARCANE_CHECK_POINTER(var);
+  INumericDataInternal* numapi = var->data()->_commonInternal()->numericData();
+  if (!numapi)
+    ARCANE_FATAL("Variable '{0}' can not be synchronized because it is not a numeric data", var->name());
+
+  IParallelMng* pm = m_parallel_mng;
+  MutableMemoryView data_view = numapi->memoryView();
+  const Int32 datatype_size = data_view.datatypeSize();
+
+  const DataSynchronizeBufferInfoList& send_info = m_sync_info->sendInfo();
+  const DataSynchronizeBufferInfoList& receive_info = m_sync_info->receiveInfo();
+  const Int32 nb_rank = m_sync_info->size();
+  const Int64 total_send_size = send_info.totalNbItem() * datatype_size;
+  const Int64 total_receive_size = receive_info.totalNbItem() * datatype_size;
+
+  VariableState* state = _getState(var, delta_id);
+  // Les valeurs de référence ne sont valides que si la taille des éléments
+  // n'a pas changé (ce qui peut arriver pour les variables tableaux).
+  const bool is_same_layout = (state->m_datatype_size == datatype_size);
+  const bool has_old_send = is_same_layout && (state->m_send_values.largeSize() == total_send_size);
+  const bool has_old_receive = is_same_layout && (state->m_receive_values.largeSize() == total_receive_size);
+
+  // Recopie les valeurs courantes des entités partagées.
+  m_current_send_values.resize(total_send_size);
+  for (Int32 i = 0; i < nb_rank; ++i) {
+    Int32ConstArrayView share_ids = send_info.localIds(i);
+    Byte* ptr = m_current_send_values.data() + send_info.bufferDisplacement(i) * datatype_size;
+    MutableMemoryView local_buffer = makeMutableMemoryView(ptr, datatype_size, share_ids.size());
+    m_buffer_copier->copyToBufferAsync(share_ids, local_buffer, data_view);
+  }
+  m_buffer_copier->barrier();
+
+  m_send_buffers.resize(nb_rank);
+  m_receive_buffers.resize(nb_rank);
+  m_send_sizes.resize(nb_rank);
+  m_receive_sizes.resize(nb_rank);
+
+  Int64 sent_size = 0;
+  for (Int32 i = 0; i < nb_rank; ++i) {
+    Int64 displacement = send_info.bufferDisplacement(i) * datatype_size;
+    Int64 size = send_info.localIds(i).size() * datatype_size;
+    Span<const Byte> current_values = m_current_send_values.span().subspan(displacement, size);
+    Span<const Byte> old_values;
+    if (has_old_send)
+      old_values = state->m_send_values.span().subspan(displacement, size);
+    sent_size += _fillSendMessage(m_send_buffers[i], current_values, old_values, has_old_send, datatype_size);
+    m_send_sizes[i] = m_send_buffers[i].largeSize();
+  }
+
+  _exchangeMessages();
+
+  state->m_receive_values.resize(total_receive_size);
+  for (Int32 i = 0; i < nb_rank; ++i) {
+    Int64 displacement = receive_info.bufferDisplacement(i) * datatype_size;
+    Int64 size = receive_info.localIds(i).size() * datatype_size;
+    Span<Byte> values = state->m_receive_values.span().subspan(displacement, size);
+    _readReceiveMessage(m_receive_buffers[i], values, has_old_receive, datatype_size, m_sync_info->targetRank(i));
+  }
+
+  // Recopie l'ensemble des valeurs reçues dans les entités fantômes.
+  for (Int32 i = 0; i < nb_rank; ++i) {
+    Int32ConstArrayView ghost_ids = receive_info.localIds(i);
+    const Byte* ptr = state->m_receive_values.data() + receive_info.bufferDisplacement(i) * datatype_size;
+    ConstMemoryView local_buffer = makeConstMemoryView(ptr, datatype_size, ghost_ids.size());
+    m_buffer_copier->copyFromBufferAsync(ghost_ids, local_buffer, data_view);
+  }
+  m_buffer_copier->barrier();
+
+  // Les valeurs courantes deviennent les valeurs de référence.
+  state->m_send_values.swap(m_current_send_values);
+  state->m_datatype_size = datatype_size;
+
+  m_sent_size += sent_size;
+  m_full_size += total_send_size;
+  pm->stat()->add("SyncDeltaSend", 0.0, sent_size);
+  pm->stat()->add("SyncDeltaFull", 0.0, total_send_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Remplit le message d'envoi pour un rang.
+ *
+ * Retourne la taille (en octet) des valeurs envoyées.
+ */
+Int64 VariableDeltaSynchronizer::
+_fillSendMessage(Array<Byte>& buffer, Span<const Byte> current_values,
+                 Span<const Byte> old_values, bool has_old_values, Int32 datatype_size)
+{
+  const Int64 nb_item = current_values.size() / datatype_size;
+  m_changed_indexes.clear();
+  m_changed_values.clear();
+
+  bool is_dense = !has_old_values;
+  if (!is_dense) {
+    // Par défaut, on envoie toutes les valeurs dès que le message
+    // avec les indices serait plus gros.
+    Real threshold = m_threshold;
+    if (threshold < 0.0)
+      threshold = static_cast<Real>(datatype_size) / static_cast<Real>(datatype_size + sizeof(Int32));
+    const Int64 max_changed = static_cast<Int64>(threshold * static_cast<Real>(nb_item));
+    const Byte* current_ptr = current_values.data();
+    const Byte* old_ptr = old_values.data();
+    for (Int64 k = 0; k < nb_item; ++k) {
+      Int64 offset = k * datatype_size;
+      if (std::memcmp(current_ptr + offset, old_ptr + offset, datatype_size) != 0) {
+        m_changed_indexes.add(static_cast<Int32>(k));
+        m_changed_values.addRange(current_values.subspan(offset, datatype_size));
+        if (m_changed_indexes.largeSize() > max_changed) {
+          is_dense = true;
+          break;
+        }
+      }
+    }
+  }
+
+  Int64 sent_size = 0;
+  const Int32 nb_changed = (is_dense) ? 0 : m_changed_indexes.size();
+  Int32 header[DELTA_HEADER_NB_INT32] = { datatype_size, (is_dense) ? DELTA_MESSAGE_DENSE : DELTA_MESSAGE_SPARSE, nb_changed };
+  buffer.clear();
+  buffer.addRange(Span<const Byte>(reinterpret_cast<const Byte*>(header), DELTA_HEADER_SIZE));
+  if (is_dense) {
+    buffer.addRange(current_values);
+    sent_size = current_values.size();
+    ++m_nb_dense_message;
+  }
+  else {
+    Span<const Byte> indexes_bytes(reinterpret_cast<const Byte*>(m_changed_indexes.data()),
+                                   m_changed_indexes.largeSize() * sizeof(Int32));
+    buffer.addRange(indexes_bytes);
+    buffer.addRange(m_changed_values.constSpan());
+    sent_size = m_changed_values.largeSize() + indexes_bytes.size();
+    ++m_nb_sparse_message;
+  }
+  return sent_size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Echange les messages avec les rangs voisins.
+ *
+ * On échange d'abord la taille des messages pour pouvoir dimensionner
+ * les buffers de réception puis le contenu des messages.
+ */
+void VariableDeltaSynchronizer::
+_exchangeMessages()
+{
+  IParallelMng* pm = m_parallel_mng;
+  const Int32 nb_rank = m_sync_info->size();
+
+  m_requests.clear();
+  for (Int32 i = 0; i < nb_rank; ++i) {
+    Int32 rank = m_sync_info->targetRank(i);
+    m_requests.add(pm->recv(m_receive_sizes.subView(i, 1), rank, false));
+    m_requests.add(pm->send(m_send_sizes.subConstView(i, 1), rank, false));
+  }
+  pm->waitAllRequests(m_requests);
+
+  m_requests.clear();
+  for (Int32 i = 0; i < nb_rank; ++i) {
+    Int32 rank = m_sync_info->targetRank(i);
+    Int64 receive_size = m_receive_sizes[i];
+    if (receive_size < DELTA_HEADER_SIZE)
+      ARCANE_FATAL("Bad message size '{0}' for delta synchronization with rank '{1}'", receive_size, rank);
+    m_receive_buffers[i].resize(receive_size);
+    m_requests.add(pm->recv(m_receive_buffers[i].view(), rank, false));
+    m_requests.add(pm->send(m_send_buffers[i].constView(), rank, false));
+  }
+  pm->waitAllRequests(m_requests);
+  m_requests.clear();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Lit le message \a buffer reçu du rang \a rank et met à jour \a values.
+ */
+void VariableDeltaSynchronizer::
+_readReceiveMessage(Span<const Byte> buffer, Span<Byte> values, bool has_old_values,
+                    Int32 datatype_size, Int32 rank)
+{
+  Int32 header[DELTA_HEADER_NB_INT32];
+  std::memcpy(header, buffer.data(), DELTA_HEADER_SIZE);
+  Span<const Byte> content = buffer.subspan(DELTA_HEADER_SIZE, buffer.size() - DELTA_HEADER_SIZE);
+  const Int32 sender_datatype_size = header[0];
+  if (sender_datatype_size != datatype_size)
+    ARCANE_FATAL("Bad datatype size for delta synchronization with rank '{0}' expected={1} received={2}",
+                 rank, datatype_size, sender_datatype_size);
+  const Int32 message_type = header[1];
+  if (message_type == DELTA_MESSAGE_DENSE) {
+    if (content.size() != values.size())
+      ARCANE_FATAL("Bad message size for delta synchronization with rank '{0}' expected={1} received={2}",
+                   rank, values.size(), content.size());
+    std::memcpy(values.data(), content.data(), values.size());
+    return;
+  }
+  if (message_type != DELTA_MESSAGE_SPARSE)
+    ARCANE_FATAL("Invalid message type '{0}' for delta synchronization with rank '{1}'", message_type, rank);
+  // Le rang émetteur a des valeurs de référence donc on doit aussi en avoir.
+  if (!has_old_values)
+    ARCANE_FATAL("Received partial values from rank '{0}' without previous values", rank);
+  const Int64 nb_changed = header[2];
+  const Int64 indexes_size = nb_changed * sizeof(Int32);
+  if (nb_changed < 0 || content.size() != indexes_size + nb_changed * datatype_size)
+    ARCANE_FATAL("Bad number of values for delta synchronization with rank '{0}'", rank);
+  m_changed_indexes.resize(nb_changed);
+  std::memcpy(m_changed_indexes.data(), content.data(), indexes_size);
+  const Byte* received_values = content.data() + indexes_size;
+  const Int64 nb_item = values.size() / datatype_size;
+  for (Int64 k = 0; k < nb_changed; ++k) {
+    Int32 index = m_changed_indexes[k];
+    if (index < 0 || index >= nb_item)
+      ARCANE_FATAL("Bad index '{0}' for delta synchronization with rank '{1}' (max={2})", index, rank, nb_item);
+    std::memcpy(values.data() + static_cast<Int64>(index) * datatype_size,
+                received_values + k * datatype_size, datatype_size);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
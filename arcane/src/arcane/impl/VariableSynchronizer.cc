@@ -18,6 +18,7 @@
 #include "arcane/utils/FatalErrorException.h"
 #include "arcane/utils/ITraceMng.h"
 #include "arcane/utils/IMemoryRessourceMng.h"
+#include "arcane/utils/IDataCompressor.h"
 #include "arcane/utils/internal/MemoryBuffer.h"
 
 #include "arcane/core/VariableSynchronizerEventArgs.h"
@@ -31,18 +32,25 @@
 #include "arcane/core/IMesh.h"
 #include "arcane/core/IVariableMng.h"
 #include "arcane/core/IVariableSynchronizerMng.h"
+#include "arcane/core/IVariableSynchronizerRequest.h"
+#include "arcane/core/ServiceBuilder.h"
+#include "arcane/core/MeshHandle.h"
+#include "arcane/core/ItemEnumerator.h"
 #include "arcane/core/parallel/IStat.h"
 #include "arcane/core/internal/IDataInternal.h"
 #include "arcane/core/internal/IParallelMngInternal.h"
 #include "arcane/core/internal/IVariableSynchronizerMngInternal.h"
 
 #include "arcane/accelerator/core/Runner.h"
+#include "arcane/accelerator/core/PointerAttribute.h"
 
 #include "arcane/impl/DataSynchronizeInfo.h"
 #include "arcane/impl/internal/VariableSynchronizerComputeList.h"
 #include "arcane/impl/internal/IBufferCopier.h"
+#include "arcane/impl/internal/VariableDeltaSynchronizer.h"
 
 #include <algorithm>
+#include <memory>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -56,6 +64,9 @@ namespace Arcane
 extern "C++" Ref<IDataSynchronizeImplementationFactory>
 arcaneCreateSimpleVariableSynchronizerFactory(IParallelMng* pm);
 
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateCompressedVariableSynchronizerFactory(IParallelMng* pm, Ref<IDataCompressor> compressor);
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -148,7 +159,7 @@ class VariableSynchronizer::SyncMessage
     if (nb_var >= 2) {
       ScopedBuffer tmp_buf(m_variable_synchronizer_mng->_internalApi(), m_allocator);
       m_multi_dispatcher->setSynchronizeBuffer(tmp_buf.m_buffer);
-      m_multi_dispatcher->synchronize(m_variables);
+      m_synchronize_result = m_multi_dispatcher->synchronize(m_variables);
     }
     for (IVariable* var : m_variables)
       var->setIsSynchronized();
@@ -161,6 +172,32 @@ class VariableSynchronizer::SyncMessage
     m_dispatcher->beginSynchronize(data, is_compare_sync);
     return m_dispatcher->endSynchronize();
   }
+
+  /*!
+   * \brief Commence une synchronisation non bloquante.
+   *
+   * Le message ne doit contenir qu'une seule variable. Le buffer de
+   * synchronisation est conservé jusqu'à l'appel à endSynchronizeAsync().
+   */
+  void beginSynchronizeAsync()
+  {
+    if (m_variables.size() != 1)
+      ARCANE_FATAL("Asynchronous synchronization is only supported for one variable");
+    bool is_compare_sync = m_variable_synchronizer_mng->isSynchronizationComparisonEnabled();
+    m_async_buffer = std::make_unique<ScopedBuffer>(m_variable_synchronizer_mng->_internalApi(), m_allocator);
+    m_dispatcher->setSynchronizeBuffer(m_async_buffer->m_buffer);
+    m_dispatcher->beginSynchronize(m_data_list[0], is_compare_sync);
+  }
+
+  //! Termine une synchronisation commencée par beginSynchronizeAsync()
+  void endSynchronizeAsync()
+  {
+    m_synchronize_result = m_dispatcher->endSynchronize();
+    m_async_buffer.reset();
+    for (IVariable* var : m_variables)
+      var->setIsSynchronized();
+  }
+
   const DataSynchronizeResult& result() const { return m_synchronize_result; }
   VariableSynchronizerEventArgs& eventArgs() { return m_event_args; }
 
@@ -175,6 +212,8 @@ class VariableSynchronizer::SyncMessage
   UniqueArray<INumericDataInternal*> m_data_list;
   DataSynchronizeResult m_synchronize_result;
   IMemoryAllocator* m_allocator = nullptr;
+  //! Buffer utilisé pour la synchronisation non bloquante en cours
+  std::unique_ptr<ScopedBuffer> m_async_buffer;
 
  private:
 
@@ -182,6 +221,7 @@ class VariableSynchronizer::SyncMessage
   {
     m_variables.clear();
     m_data_list.clear();
+    m_synchronize_result = DataSynchronizeResult();
   }
 
   void _addVariable(IVariable* var)
@@ -194,6 +234,78 @@ class VariableSynchronizer::SyncMessage
   }
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Requête de synchronisation non bloquante.
+ *
+ * Le message associé est rendu au synchroniseur lors de l'appel à wait().
+ *
+ * Le synchroniseur conserve la liste des requêtes en cours. S'il est
+ * détruit avant l'appel à wait(), il termine lui-même la synchronisation
+ * et détache la requête qui ne fait alors plus référence à lui.
+ */
+class VariableSynchronizer::AsyncRequest
+: public IVariableSynchronizerRequest
+{
+ public:
+
+  AsyncRequest(VariableSynchronizer* var_syncer, SyncMessage* message, Real begin_time)
+  : m_variable_synchronizer(var_syncer)
+  , m_trace(var_syncer->traceMng())
+  , m_message(message)
+  , m_variable(message->variables()[0])
+  , m_begin_time(begin_time)
+  {
+  }
+  ~AsyncRequest() override
+  {
+    // Il est préférable d'appeler wait() explicitement car les erreurs
+    // ne peuvent pas être propagées par le destructeur.
+    if (!m_is_done)
+      waitNoThrow();
+  }
+
+ public:
+
+  IVariable* variable() const override { return m_variable; }
+  void wait() override
+  {
+    if (m_is_done)
+      return;
+    m_is_done = true;
+    VariableSynchronizer* var_syncer = m_variable_synchronizer;
+    m_variable_synchronizer = nullptr;
+    var_syncer->_endSynchronizeAsync(this, m_message, m_begin_time);
+  }
+  bool isDone() const override { return m_is_done; }
+
+  //! Appelle wait() en affichant les éventuelles erreurs au lieu de les propager
+  void waitNoThrow()
+  {
+    try {
+      wait();
+    }
+    catch (const Exception& ex) {
+      m_trace->pwarning() << "Error during asynchronous synchronization of variable '"
+                          << m_variable->fullName() << "' : " << ex.message();
+    }
+    catch (const std::exception& ex) {
+      m_trace->pwarning() << "Error during asynchronous synchronization of variable '"
+                          << m_variable->fullName() << "' : " << ex.what();
+    }
+  }
+
+ private:
+
+  VariableSynchronizer* m_variable_synchronizer = nullptr;
+  ITraceMng* m_trace = nullptr;
+  SyncMessage* m_message = nullptr;
+  IVariable* m_variable = nullptr;
+  Real m_begin_time = 0.0;
+  bool m_is_done = false;
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -208,6 +320,7 @@ VariableSynchronizer(IParallelMng* pm, const ItemGroup& group,
   if (!implementation_factory.get())
     implementation_factory = arcaneCreateSimpleVariableSynchronizerFactory(pm);
   m_implementation_factory = implementation_factory;
+  m_default_implementation_factory = implementation_factory;
 
   m_variable_synchronizer_mng = group.itemFamily()->mesh()->variableMng()->synchronizerMng();
 
@@ -223,6 +336,14 @@ VariableSynchronizer(IParallelMng* pm, const ItemGroup& group,
   }
 
   m_default_message = _buildMessage();
+
+  {
+    String s = platform::getEnvironmentVariable("ARCANE_SYNCHRONIZE_COMPRESSOR");
+    if (!s.null()) {
+      ServiceBuilder<IDataCompressor> sb(group.mesh()->handle().application());
+      setDataCompressor(sb.createReference(s));
+    }
+  }
 }
 
 /*---------------------------------------------------------------------------*/
@@ -231,8 +352,21 @@ VariableSynchronizer(IParallelMng* pm, const ItemGroup& group,
 VariableSynchronizer::
 ~VariableSynchronizer()
 {
+  // Termine les synchronisations non bloquantes en cours pour que les
+  // requêtes associées ne fassent plus référence à cette instance.
+  if (!m_pending_async_requests.empty()) {
+    pwarning() << "Destroying VariableSynchronizer group=" << m_item_group.name()
+               << " with " << m_pending_async_requests.size() << " pending asynchronous synchronizations";
+    UniqueArray<AsyncRequest*> requests(m_pending_async_requests);
+    for (AsyncRequest* r : requests)
+      r->waitNoThrow();
+  }
   delete m_sync_timer;
   delete m_default_message;
+  for (SyncMessage* m : m_async_messages)
+    delete m;
+  m_observer_pool.clear();
+  delete m_delta_synchronizer;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -272,6 +406,43 @@ _buildMessage()
   return new SyncMessage(bi, this, allocator);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizer::
+setDataCompressor(Ref<IDataCompressor> compressor)
+{
+  _checkNoPendingAsync("setDataCompressor");
+  if (compressor.get()) {
+    info(4) << "Using data compressor '" << compressor->name() << "' for synchronizer group=" << m_item_group.name();
+    m_implementation_factory = arcaneCreateCompressedVariableSynchronizerFactory(m_parallel_mng, compressor);
+  }
+  else
+    m_implementation_factory = m_default_implementation_factory;
+  m_data_compressor = compressor;
+  _rebuildMessages();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Recréé les messages après un changement d'implémentation.
+ */
+void VariableSynchronizer::
+_rebuildMessages()
+{
+  _setCurrentDevice();
+  delete m_default_message;
+  m_default_message = nullptr;
+  for (SyncMessage* m : m_async_messages)
+    delete m;
+  m_async_messages.clear();
+  m_free_async_messages.clear();
+
+  m_default_message = _buildMessage();
+  m_default_message->compute();
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -280,11 +451,21 @@ _buildMessage()
 void VariableSynchronizer::
 compute()
 {
+  _checkNoPendingAsync("compute");
+
   VariableSynchronizerComputeList computer(this);
   computer.compute();
 
   _setCurrentDevice();
   m_default_message->compute();
+  for (SyncMessage* m : m_async_messages)
+    m->compute();
+  // Les informations de synchronisation ont changé donc les valeurs
+  // conservées pour les synchronisations par différence ne sont plus valides.
+  if (m_delta_synchronizer)
+    m_delta_synchronizer->reset();
+  if (!m_inner_items.null())
+    _computeInnerAndBoundaryItems();
   if (m_is_verbose)
     info() << "End compute dispatcher Date=" << platform::getCurrentDateTime();
 }
@@ -324,7 +505,193 @@ _doSynchronize(SyncMessage* message)
   }
 
   // Fin de la synchro
-  _sendEndEvent(event_args);
+  Real elapsed_time = m_sync_timer->lastActivationTime();
+  _addProfilingInfo(message->variables(), message->result(), elapsed_time);
+  _sendEndEvent(event_args, elapsed_time);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Indique si \a var peut être synchronisée par différence.
+ *
+ * La comparaison avec les valeurs précédentes est faite sur l'hôte. Les
+ * variables dont les valeurs sont uniquement accessibles depuis un
+ * accélérateur sont donc synchronisées de manière classique.
+ */
+bool VariableSynchronizer::
+_isDeltaSynchronizationPossible(IVariable* var)
+{
+  Runner* runner = m_parallel_mng->_internalApi()->defaultRunner();
+  if (!runner)
+    return true;
+  INumericDataInternal* numapi = var->data()->_commonInternal()->numericData();
+  if (!numapi)
+    return true;
+  Accelerator::PointerAttribute attr;
+  runner->fillPointerAttribute(attr, numapi->memoryView().data());
+  if (attr.memoryType() != Accelerator::ePointerMemoryType::Device)
+    return true;
+  if (!m_has_warned_delta_device) {
+    m_has_warned_delta_device = true;
+    pwarning() << "Delta synchronization is not available for variable '" << var->fullName()
+               << "' because its values are in accelerator memory. Using full synchronization instead";
+  }
+  return false;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Synchronise \a var en n'envoyant que les valeurs modifiées.
+ *
+ * Les copies sont toujours effectuées sur l'hôte, même si le
+ * IParallelMng gère la mémoire des accélérateurs.
+ */
+void VariableSynchronizer::
+_synchronizeDelta(IVariable* var, Int64 delta_id)
+{
+  IParallelMng* pm = m_parallel_mng;
+  debug(Trace::High) << " Proc " << pm->commRank() << " DeltaSync variable " << var->fullName();
+  if (m_trace_sync) {
+    info() << " Synchronize delta variable " << var->fullName()
+           << " stack=" << platform::getStackTrace();
+  }
+
+  if (!m_delta_synchronizer) {
+    Ref<IBufferCopier> buffer_copier;
+    if (!m_item_group.isAllItems())
+      buffer_copier = makeRef<IBufferCopier>(new TableBufferCopier(m_item_group.localIdToIndex().get()));
+    else
+      buffer_copier = makeRef<IBufferCopier>(new DirectBufferCopier());
+    m_delta_synchronizer = new VariableDeltaSynchronizer(pm, m_sync_info, buffer_copier);
+    auto f = [this](IVariable* v) { m_delta_synchronizer->releaseVariable(v); };
+    m_variable_synchronizer_mng->_internalApi()->onDeltaSynchronizationReleased().attach(m_observer_pool, f);
+  }
+  VariableDeltaSynchronizer* ds = m_delta_synchronizer;
+
+  Timer::Phase tphase(pm->timeStats(), TP_Communication);
+
+  m_default_message->initialize(var);
+  VariableSynchronizerEventArgs& event_args = m_default_message->eventArgs();
+  _sendBeginEvent(event_args);
+
+  Int64 nb_sparse = ds->nbSparseMessage();
+  Int64 nb_dense = ds->nbDenseMessage();
+  Int64 sent_size = ds->sentSize();
+  Int64 full_size = ds->fullSize();
+  {
+    Timer::Sentry ts2(m_sync_timer);
+    ds->synchronize(var, delta_id);
+  }
+  var->setIsSynchronized();
+  m_variable_synchronizer_mng->_internalApi()->addDeltaSynchronizeStats(ds->nbSparseMessage() - nb_sparse,
+                                                                        ds->nbDenseMessage() - nb_dense,
+                                                                        ds->sentSize() - sent_size,
+                                                                        ds->fullSize() - full_size);
+
+  Real elapsed_time = m_sync_timer->lastActivationTime();
+  {
+    // Seule la taille des valeurs envoyées est connue pour ce mode.
+    DataSynchronizeResult result;
+    result.setSendSize(ds->sentSize() - sent_size);
+    result.setNbNeighbourRank(m_sync_info->size());
+    _addProfilingInfo(m_default_message->variables(), result, elapsed_time);
+  }
+  _sendEndEvent(event_args, elapsed_time);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Ref<IVariableSynchronizerRequest> VariableSynchronizer::
+synchronizeAsync(IVariable* var)
+{
+  ARCANE_CHECK_POINTER(var);
+
+  // Utilise un message différent pour chaque synchronisation en cours
+  // car chaque message possède son propre buffer et sa propre implémentation.
+  SyncMessage* message = nullptr;
+  if (m_free_async_messages.empty()) {
+    _setCurrentDevice();
+    message = _buildMessage();
+    message->compute();
+    m_async_messages.add(message);
+  }
+  else {
+    message = m_free_async_messages.back();
+    m_free_async_messages.popBack();
+  }
+  message->initialize(var);
+
+  IParallelMng* pm = m_parallel_mng;
+  debug(Trace::High) << " Proc " << pm->commRank() << " AsyncSync variable " << var->fullName();
+  if (m_trace_sync) {
+    info() << " Synchronize asynchronous variable " << var->fullName()
+           << " stack=" << platform::getStackTrace();
+  }
+
+  Timer::Phase tphase(pm->timeStats(), TP_Communication);
+  _setCurrentDevice();
+  _sendBeginEvent(message->eventArgs());
+  {
+    Timer::Sentry ts2(m_sync_timer);
+    message->beginSynchronizeAsync();
+  }
+  Real begin_time = m_sync_timer->lastActivationTime();
+  auto* request = new AsyncRequest(this, message, begin_time);
+  m_pending_async_requests.add(request);
+  return makeRef<IVariableSynchronizerRequest>(request);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizer::
+_endSynchronizeAsync(AsyncRequest* request, SyncMessage* message, Real begin_time)
+{
+  // Retire la requête de la liste avant de terminer la synchronisation
+  // pour ne pas la terminer une seconde fois en cas d'exception.
+  {
+    Int32 index = m_pending_async_requests.span().findFirst(request).value_or(-1);
+    if (index < 0)
+      ARCANE_FATAL("Asynchronous request is not pending for synchronizer of group '{0}'", m_item_group.name());
+    m_pending_async_requests.remove(index);
+  }
+  ITimeStats* ts = m_parallel_mng->timeStats();
+  Timer::Phase tphase(ts, TP_Communication);
+  _setCurrentDevice();
+  {
+    Timer::Sentry ts2(m_sync_timer);
+    message->endSynchronizeAsync();
+  }
+
+  VariableSynchronizerEventArgs& event_args = message->eventArgs();
+  if (m_variable_synchronizer_mng->isSynchronizationComparisonEnabled()) {
+    eDataSynchronizeCompareStatus s = message->result().compareStatus();
+    if (s == eDataSynchronizeCompareStatus::Different)
+      event_args.setCompareStatus(0, VariableSynchronizerEventArgs::CompareStatus::Different);
+    else if (s == eDataSynchronizeCompareStatus::Same)
+      event_args.setCompareStatus(0, VariableSynchronizerEventArgs::CompareStatus::Same);
+  }
+  // Le temps de la synchronisation ne comprend pas le temps passé
+  // entre le début et l'appel à wait().
+  Real elapsed_time = begin_time + m_sync_timer->lastActivationTime();
+  _addProfilingInfo(message->variables(), message->result(), elapsed_time);
+  _sendEndEvent(event_args, elapsed_time);
+  m_free_async_messages.add(message);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizer::
+_checkNoPendingAsync(const char* func_name)
+{
+  if (!m_pending_async_requests.empty())
+    ARCANE_FATAL("Can not call '{0}' for synchronizer of group '{1}' because there are {2}"
+                 " pending asynchronous synchronizations",
+                 func_name, m_item_group.name(), m_pending_async_requests.size());
 }
 
 /*---------------------------------------------------------------------------*/
@@ -333,6 +700,12 @@ _doSynchronize(SyncMessage* message)
 void VariableSynchronizer::
 synchronize(IVariable* var)
 {
+  Int64 delta_id = m_variable_synchronizer_mng->_internalApi()->deltaSynchronizationId(var);
+  if (delta_id != 0 && _isDeltaSynchronizationPossible(var)) {
+    _synchronizeDelta(var, delta_id);
+    return;
+  }
+
   m_default_message->initialize(var);
 
   IParallelMng* pm = m_parallel_mng;
@@ -393,8 +766,11 @@ void VariableSynchronizer::
 changeLocalIds(Int32ConstArrayView old_to_new_ids)
 {
   info(4) << "** VariableSynchronizer::changeLocalIds() group=" << m_item_group.name();
+  _checkNoPendingAsync("changeLocalIds");
   m_sync_info->changeLocalIds(old_to_new_ids);
   m_default_message->compute();
+  for (SyncMessage* m : m_async_messages)
+    m->compute();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -413,10 +789,14 @@ _canSynchronizeMulti(const VariableCollection& vars)
     return false;
   ItemGroup group;
   bool is_set = false;
+  IVariableSynchronizerMngInternal* sync_mng_api = m_variable_synchronizer_mng->_internalApi();
   for (VariableCollection::Enumerator ivar(vars); ++ivar;) {
     IVariable* var = *ivar;
     if (var->isPartial())
       return false;
+    // Les variables synchronisées par différence le sont une par une.
+    if (sync_mng_api->deltaSynchronizationId(var) != 0)
+      return false;
     ItemGroup var_group = var->itemGroup();
     if (!is_set) {
       group = var_group;
@@ -476,6 +856,74 @@ ghostItems(Int32 index)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+ItemGroup VariableSynchronizer::
+innerItems()
+{
+  _checkCreateInnerAndBoundaryItems();
+  return m_inner_items;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ItemGroup VariableSynchronizer::
+boundaryItems()
+{
+  _checkCreateInnerAndBoundaryItems();
+  return m_boundary_items;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizer::
+_checkCreateInnerAndBoundaryItems()
+{
+  if (!m_inner_items.null())
+    return;
+  IItemFamily* family = m_item_group.itemFamily();
+  m_inner_items = family->findGroup(m_item_group.name() + "_SyncInner", true);
+  m_boundary_items = family->findGroup(m_item_group.name() + "_SyncBoundary", true);
+  _computeInnerAndBoundaryItems();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule les entités propres internes et les entités propres partagées.
+ *
+ * Les entités partagées sont celles qui apparaissent dans au moins une
+ * des listes d'envoi des informations de synchronisation.
+ */
+void VariableSynchronizer::
+_computeInnerAndBoundaryItems()
+{
+  IItemFamily* family = m_item_group.itemFamily();
+  UniqueArray<bool> is_shared(family->maxLocalId(), false);
+  const DataSynchronizeBufferInfoList& send_info = m_sync_info->sendInfo();
+  Int32 nb_rank = m_sync_info->size();
+  for (Int32 i = 0; i < nb_rank; ++i)
+    for (Int32 lid : send_info.localIds(i))
+      is_shared[lid] = true;
+
+  UniqueArray<Int32> inner_ids;
+  UniqueArray<Int32> boundary_ids;
+  ENUMERATE_ITEM (iitem, m_item_group.own()) {
+    Int32 lid = iitem.itemLocalId();
+    if (is_shared[lid])
+      boundary_ids.add(lid);
+    else
+      inner_ids.add(lid);
+  }
+  m_inner_items.setItems(inner_ids);
+  m_boundary_items.setItems(boundary_ids);
+  info(4) << "VariableSynchronizer group=" << m_item_group.name()
+          << " nb_inner=" << inner_ids.size() << " nb_boundary=" << boundary_ids.size();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void VariableSynchronizer::
 _sendBeginEvent(VariableSynchronizerEventArgs& args)
 {
@@ -488,10 +936,8 @@ _sendBeginEvent(VariableSynchronizerEventArgs& args)
 /*---------------------------------------------------------------------------*/
 
 void VariableSynchronizer::
-_sendEndEvent(VariableSynchronizerEventArgs& args)
+_sendEndEvent(VariableSynchronizerEventArgs& args, Real elapsed_time)
 {
-  ARCANE_CHECK_POINTER(m_sync_timer);
-  Real elapsed_time = m_sync_timer->lastActivationTime();
   m_parallel_mng->stat()->add("Synchronize", elapsed_time, 1);
   args.setState(VariableSynchronizerEventArgs::State::EndSynchronize);
   args.setElapsedTime(elapsed_time);
@@ -501,6 +947,26 @@ _sendEndEvent(VariableSynchronizerEventArgs& args)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void VariableSynchronizer::
+_addProfilingInfo(ConstArrayView<IVariable*> vars, const DataSynchronizeResult& result,
+                  Real elapsed_time)
+{
+  IVariableSynchronizerMngInternal* sync_mng_api = m_variable_synchronizer_mng->_internalApi();
+  if (!sync_mng_api->isProfilingEnabled())
+    return;
+  VariableSynchronizeProfilingInfo info;
+  info.m_elapsed_time = elapsed_time;
+  info.m_copy_time = result.copyTime();
+  info.m_send_size = result.sendSize();
+  info.m_receive_size = result.receiveSize();
+  info.m_max_send_message_size = result.maxSendMessageSize();
+  info.m_nb_neighbour_rank = result.nbNeighbourRank();
+  sync_mng_api->addSynchronizeProfilingInfo(this, vars, info);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void VariableSynchronizer::
 _sendEvent(VariableSynchronizerEventArgs& args)
 {
@@ -17,15 +17,27 @@
 #include "arcane/utils/ValueConvert.h"
 #include "arcane/utils/FatalErrorException.h"
 #include "arcane/utils/OStringStream.h"
+#include "arcane/utils/JSONWriter.h"
+#include "arcane/utils/Math.h"
+#include "arcane/utils/MemoryView.h"
 #include "arcane/utils/internal/MemoryBuffer.h"
 
 #include "arcane/core/IVariableMng.h"
 #include "arcane/core/IParallelMng.h"
 #include "arcane/core/VariableSynchronizerEventArgs.h"
 #include "arcane/core/IVariable.h"
-
+#include "arcane/core/IVariableSynchronizer.h"
+#include "arcane/core/IItemFamily.h"
+#include "arcane/core/ItemGroup.h"
+#include "arcane/core/VariableCollection.h"
+#include "arcane/core/VariableStatusChangedEventArgs.h"
+#include "arcane/core/IData.h"
+#include "arcane/core/internal/IDataInternal.h"
+
+#include <algorithm>
 #include <map>
 #include <stack>
+#include <vector>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -33,6 +45,23 @@
 namespace Arcane
 {
 
+namespace
+{
+  //! Tâche concurrente associée à un thread pour les synchronisations différées
+  struct ConcurrentDeferredTask
+  {
+    const VariableSynchronizerMng* m_synchronizer_mng = nullptr;
+    Int32 m_task_index = -1;
+  };
+  /*!
+   * \brief Pile des tâches associées au thread courant.
+   *
+   * Il s'agit d'une pile car un thread en attente dans une tâche peut
+   * exécuter une autre tâche (par exemple celle d'un autre sous-domaine).
+   */
+  thread_local std::vector<ConcurrentDeferredTask> t_concurrent_deferred_tasks;
+} // namespace
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -243,6 +272,8 @@ VariableSynchronizerMng(IVariableMng* vm)
   }
   if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_SYNCHRONIZE_STATS", true))
     m_is_doing_stats = (v.value() != 0);
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_SYNCHRONIZE_PROFILING", true))
+    m_is_profiling = (v.value() != 0);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -261,6 +292,8 @@ void VariableSynchronizerMng::
 initialize()
 {
   m_stats->init();
+  auto f = [this](const VariableStatusChangedEventArgs& args) { _onVariableRemoved(args.variable()); };
+  m_variable_mng->onVariableRemoved().attach(m_observer_pool, f);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -277,12 +310,77 @@ dumpStats(std::ostream& ostr) const
     if (count > 0)
       ostr << ostr2.str();
   }
+  if (m_nb_deferred_flush > 0)
+    ostr << "DeferredSynchronize: nb_flush = " << m_nb_deferred_flush
+         << " nb_variable = " << m_nb_deferred_variable
+         << " nb_synchronize = " << m_nb_deferred_synchronize << "\n";
+  if (m_nb_delta_synchronize > 0)
+    ostr << "DeltaSynchronize: nb_synchronize = " << m_nb_delta_synchronize
+         << " nb_sparse_message = " << m_nb_delta_sparse_message
+         << " nb_dense_message = " << m_nb_delta_dense_message
+         << " sent_size = " << m_delta_sent_size
+         << " full_size = " << m_delta_full_size << "\n";
+  for (const auto& x : m_autotune_selections)
+    ostr << "SynchronizeAutoTune: size_class = " << x.first.first
+         << " implementation = " << x.first.second
+         << " nb_selection = " << x.second.first
+         << " mean_time = " << (x.second.second / x.second.first) << "\n";
   m_internal_api.dumpStats(ostr);
 }
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+namespace
+{
+  void _writeProfilingStats(JSONWriter& writer, const String& name,
+                            const VariableSynchronizerMng::ProfilingStats& x)
+  {
+    JSONWriter::Object o(writer);
+    writer.write("Name", name);
+    writer.write("NbSynchronize", x.m_nb_synchronize);
+    writer.write("NbVariable", x.m_nb_variable);
+    writer.write("NbMessage", x.m_nb_message);
+    writer.write("SendSize", x.m_send_size);
+    writer.write("ReceiveSize", x.m_receive_size);
+    writer.write("MaxSendMessageSize", x.m_max_send_message_size);
+    writer.write("ElapsedTime", x.m_elapsed_time);
+    writer.write("CopyTime", x.m_copy_time);
+    // Le temps qui n'est pas passé dans les recopies correspond
+    // essentiellement à l'attente des messages.
+    writer.write("WaitTime", math::max(x.m_elapsed_time - x.m_copy_time, 0.0));
+    // Rapport entre la taille du plus gros message et la taille moyenne
+    // des messages envoyés aux rangs voisins. Vaut 1.0 si tous les messages
+    // ont la même taille.
+    Real imbalance = 1.0;
+    if (x.m_sum_mean_message_size > 0.0)
+      imbalance = x.m_sum_max_message_size / x.m_sum_mean_message_size;
+    writer.write("NeighbourImbalance", imbalance);
+  }
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizerMng::
+dumpStatsJSON(JSONWriter& writer) const
+{
+  writer.write("IsProfiling", m_is_profiling);
+  writer.writeKey("Synchronizers");
+  writer.beginArray();
+  for (const auto& x : m_synchronizer_profiling)
+    _writeProfilingStats(writer, x.first, x.second);
+  writer.endArray();
+  writer.writeKey("Variables");
+  writer.beginArray();
+  for (const auto& x : m_variable_profiling)
+    _writeProfilingStats(writer, x.first, x.second);
+  writer.endArray();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void VariableSynchronizerMng::
 flushPendingStats()
 {
@@ -290,6 +388,183 @@ flushPendingStats()
     m_stats->flushPendingStats(m_parallel_mng);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizerMng::
+addDeferredSynchronization(IVariable* var)
+{
+  ARCANE_CHECK_POINTER(var);
+  if (!var->itemFamily())
+    ARCANE_FATAL("Variable '{0}' can not be synchronized because it is not a mesh variable", var->fullName());
+  if (m_is_concurrent_deferred) {
+    Int32 task_index = -1;
+    if (!t_concurrent_deferred_tasks.empty()) {
+      const ConcurrentDeferredTask& task = t_concurrent_deferred_tasks.back();
+      if (task.m_synchronizer_mng == this)
+        task_index = task.m_task_index;
+    }
+    if (task_index >= 0) {
+      // Seul le thread exécutant la tâche accède à cette liste.
+      UniqueArray<IVariable*>& task_variables = m_concurrent_deferred_variables[task_index];
+      if (!task_variables.contains(var))
+        task_variables.add(var);
+    }
+    else {
+      std::scoped_lock lock(m_concurrent_deferred_mutex);
+      UniqueArray<IVariable*>& other_variables = m_concurrent_deferred_variables.back();
+      if (!other_variables.contains(var))
+        other_variables.add(var);
+    }
+    return;
+  }
+  if (m_deferred_variables.contains(var))
+    return;
+  m_deferred_variables.add(var);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizerMng::
+_beginConcurrentDeferredSynchronizations(Int32 nb_task)
+{
+  if (m_is_concurrent_deferred)
+    ARCANE_FATAL("Concurrent deferred synchronizations are already active");
+  m_concurrent_deferred_variables.resize(nb_task + 1);
+  for (auto& x : m_concurrent_deferred_variables)
+    x.clear();
+  m_is_concurrent_deferred = true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Fusionne les synchronisations différées ajoutées par les tâches.
+ *
+ * Les listes sont fusionnées par indice de tâche croissant et les variables
+ * d'une même liste sont triées par nom complet. L'ordre obtenu ne dépend
+ * donc pas de l'ordre d'exécution des tâches et est le même sur tous les rangs.
+ */
+void VariableSynchronizerMng::
+_endConcurrentDeferredSynchronizations()
+{
+  if (!m_is_concurrent_deferred)
+    ARCANE_FATAL("Concurrent deferred synchronizations are not active");
+  m_is_concurrent_deferred = false;
+  for (auto& task_variables : m_concurrent_deferred_variables) {
+    std::sort(task_variables.begin(), task_variables.end(),
+              [](IVariable* a, IVariable* b) { return a->fullName() < b->fullName(); });
+    for (IVariable* var : task_variables)
+      if (!m_deferred_variables.contains(var))
+        m_deferred_variables.add(var);
+    task_variables.clear();
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Effectue les synchronisations différées.
+ *
+ * Les variables sont regroupées par synchroniseur en conservant l'ordre
+ * d'ajout pour que l'ordre des synchronisations soit le même sur tous les rangs.
+ * Pour chaque synchroniseur, les variables sont synchronisées via
+ * IVariableSynchronizer::synchronize(VariableCollection) ce qui permet
+ * d'envoyer un seul message par rang voisin.
+ */
+void VariableSynchronizerMng::
+flushDeferredSynchronizations()
+{
+  if (m_deferred_variables.empty())
+    return;
+
+  // Recopie la liste pour pouvoir ajouter des variables pendant les
+  // synchronisations (par exemple via les observateurs).
+  UniqueArray<IVariable*> variables(m_deferred_variables);
+  m_deferred_variables.clear();
+
+  std::vector<std::pair<IVariableSynchronizer*, VariableList>> sync_list;
+  for (IVariable* var : variables) {
+    IItemFamily* family = var->itemFamily();
+    IVariableSynchronizer* var_syncer = nullptr;
+    if (var->isPartial())
+      var_syncer = var->itemGroup().synchronizer();
+    else
+      var_syncer = family->allItemsSynchronizer();
+    auto iter = std::find_if(sync_list.begin(), sync_list.end(),
+                             [=](const auto& x) { return x.first == var_syncer; });
+    if (iter == sync_list.end()) {
+      sync_list.emplace_back(var_syncer, VariableList());
+      iter = sync_list.end() - 1;
+    }
+    iter->second.add(var);
+  }
+
+  for (auto& x : sync_list) {
+    IVariableSynchronizer* var_syncer = x.first;
+    VariableList& vars = x.second;
+    if (vars.count() == 1)
+      var_syncer->synchronize(vars.front());
+    else
+      var_syncer->synchronize(vars);
+  }
+
+  ++m_nb_deferred_flush;
+  m_nb_deferred_variable += variables.size();
+  m_nb_deferred_synchronize += static_cast<Int64>(sync_list.size());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizerMng::
+setDeltaSynchronization(IVariable* var, bool is_enabled)
+{
+  ARCANE_CHECK_POINTER(var);
+  if (!var->itemFamily())
+    ARCANE_FATAL("Variable '{0}' can not be synchronized because it is not a mesh variable", var->fullName());
+  if (!is_enabled) {
+    if (m_delta_variables.erase(var) != 0)
+      m_internal_api.onDeltaSynchronizationReleased().notify(var);
+    return;
+  }
+  if (m_delta_variables.find(var) == m_delta_variables.end())
+    m_delta_variables[var] = ++m_last_delta_id;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool VariableSynchronizerMng::
+isDeltaSynchronization(IVariable* var) const
+{
+  return m_delta_variables.find(var) != m_delta_variables.end();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizerMng::
+_onVariableRemoved(IVariable* var)
+{
+  if (m_delta_variables.erase(var) != 0)
+    m_internal_api.onDeltaSynchronizationReleased().notify(var);
+  // Supprime la variable des synchronisations différées pour ne pas
+  // conserver de pointeur sur une variable détruite.
+  for (Int32 i = 0, n = m_deferred_variables.size(); i < n; ++i)
+    if (m_deferred_variables[i] == var) {
+      m_deferred_variables.remove(i);
+      break;
+    }
+  for (auto& task_variables : m_concurrent_deferred_variables)
+    for (Int32 i = 0, n = task_variables.size(); i < n; ++i)
+      if (task_variables[i] == var) {
+        task_variables.remove(i);
+        break;
+      }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -398,6 +673,140 @@ releaseSynchronizeBuffer(IMemoryAllocator* allocator, MemoryBuffer* v)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+Int64 VariableSynchronizerMng::InternalApi::
+deltaSynchronizationId(IVariable* var) const
+{
+  const auto& delta_variables = m_synchronizer_mng->m_delta_variables;
+  auto x = delta_variables.find(var);
+  if (x == delta_variables.end())
+    return 0;
+  return x->second;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizerMng::InternalApi::
+addDeltaSynchronizeStats(Int64 nb_sparse_message, Int64 nb_dense_message,
+                         Int64 sent_size, Int64 full_size)
+{
+  VariableSynchronizerMng* sm = m_synchronizer_mng;
+  ++sm->m_nb_delta_synchronize;
+  sm->m_nb_delta_sparse_message += nb_sparse_message;
+  sm->m_nb_delta_dense_message += nb_dense_message;
+  sm->m_delta_sent_size += sent_size;
+  sm->m_delta_full_size += full_size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizerMng::InternalApi::
+beginConcurrentDeferredSynchronizations(Int32 nb_task)
+{
+  m_synchronizer_mng->_beginConcurrentDeferredSynchronizations(nb_task);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizerMng::InternalApi::
+endConcurrentDeferredSynchronizations()
+{
+  m_synchronizer_mng->_endConcurrentDeferredSynchronizations();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizerMng::InternalApi::
+enterConcurrentDeferredTask(Int32 task_index)
+{
+  t_concurrent_deferred_tasks.push_back({ m_synchronizer_mng, task_index });
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizerMng::InternalApi::
+exitConcurrentDeferredTask()
+{
+  if (t_concurrent_deferred_tasks.empty())
+    ARCANE_FATAL("No concurrent deferred task for the current thread");
+  t_concurrent_deferred_tasks.pop_back();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizerMng::InternalApi::
+addAutoTuneSelection(Int32 size_class, const String& name, Real time)
+{
+  auto& x = m_synchronizer_mng->m_autotune_selections[std::make_pair(size_class, name)];
+  ++x.first;
+  x.second += time;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Cumule les informations de profilage d'une synchronisation.
+ *
+ * Lorsque plusieurs variables sont synchronisées ensemble, le volume et les
+ * temps sont répartis entre les variables au prorata de la taille
+ * de leur type de donnée.
+ */
+void VariableSynchronizerMng::InternalApi::
+addSynchronizeProfilingInfo(IVariableSynchronizer* var_syncer, ConstArrayView<IVariable*> vars,
+                            const VariableSynchronizeProfilingInfo& info)
+{
+  VariableSynchronizerMng* sm = m_synchronizer_mng;
+  const Int32 nb_var = vars.size();
+  const Int32 nb_rank = info.m_nb_neighbour_rank;
+  Real mean_message_size = 0.0;
+  if (nb_rank > 0)
+    mean_message_size = static_cast<Real>(info.m_send_size) / static_cast<Real>(nb_rank);
+  Real max_message_size = static_cast<Real>(info.m_max_send_message_size);
+
+  auto add_info = [&](ProfilingStats& x, Real ratio) {
+    ++x.m_nb_synchronize;
+    x.m_nb_message += nb_rank;
+    x.m_elapsed_time += info.m_elapsed_time * ratio;
+    x.m_copy_time += info.m_copy_time * ratio;
+    x.m_send_size += static_cast<Int64>(static_cast<Real>(info.m_send_size) * ratio);
+    x.m_receive_size += static_cast<Int64>(static_cast<Real>(info.m_receive_size) * ratio);
+    x.m_max_send_message_size = math::max(x.m_max_send_message_size, info.m_max_send_message_size);
+    x.m_sum_max_message_size += max_message_size;
+    x.m_sum_mean_message_size += mean_message_size;
+    // Nombre de variables synchronisées en même temps
+    x.m_nb_variable += nb_var;
+  };
+
+  add_info(sm->m_synchronizer_profiling[var_syncer->itemGroup().fullName()], 1.0);
+
+  if (nb_var == 1) {
+    add_info(sm->m_variable_profiling[vars[0]->fullName()], 1.0);
+    return;
+  }
+
+  Int64 total_datatype_size = 0;
+  UniqueArray<Int32> datatype_sizes(nb_var);
+  for (Int32 i = 0; i < nb_var; ++i) {
+    INumericDataInternal* numapi = vars[i]->data()->_commonInternal()->numericData();
+    datatype_sizes[i] = (numapi) ? numapi->memoryView().datatypeSize() : 0;
+    total_datatype_size += datatype_sizes[i];
+  }
+  for (Int32 i = 0; i < nb_var; ++i) {
+    Real ratio = 1.0 / static_cast<Real>(nb_var);
+    if (total_datatype_size > 0)
+      ratio = static_cast<Real>(datatype_sizes[i]) / static_cast<Real>(total_datatype_size);
+    add_info(sm->m_variable_profiling[vars[i]->fullName()], ratio);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void VariableSynchronizerMng::InternalApi::
 dumpStats(std::ostream& ostr) const
 {
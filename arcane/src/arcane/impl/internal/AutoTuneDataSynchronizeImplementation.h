@@ -0,0 +1,94 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* AutoTuneDataSynchronizeImplementation.h                     (C) 2000-2023 */
+/*                                                                           */
+/* Choix automatique de l'implémentation de la synchronisation.              */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_IMPL_INTERNAL_AUTOTUNEDATASYNCHRONIZEIMPLEMENTATION_H
+#define ARCANE_IMPL_INTERNAL_AUTOTUNEDATASYNCHRONIZEIMPLEMENTATION_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/String.h"
+#include "arcane/utils/Ref.h"
+#include "arcane/utils/UniqueArray.h"
+
+#include "arcane/impl/IDataSynchronizeImplementation.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+class IVariableSynchronizerMngInternal;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Implémentation candidate pour le choix automatique de la synchronisation.
+ */
+class ARCANE_IMPL_EXPORT DataSynchronizeImplementationCandidate
+{
+ public:
+
+  DataSynchronizeImplementationCandidate() = default;
+  DataSynchronizeImplementationCandidate(const String& name, Ref<IDataSynchronizeImplementationFactory> factory)
+  : m_name(name)
+  , m_factory(factory)
+  {}
+
+ public:
+
+  const String& name() const { return m_name; }
+  Ref<IDataSynchronizeImplementationFactory> factory() const { return m_factory; }
+
+ private:
+
+  String m_name;
+  Ref<IDataSynchronizeImplementationFactory> m_factory;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Créé une fabrique choisissant automatiquement l'implémentation
+ * la plus rapide parmi \a candidates.
+ *
+ * Lors des premières synchronisations, les implémentations candidates sont
+ * utilisées à tour de rôle et le temps passé dans chacune d'elles est mesuré.
+ * Une fois que chaque implémentation a été utilisée \a nb_trial fois, on
+ * conserve celle dont le temps minimum (maximum sur l'ensemble des rangs)
+ * est le plus faible. Le choix est effectué par classe de taille de donnée
+ * (taille en octet d'une entité arrondie à la puissance de 2 supérieure)
+ * et est conservé pour toutes les instances créées par cette fabrique.
+ * Il est réinitialisé lorsque les informations de synchronisation
+ * changent, par exemple après un repartitionnement.
+ *
+ * Le choix effectué est transmis à \a sync_mng pour être affiché
+ * dans les statistiques.
+ *
+ * Toutes les implémentations candidates doivent pouvoir être utilisées
+ * avec le gestionnaire de parallélisme \a pm.
+ */
+extern "C++" ARCANE_IMPL_EXPORT Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateAutoTuneVariableSynchronizerFactory(IParallelMng* pm, IVariableSynchronizerMngInternal* sync_mng,
+                                                ConstArrayView<DataSynchronizeImplementationCandidate> candidates,
+                                                Int32 nb_trial);
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
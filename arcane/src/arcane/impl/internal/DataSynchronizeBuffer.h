@@ -121,6 +121,29 @@ class ARCANE_IMPL_EXPORT DataSynchronizeBufferBase
    */
   virtual void prepareSynchronize(Int32 datatype_size, bool is_compare_sync) = 0;
 
+  /*!
+   * \brief Temps (en seconde) passé dans les recopies depuis le dernier appel
+   * à prepareSynchronize().
+   *
+   * Ce temps comprend les appels à copySendAsync(), copyReceiveAsync() et barrier().
+   */
+  Real copyTime() const { return m_copy_time; }
+
+  //! Remplit dans \a result les informations de volume et de temps de la synchronisation
+  void fillProfilingInfo(DataSynchronizeResult& result) const;
+
+  //! Numéros locaux des entités partagées avec le \a index-ème rang
+  ConstArrayView<Int32> sendLocalIds(Int32 index) const { return m_share_buffer_info.localIds(index); }
+
+  //! Numéros locaux des entités fantômes du \a index-ème rang
+  ConstArrayView<Int32> receiveLocalIds(Int32 index) const { return m_ghost_buffer_info.localIds(index); }
+
+  //! Instance gérant les recopies entre les buffers et les données
+  IBufferCopier* bufferCopier() const { return m_buffer_copier.get(); }
+
+  //! Vues sur les valeurs des données à synchroniser
+  virtual ConstArrayView<MutableMemoryView> dataViews() const = 0;
+
  protected:
 
   void _allocateBuffers(Int32 datatype_size);
@@ -141,6 +164,8 @@ class ARCANE_IMPL_EXPORT DataSynchronizeBufferBase
 
   Int32 m_nb_rank = 0;
   bool m_is_compare_sync_values = false;
+  //! Temps cumulé des recopies pour la synchronisation en cours
+  Real m_copy_time = 0.0;
 
   //! Buffer contenant les données concaténées en envoi et réception
   Ref<MemoryBuffer> m_memory;
@@ -172,6 +197,7 @@ class ARCANE_IMPL_EXPORT SingleDataSynchronizeBuffer
   void setDataView(MutableMemoryView v) { m_data_view = v; }
   //! Zone mémoire contenant les valeurs de la donnée à synchroniser
   MutableMemoryView dataView() { return m_data_view; }
+  ConstArrayView<MutableMemoryView> dataViews() const override { return { 1, &m_data_view }; }
   void prepareSynchronize(Int32 datatype_size, bool is_compare_sync) override;
 
   /*!
@@ -215,6 +241,7 @@ class ARCANE_IMPL_EXPORT MultiDataSynchronizeBuffer
     m_data_views.resize(nb_data);
   }
   void setDataView(Int32 index, MutableMemoryView v) { m_data_views[index] = v; }
+  ConstArrayView<MutableMemoryView> dataViews() const override { return m_data_views.constView(); }
 
   void prepareSynchronize(Int32 datatype_size, bool is_compare_sync) override;
 
@@ -0,0 +1,162 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* EntryPointGraphScheduler.h                                  (C) 2000-2023 */
+/*                                                                           */
+/* Ordonnanceur en graphe de tâches des points d'entrée.                     */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_IMPL_INTERNAL_ENTRYPOINTGRAPHSCHEDULER_H
+#define ARCANE_IMPL_INTERNAL_ENTRYPOINTGRAPHSCHEDULER_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/TraceAccessor.h"
+#include "arcane/utils/UniqueArray.h"
+
+#include "arcane/core/ArcaneTypes.h"
+
+#include <atomic>
+#include <exception>
+#include <map>
+#include <memory>
+#include <vector>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+class IEntryPoint;
+class EntryPoint;
+class IVariableSynchronizerMngInternal;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Ordonnanceur en graphe de tâches des points d'entrée.
+ *
+ * A partir des dépendances sur les variables déclarées par les points
+ * d'entrée (IEntryPoint::addReadDepend() et IEntryPoint::addWriteDepend()),
+ * cette classe construit un graphe orienté acyclique dans lequel un point
+ * d'entrée dépend des points d'entrée qui le précèdent dans la liste et avec
+ * lesquels il est en conflit :
+ * - l'un des deux modifie une variable lue ou modifiée par l'autre,
+ * - les deux points d'entrée appartiennent au même module (ils peuvent
+ *   communiquer via les champs du module).
+ *
+ * Une variable lue qui possède une fonction de recalcul est considérée comme
+ * modifiée et les variables dont elle dépend (IVariable::dependInfos())
+ * sont considérées comme lues.
+ *
+ * Lors de l'exécution, un point d'entrée est lancé dès que tous ceux dont
+ * il dépend sont terminés. Les points d'entrée indépendants sont exécutés en
+ * concurrence via TaskFactory.
+ *
+ * Les points d'entrée exécutés en concurrence ne doivent pas effectuer
+ * d'opérations collectives (synchronisations, réductions, ...) car leur
+ * ordre d'exécution n'est pas le même sur tous les rangs. Ils peuvent par
+ * contre utiliser les synchronisations différées: pendant execute(), les
+ * variables sont conservées pour chaque point d'entrée puis fusionnées dans
+ * l'ordre des points d'entrée (voir
+ * IVariableSynchronizerMngInternal::beginConcurrentDeferredSynchronizations()).
+ */
+class ARCANE_IMPL_EXPORT EntryPointGraphScheduler
+: public TraceAccessor
+{
+  class Node
+  {
+   public:
+
+    EntryPoint* m_entry_point = nullptr;
+    //! Indices des points d'entrée qui dépendent de celui-ci
+    UniqueArray<Int32> m_successors;
+    //! Nombre de points d'entrée dont dépend celui-ci
+    Int32 m_nb_predecessor = 0;
+  };
+
+  //! Graphe d'une liste de points d'entrée
+  class Graph
+  {
+   public:
+
+    UniqueArray<Node> m_nodes;
+    UniqueArray<Int32> m_roots;
+    Int32 m_nb_level = 0;
+  };
+
+ public:
+
+  /*!
+   * \brief Construit un ordonnanceur.
+   *
+   * \a sync_mng est le gestionnaire des synchronisations différées
+   * des points d'entrée. Il peut être nul.
+   */
+  EntryPointGraphScheduler(ITraceMng* tm, IVariableSynchronizerMngInternal* sync_mng);
+
+ public:
+
+  //! Indique si \a ep peut être ordonnancé par cette classe
+  static bool isSchedulable(IEntryPoint* ep);
+
+  /*!
+   * \brief Construit le graphe pour la liste \a entry_points.
+   *
+   * Les graphes sont conservés pour chaque liste de points d'entrée et ne
+   * sont donc construits qu'une seule fois même si plusieurs listes
+   * sont utilisées alternativement. Tous les points d'entrée de la liste
+   * doivent vérifier isSchedulable().
+   */
+  void build(ConstArrayView<IEntryPoint*> entry_points);
+
+  /*!
+   * \brief Exécute les points d'entrée du graphe.
+   *
+   * Si un point d'entrée lève une exception, les points d'entrée qui n'ont
+   * pas encore commencé ne sont pas exécutés et l'exception du premier
+   * point d'entrée (dans l'ordre de la liste) ayant échoué est relancée.
+   */
+  void execute();
+
+  //! Nombre de points d'entrée du graphe courant
+  Int32 nbEntryPoint() const { return (m_current_graph) ? m_current_graph->m_nodes.size() : 0; }
+
+  //! Nombre de niveaux du graphe courant (longueur du chemin critique)
+  Int32 nbLevel() const { return (m_current_graph) ? m_current_graph->m_nb_level : 0; }
+
+  //! Nombre de graphes conservés
+  Int32 nbGraph() const { return static_cast<Int32>(m_graphs.size()); }
+
+ private:
+
+  IVariableSynchronizerMngInternal* m_synchronizer_mng = nullptr;
+  //! Graphes déjà construits indexés par la liste de leurs points d'entrée
+  std::map<std::vector<IEntryPoint*>, std::unique_ptr<Graph>> m_graphs;
+  //! Graphe utilisé par execute()
+  Graph* m_current_graph = nullptr;
+  std::unique_ptr<std::atomic<Int32>[]> m_nb_remaining;
+  Int32 m_nb_remaining_size = 0;
+  std::vector<std::exception_ptr> m_exceptions;
+  std::atomic<bool> m_has_error = false;
+
+ private:
+
+  void _buildGraph(Graph& graph, ConstArrayView<IEntryPoint*> entry_points);
+  void _executeNode(Int32 index);
+  void _executeNodes(ConstArrayView<Int32> indexes);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
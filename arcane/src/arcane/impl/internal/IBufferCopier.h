@@ -54,6 +54,12 @@ class IBufferCopier
   //! Bloque tant que les copies ne sont pas terminées.
   virtual void barrier() = 0;
 
+  /*!
+   * \brief Remplit \a data_indexes avec les indices dans les valeurs de la
+   * donnée correspondants aux numéros locaux \a indexes.
+   */
+  virtual void fillDataIndexes(Array<Int32>& data_indexes, Int32ConstArrayView indexes) = 0;
+
  public:
 
   virtual void setRunQueue(RunQueue* queue) = 0;
@@ -85,6 +91,10 @@ class DirectBufferCopier
   }
 
   void barrier() override;
+  void fillDataIndexes(Array<Int32>& data_indexes, Int32ConstArrayView indexes) override
+  {
+    data_indexes.copy(indexes);
+  }
   void setRunQueue(RunQueue* queue) override { m_queue = queue; }
 
  private:
@@ -122,6 +132,10 @@ class TableBufferCopier
     m_base_copier.copyToBufferAsync(final_indexes, buffer, var_value);
   }
   void barrier() override { m_base_copier.barrier(); }
+  void fillDataIndexes(Array<Int32>& data_indexes, Int32ConstArrayView indexes) override
+  {
+    _buildFinalIndexes(data_indexes, indexes);
+  }
 
   void setRunQueue(RunQueue* queue) override { m_base_copier.setRunQueue(queue); }
 
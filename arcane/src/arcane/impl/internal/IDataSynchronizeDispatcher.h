@@ -153,7 +153,12 @@ class ARCANE_IMPL_EXPORT IDataSynchronizeMultiDispatcher
    * Il faut appeler cette méthode avant synchronize().
    */
   virtual void setSynchronizeBuffer(Ref<MemoryBuffer> buffer) =0;
-  virtual void synchronize(ConstArrayView<IVariable*> vars) = 0;
+  /*!
+   * \brief Synchronise les variables \a vars.
+   *
+   * Le résultat contient les informations de volume et de temps de la synchronisation.
+   */
+  virtual DataSynchronizeResult synchronize(ConstArrayView<IVariable*> vars) = 0;
 
  public:
 
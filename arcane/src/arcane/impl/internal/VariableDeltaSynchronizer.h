@@ -0,0 +1,147 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* VariableDeltaSynchronizer.h                                 (C) 2000-2023 */
+/*                                                                           */
+/* Synchronisation des variables par envoi des seules valeurs modifiées.     */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_IMPL_INTERNAL_VARIABLEDELTASYNCHRONIZER_H
+#define ARCANE_IMPL_INTERNAL_VARIABLEDELTASYNCHRONIZER_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/TraceAccessor.h"
+#include "arcane/utils/UniqueArray.h"
+#include "arcane/utils/Ref.h"
+
+#include "arcane/core/ArcaneTypes.h"
+#include "arcane/core/Parallel.h"
+
+#include <map>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+class DataSynchronizeInfo;
+class IBufferCopier;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Synchronisation d'une variable par envoi des seules valeurs modifiées.
+ *
+ * Pour chaque variable, on conserve les valeurs des entités partagées
+ * envoyées lors de la précédente synchronisation ainsi que les valeurs
+ * des entités fantômes reçues. Lors d'une synchronisation, on compare les
+ * valeurs courantes des entités partagées avec celles envoyées précédemment
+ * et on n'envoie que les couples (indice, valeur) qui ont changé.
+ *
+ * Si la proportion de valeurs modifiées pour un rang dépasse threshold(),
+ * toutes les valeurs sont envoyées pour ce rang. C'est aussi le cas lors de la
+ * première synchronisation et après un appel à reset().
+ *
+ * Le récepteur applique les modifications à sa copie des valeurs reçues
+ * puis recopie l'ensemble de ces valeurs dans les entités fantômes. Les
+ * valeurs des entités fantômes sont donc toujours identiques à celles qu'on
+ * aurait obtenues avec une synchronisation classique.
+ *
+ * Les messages sont échangés en deux temps (taille puis contenu) avec des
+ * buffers conservés entre les synchronisations. Les comparaisons et les
+ * recopies sont effectuées sur l'hôte : les valeurs de la variable doivent
+ * donc être accessibles depuis l'hôte.
+ */
+class ARCANE_IMPL_EXPORT VariableDeltaSynchronizer
+: public TraceAccessor
+{
+  class VariableState;
+
+ public:
+
+  VariableDeltaSynchronizer(IParallelMng* pm, Ref<DataSynchronizeInfo> sync_info,
+                            Ref<IBufferCopier> copier);
+  ~VariableDeltaSynchronizer();
+
+ public:
+
+  /*!
+   * \brief Synchronise la variable \a var.
+   *
+   * \a delta_id est l'identifiant associé à la variable par le gestionnaire
+   * de synchronisation. Si cet identifiant change, les valeurs de
+   * référence de la variable sont invalidées.
+   */
+  void synchronize(IVariable* var, Int64 delta_id);
+
+  /*!
+   * \brief Invalide les valeurs de référence de toutes les variables.
+   *
+   * Il faut appeler cette méthode lorsque les informations de synchronisation
+   * changent. Cette opération doit être collective.
+   */
+  void reset();
+
+  //! Libère les valeurs de référence conservées pour la variable \a var
+  void releaseVariable(IVariable* var);
+
+  //! Proportion de valeurs modifiées au-delà de laquelle on envoie toutes les valeurs
+  Real threshold() const { return m_threshold; }
+
+  //! Nombre de messages envoyés avec uniquement les valeurs modifiées
+  Int64 nbSparseMessage() const { return m_nb_sparse_message; }
+  //! Nombre de messages envoyés avec toutes les valeurs
+  Int64 nbDenseMessage() const { return m_nb_dense_message; }
+  //! Taille (en octet) des valeurs envoyées
+  Int64 sentSize() const { return m_sent_size; }
+  //! Taille (en octet) qu'auraient eu les valeurs envoyées avec une synchronisation classique
+  Int64 fullSize() const { return m_full_size; }
+
+ private:
+
+  IParallelMng* m_parallel_mng = nullptr;
+  Ref<DataSynchronizeInfo> m_sync_info;
+  Ref<IBufferCopier> m_buffer_copier;
+  std::map<IVariable*, VariableState*> m_states;
+  Real m_threshold = -1.0;
+  //! Valeurs courantes des entités partagées
+  UniqueArray<Byte> m_current_send_values;
+  UniqueArray<Int32> m_changed_indexes;
+  UniqueArray<Byte> m_changed_values;
+  //! Message à envoyer à chaque rang
+  UniqueArray<UniqueArray<Byte>> m_send_buffers;
+  //! Message reçu de chaque rang
+  UniqueArray<UniqueArray<Byte>> m_receive_buffers;
+  UniqueArray<Int64> m_send_sizes;
+  UniqueArray<Int64> m_receive_sizes;
+  UniqueArray<Parallel::Request> m_requests;
+  Int64 m_nb_sparse_message = 0;
+  Int64 m_nb_dense_message = 0;
+  Int64 m_sent_size = 0;
+  Int64 m_full_size = 0;
+
+ private:
+
+  VariableState* _getState(IVariable* var, Int64 delta_id);
+  Int64 _fillSendMessage(Array<Byte>& buffer, Span<const Byte> current_values,
+                         Span<const Byte> old_values, bool has_old_values, Int32 datatype_size);
+  void _readReceiveMessage(Span<const Byte> buffer, Span<Byte> values,
+                           bool has_old_values, Int32 datatype_size, Int32 rank);
+  void _exchangeMessages();
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
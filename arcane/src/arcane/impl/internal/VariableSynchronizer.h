@@ -36,6 +36,7 @@ namespace Arcane
 class Timer;
 class INumericDataInternal;
 class DataSynchronizeResult;
+class VariableDeltaSynchronizer;
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -53,6 +54,7 @@ class ARCANE_IMPL_EXPORT VariableSynchronizer
 {
   friend class VariableSynchronizerComputeList;
   class SyncMessage;
+  class AsyncRequest;
 
  public:
 
@@ -77,12 +79,18 @@ class ARCANE_IMPL_EXPORT VariableSynchronizer
 
   void synchronize(VariableCollection vars) override;
 
+  Ref<IVariableSynchronizerRequest> synchronizeAsync(IVariable* var) override;
+
   Int32ConstArrayView communicatingRanks() override;
 
   Int32ConstArrayView sharedItems(Int32 index) override;
 
   Int32ConstArrayView ghostItems(Int32 index) override;
 
+  ItemGroup innerItems() override;
+
+  ItemGroup boundaryItems() override;
+
   void synchronizeData(IData* data) override;
 
   EventObservable<const VariableSynchronizerEventArgs&>& onSynchronized() override
@@ -90,6 +98,10 @@ class ARCANE_IMPL_EXPORT VariableSynchronizer
     return m_on_synchronized;
   }
 
+  void setDataCompressor(Ref<IDataCompressor> compressor) override;
+
+  Ref<IDataCompressor> dataCompressor() const override { return m_data_compressor; }
+
  public:
 
   IVariableSynchronizerMng* synchronizeMng() const { return m_variable_synchronizer_mng; }
@@ -106,9 +118,27 @@ class ARCANE_IMPL_EXPORT VariableSynchronizer
   bool m_trace_sync = false;
   EventObservable<const VariableSynchronizerEventArgs&> m_on_synchronized;
   Ref<IDataSynchronizeImplementationFactory> m_implementation_factory;
+  //! Fabrique utilisée lorsque les messages ne sont pas compressés
+  Ref<IDataSynchronizeImplementationFactory> m_default_implementation_factory;
+  Ref<IDataCompressor> m_data_compressor;
   IVariableSynchronizerMng* m_variable_synchronizer_mng = nullptr;
   SyncMessage* m_default_message = nullptr;
   Runner* m_runner = nullptr;
+  //! Messages créés pour les synchronisations non bloquantes
+  UniqueArray<SyncMessage*> m_async_messages;
+  //! Messages disponibles pour les synchronisations non bloquantes
+  UniqueArray<SyncMessage*> m_free_async_messages;
+  //! Synchronisations non bloquantes en cours
+  UniqueArray<AsyncRequest*> m_pending_async_requests;
+  //! Entités propres non partagées (créé lors du premier appel à innerItems())
+  ItemGroup m_inner_items;
+  //! Entités propres partagées (créé lors du premier appel à boundaryItems())
+  ItemGroup m_boundary_items;
+  //! Gestion des synchronisations par différence (créé à la première utilisation)
+  VariableDeltaSynchronizer* m_delta_synchronizer = nullptr;
+  //! Indique si on a déjà signalé qu'une variable sur accélérateur ne peut pas être synchronisée par différence
+  bool m_has_warned_delta_device = false;
+  EventObserverPool m_observer_pool;
 
  private:
 
@@ -117,11 +147,20 @@ class ARCANE_IMPL_EXPORT VariableSynchronizer
   DataSynchronizeResult _synchronize(INumericDataInternal* data, bool is_compare_sync);
   SyncMessage* _buildMessage();
   void _sendBeginEvent(VariableSynchronizerEventArgs& args);
-  void _sendEndEvent(VariableSynchronizerEventArgs& args);
+  void _sendEndEvent(VariableSynchronizerEventArgs& args, Real elapsed_time);
+  void _addProfilingInfo(ConstArrayView<IVariable*> vars, const DataSynchronizeResult& result,
+                         Real elapsed_time);
   void _sendEvent(VariableSynchronizerEventArgs& args);
   void _checkCreateTimer();
   void _doSynchronize(SyncMessage* message);
   void _setCurrentDevice();
+  void _endSynchronizeAsync(AsyncRequest* request, SyncMessage* message, Real begin_time);
+  void _checkNoPendingAsync(const char* func_name);
+  void _checkCreateInnerAndBoundaryItems();
+  void _computeInnerAndBoundaryItems();
+  void _synchronizeDelta(IVariable* var, Int64 delta_id);
+  bool _isDeltaSynchronizationPossible(IVariable* var);
+  void _rebuildMessages();
 };
 
 /*---------------------------------------------------------------------------*/
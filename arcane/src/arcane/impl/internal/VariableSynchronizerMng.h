@@ -17,6 +17,10 @@
 
 #include "arcane/utils/TraceAccessor.h"
 #include "arcane/utils/Event.h"
+#include "arcane/utils/UniqueArray.h"
+
+#include <map>
+#include <mutex>
 
 #include "arcane/core/IVariableSynchronizerMng.h"
 #include "arcane/core/internal/IVariableSynchronizerMngInternal.h"
@@ -44,6 +48,26 @@ class ARCANE_IMPL_EXPORT VariableSynchronizerMng
 
  public:
 
+  //! Informations de profilage cumulées pour un synchroniseur ou une variable
+  class ProfilingStats
+  {
+   public:
+
+    Int64 m_nb_synchronize = 0;
+    //! Nombre cumulé de variables synchronisées lors de chaque synchronisation
+    Int64 m_nb_variable = 0;
+    Int64 m_nb_message = 0;
+    Real m_elapsed_time = 0.0;
+    Real m_copy_time = 0.0;
+    Int64 m_send_size = 0;
+    Int64 m_receive_size = 0;
+    Int64 m_max_send_message_size = 0;
+    //! Somme pour chaque synchronisation de la taille du plus gros message
+    Real m_sum_max_message_size = 0.0;
+    //! Somme pour chaque synchronisation de la taille moyenne des messages
+    Real m_sum_mean_message_size = 0.0;
+  };
+
   class InternalApi
   : public TraceAccessor
   , public IVariableSynchronizerMngInternal
@@ -59,6 +83,22 @@ class ARCANE_IMPL_EXPORT VariableSynchronizerMng
 
     Ref<MemoryBuffer> createSynchronizeBuffer(IMemoryAllocator* allocator) override;
     void releaseSynchronizeBuffer(IMemoryAllocator* allocator, MemoryBuffer* v) override;
+    Int64 deltaSynchronizationId(IVariable* var) const override;
+    void addDeltaSynchronizeStats(Int64 nb_sparse_message, Int64 nb_dense_message,
+                                  Int64 sent_size, Int64 full_size) override;
+    EventObservable<IVariable*>& onDeltaSynchronizationReleased() override
+    {
+      return m_on_delta_synchronization_released;
+    }
+    void beginConcurrentDeferredSynchronizations(Int32 nb_task) override;
+    void endConcurrentDeferredSynchronizations() override;
+    void enterConcurrentDeferredTask(Int32 task_index) override;
+    void exitConcurrentDeferredTask() override;
+    void addAutoTuneSelection(Int32 size_class, const String& name, Real time) override;
+    bool isProfilingEnabled() const override { return m_synchronizer_mng->m_is_profiling; }
+    void addSynchronizeProfilingInfo(IVariableSynchronizer* var_syncer,
+                                     ConstArrayView<IVariable*> vars,
+                                     const VariableSynchronizeProfilingInfo& info) override;
 
    public:
 
@@ -68,6 +108,7 @@ class ARCANE_IMPL_EXPORT VariableSynchronizerMng
 
     VariableSynchronizerMng* m_synchronizer_mng = nullptr;
     BufferList* m_buffer_list = nullptr;
+    EventObservable<IVariable*> m_on_delta_synchronization_released;
   };
 
  public:
@@ -88,7 +129,13 @@ class ARCANE_IMPL_EXPORT VariableSynchronizerMng
   bool isSynchronizationComparisonEnabled() const final { return m_synchronize_compare_level > 0; }
 
   void dumpStats(std::ostream& ostr) const override;
+  void dumpStatsJSON(JSONWriter& writer) const override;
   void flushPendingStats() override;
+  void addDeferredSynchronization(IVariable* var) override;
+  void flushDeferredSynchronizations() override;
+  Int32 nbDeferredSynchronization() const override { return m_deferred_variables.size(); }
+  void setDeltaSynchronization(IVariable* var, bool is_enabled) override;
+  bool isDeltaSynchronization(IVariable* var) const override;
   IVariableSynchronizerMngInternal* _internalApi() override { return &m_internal_api; }
   bool isDoingStats() const { return m_is_doing_stats || m_synchronize_compare_level > 0; }
 
@@ -101,6 +148,54 @@ class ARCANE_IMPL_EXPORT VariableSynchronizerMng
   VariableSynchronizerStats* m_stats = nullptr;
   Int32 m_synchronize_compare_level = 0;
   bool m_is_doing_stats = false;
+  //! Liste des variables dont la synchronisation est différée
+  UniqueArray<IVariable*> m_deferred_variables;
+  //! Indique si des tâches concurrentes peuvent ajouter des synchronisations différées
+  bool m_is_concurrent_deferred = false;
+  /*!
+   * \brief Synchronisations différées ajoutées par chaque tâche concurrente.
+   *
+   * La dernière liste contient les variables ajoutées depuis un thread
+   * qui n'est associé à aucune tâche.
+   */
+  UniqueArray<UniqueArray<IVariable*>> m_concurrent_deferred_variables;
+  //! Verrou pour la dernière liste de m_concurrent_deferred_variables
+  std::mutex m_concurrent_deferred_mutex;
+  //! Nombre d'appels à flushDeferredSynchronizations() ayant effectué des synchronisations
+  Int64 m_nb_deferred_flush = 0;
+  //! Nombre total de variables synchronisées de manière différée
+  Int64 m_nb_deferred_variable = 0;
+  //! Nombre total de synchronisations effectuées pour les variables différées
+  Int64 m_nb_deferred_synchronize = 0;
+  //! Identifiant de synchronisation par différence des variables pour lesquelles ce mode est actif
+  std::map<IVariable*, Int64> m_delta_variables;
+  //! Dernier identifiant de synchronisation par différence attribué
+  Int64 m_last_delta_id = 0;
+  //! Nombre de synchronisations par différence
+  Int64 m_nb_delta_synchronize = 0;
+  //! Nombre de messages ne contenant que les valeurs modifiées
+  Int64 m_nb_delta_sparse_message = 0;
+  //! Nombre de messages contenant toutes les valeurs
+  Int64 m_nb_delta_dense_message = 0;
+  //! Taille (en octet) des valeurs envoyées lors des synchronisations par différence
+  Int64 m_delta_sent_size = 0;
+  //! Taille (en octet) qu'auraient eu les valeurs envoyées avec une synchronisation classique
+  Int64 m_delta_full_size = 0;
+  //! Nombre de choix et temps cumulé de chaque implémentation par classe de taille lors de la sélection automatique
+  std::map<std::pair<Int32, String>, std::pair<Int32, Real>> m_autotune_selections;
+  //! Indique si on collecte les informations de profilage des synchronisations
+  bool m_is_profiling = false;
+  //! Informations de profilage par synchroniseur (nom du groupe associé)
+  std::map<String, ProfilingStats> m_synchronizer_profiling;
+  //! Informations de profilage par variable
+  std::map<String, ProfilingStats> m_variable_profiling;
+  EventObserverPool m_observer_pool;
+
+ private:
+
+  void _onVariableRemoved(IVariable* var);
+  void _beginConcurrentDeferredSynchronizations(Int32 nb_task);
+  void _endConcurrentDeferredSynchronizations();
 };
 
 /*---------------------------------------------------------------------------*/
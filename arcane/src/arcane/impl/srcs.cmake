@@ -33,6 +33,9 @@ set( ARCANE_SOURCES
   DataSynchronizeInfo.cc
   DataSynchronizeBuffer.cc
   DataSynchronizeDispatcher.cc
+  CompressedDataSynchronizeImplementation.cc
+  AutoTuneDataSynchronizeImplementation.cc
+  EntryPointGraphScheduler.cc
   EntryPointMng.cc
   ExecutionStatsDumper.h
   ExecutionStatsDumper.cc
@@ -99,6 +102,7 @@ set( ARCANE_SOURCES
   VariableSynchronizer.cc
   VariableSynchronizerMng.cc
   VariableSynchronizerComputeList.cc
+  VariableDeltaSynchronizer.cc
   NullPhysicalUnitSystemService.cc
   TraceMngPolicy.cc
   GlibDynamicLibraryLoader.cc
@@ -137,6 +141,7 @@ set( ARCANE_SOURCES
 
   internal/ArcaneMainExecInfo.h
   internal/DataSynchronizeBuffer.h
+  internal/EntryPointGraphScheduler.h
   internal/IDataSynchronizeDispatcher.h
   internal/IBufferCopier.h
   internal/LegacyMeshBuilder.h
@@ -151,6 +156,7 @@ set( ARCANE_SOURCES
   internal/VariableSynchronizer.h
   internal/VariableSynchronizerMng.h
   internal/VariableSynchronizerComputeList.h
+  internal/VariableDeltaSynchronizer.h
   )
 
 if (ARCANE_HAS_ACCELERATOR_API)
@@ -152,18 +152,11 @@ void
 DoFFamily::
 _printInfos(Integer nb_added)
 {
-  Integer nb_in_map = 0;
-  for( auto i : itemsMap().buckets() ){
-    for( ItemInternalMap::Data* nbid = i; nbid; nbid = nbid->next() ){
-      ++nb_in_map;
-    }
-  }
-
   info() << "DoFFamily: added=" << nb_added
          << " nb_internal=" << infos().m_internals.size()
          << " nb_free=" << infos().m_free_internals.size()
-         << " map_nb_bucket=" << itemsMap().buckets().size()
-         << " map_size=" << nb_in_map;
+         << " map_capacity=" << itemsMap().capacity()
+         << " map_size=" << itemsMap().count();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -174,10 +167,7 @@ DoFFamily::
 preAllocate(Integer nb_item)
 {
   // Copy paste de particle, pas utilise pour l'instant
-  Integer nb_hash = itemsMap().buckets().size();
-  Integer wanted_size = 2*(nb_item+infos().nbItem());
-  if (nb_hash<wanted_size)
-    itemsMap().resize(wanted_size,true);
+  itemsMap().reserve(nb_item+infos().nbItem());
 
 }
 
@@ -235,6 +235,7 @@ DynamicMesh(ISubDomain* sub_domain,const MeshBuildInfo& mbi, bool is_submesh)
  
   m_properties->setBool("sort",true);
   m_properties->setBool("compact",true);
+  m_properties->setReal("compact-incremental-threshold",0.0);
   m_properties->setBool("dump",true);
   m_properties->setBool("display-stats",true);
   m_properties->setInt32("mesh-version",1);
@@ -301,6 +302,13 @@ DynamicMesh(ISubDomain* sub_domain,const MeshBuildInfo& mbi, bool is_submesh)
   // de Arcane (juin 2023). A supprimer avant fin 2023.
   if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_NO_SAVE_NEED_COMPACT", true))
     m_do_not_save_need_compact = v.value();
+
+  // Seuil de fragmentation en dessous duquel le compactage est incrémental.
+  // Ce dernier n'est utilisé que si les entités ne sont pas triées.
+  if (auto v = Convert::Type<Real>::tryParseFromEnvironment("ARCANE_MESH_COMPACT_INCREMENTAL_THRESHOLD", true))
+    m_properties->setReal("compact-incremental-threshold",v.value());
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_MESH_SORT", true))
+    m_properties->setBool("sort",v.value()!=0);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -925,7 +933,9 @@ allocate(UnstructuredMeshAllocateBuildInfo& build_info)
 {
   auto* x = build_info._internal();
   setDimension(x->meshDimension());
+  m_mesh_builder->setUseMultiThreading(x->isUseMultiThreading());
   allocateCells(x->nbCell(),x->cellsInfos(),true);
+  m_mesh_builder->setUseMultiThreading(false);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -2678,6 +2688,7 @@ _compactItems(bool do_sort,bool compact_variables_and_groups)
 
   try{
     compacter->setSorted(do_sort);
+    compacter->setIncrementalThreshold(m_properties->getRealWithDefault("compact-incremental-threshold",0.0));
     compacter->_setCompactVariablesAndGroups(compact_variables_and_groups);
 
     compacter->doAllActions();
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* DynamicMeshIncrementalBuilder.cc                            (C) 2000-2022 */
+/* DynamicMeshIncrementalBuilder.cc                            (C) 2000-2023 */
 /*                                                                           */
 /* Construction d'un maillage de manière incrémentale.                       */
 /*---------------------------------------------------------------------------*/
@@ -16,6 +16,7 @@
 #include "arcane/utils/OStringStream.h"
 #include "arcane/utils/NotImplementedException.h"
 #include "arcane/utils/NotSupportedException.h"
+#include "arcane/utils/ConcurrencyUtils.h"
 
 #include "arcane/ItemTypeMng.h"
 #include "arcane/MeshUtils.h"
@@ -134,6 +135,10 @@ addCells(Integer nb_cell,Int64ConstArrayView cells_infos,
   bool add_to_cells = cells.size()!=0;
   if (add_to_cells && nb_cell!=cells.size())
     ARCANE_THROW(ArgumentException,"return array 'cells' has to have same size as number of cells");
+  if (m_use_multi_threading && TaskFactory::isActive()){
+    m_one_mesh_item_adder->addCells(nb_cell,cells_infos,sub_domain_id,cells,allow_build_face);
+    return;
+  }
   for( Integer i_cell=0; i_cell<nb_cell; ++i_cell ){
     ItemTypeId item_type_id { (Int16)cells_infos[cells_infos_index] };
     ++cells_infos_index;
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* DynamicMeshIncrementalBuilder.h                             (C) 2000-2021 */
+/* DynamicMeshIncrementalBuilder.h                             (C) 2000-2023 */
 /*                                                                           */
 /* Construction d'un maillage de manière incrémentale.                       */
 /*---------------------------------------------------------------------------*/
@@ -137,6 +137,15 @@ class DynamicMeshIncrementalBuilder
   //! Remise à zéro des structures pour pouvoir faire à nouveau une allocation
   void resetAfterDeallocate();
 
+  /*!
+   * \brief Indique si addCells() utilise le multi-threading.
+   *
+   * Si vrai et si le mécanisme des tâches est actif, la détermination
+   * des faces des mailles ajoutées via addCells() est faite en parallèle.
+   */
+  void setUseMultiThreading(bool v) { m_use_multi_threading = v; }
+  bool isUseMultiThreading() const { return m_use_multi_threading; }
+
  public:
 
   void printInfos();
@@ -267,6 +276,7 @@ class DynamicMeshIncrementalBuilder
   bool m_has_amr;
 
   bool m_verbose = false; //!< Vrai si affiche messages
+  bool m_use_multi_threading = false; //!< Vrai si addCells() utilise les tâches
 
   //! Outils de construction du maillage
   OneMeshItemAdder* m_one_mesh_item_adder = nullptr;   //!< Outil pour ajouter un élément au maillage
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* DynamicMeshKindInfos.cc                                     (C) 2000-2019 */
+/* DynamicMeshKindInfos.cc                                     (C) 2000-2023 */
 /*                                                                           */
 /* Infos de maillage pour un genre d'entité donnée.                          */
 /*---------------------------------------------------------------------------*/
@@ -236,18 +236,21 @@ itemsUniqueIdToLocalId(Int32ArrayView local_ids,
   if (!m_has_unique_id_map)
     _badUniqueIdMap();
   if (!arcaneIsCheck()){
-    if (do_fatal){
-      for( Integer i=0, s=unique_ids.size(); i<s; ++i ){
-        Int64 unique_id = unique_ids[i];
-        local_ids[i] = (unique_id==NULL_ITEM_UNIQUE_ID) ? NULL_ITEM_LOCAL_ID : m_items_map.lookupValue(unique_id)->localId();
-      }
-    }
-    else{
-      for( Integer i=0, s=unique_ids.size(); i<s; ++i ){
+    // Recherche par lots pour recouvrir les défauts de cache.
+    Int32 nb_not_found = m_items_map.lookupLocalIds(unique_ids,local_ids);
+    if (nb_not_found!=0 && do_fatal){
+      // Affiche les premières entités non trouvées comme en mode vérification.
+      Integer nb_error = 0;
+      for( Integer i=0, s=unique_ids.size(); i<s && nb_error<10; ++i ){
         Int64 unique_id = unique_ids[i];
-        const ItemInternalMap::Data* data = m_items_map.lookup(unique_id);
-        local_ids[i] = (data) ? data->value()->localId() : NULL_ITEM_LOCAL_ID;
+        if (local_ids[i]!=NULL_ITEM_LOCAL_ID || unique_id==NULL_ITEM_UNIQUE_ID)
+          continue;
+        error() << "DynamicMeshKindInfos::itemsUniqueIdToLocalId() can't find "
+                << "entity " << m_kind_name << " with global id "
+                << unique_id << " in the subdomain.";
+        ++nb_error;
       }
+      ARCANE_FATAL("{0} entities of kind '{1}' not found",nb_not_found,m_kind_name);
     }
   }
   else{
@@ -483,7 +486,8 @@ void DynamicMeshKindInfos::
 beginCompactItems(ItemFamilyCompactInfos& compact_infos)
 {
   m_compact_infos = &compact_infos;
-  bool do_sort = compact_infos.compacter()->isSorted();
+  IMeshCompacter* compacter = compact_infos.compacter();
+  bool do_sort = compacter->isSorted();
 
   if (arcaneIsCheck())
     checkValid();
@@ -505,6 +509,23 @@ beginCompactItems(ItemFamilyCompactInfos& compact_infos)
   // après compactage, il ne peut y avoir que m_nb_item items actifs (et forcément en tête de numérotation)
   new_to_old_local_ids.fill(NULL_ITEM_LOCAL_ID);
 
+  // Regarde si on utilise le compactage incrémental. Ce dernier ne
+  // respecte pas l'ordre des entités et n'est donc pas utilisé si on
+  // demande un tri.
+  const Int32 max_used_local_id = maxUsedLocalId();
+  const Real incremental_threshold = compacter->incrementalThreshold();
+  if (!do_sort && incremental_threshold>0.0 && max_used_local_id>m_nb_item){
+    Real fragmentation = static_cast<Real>(max_used_local_id-m_nb_item) / static_cast<Real>(max_used_local_id);
+    if (fragmentation<=incremental_threshold){
+      info(4) << m_kind_name << " incremental compaction fragmentation=" << fragmentation
+              << " threshold=" << incremental_threshold;
+      _computeIncrementalCompactIds(old_to_new_local_ids,new_to_old_local_ids);
+      compact_infos.setOldToNewLocalIds(std::move(old_to_new_local_ids));
+      compact_infos.setNewToOldLocalIds(std::move(new_to_old_local_ids));
+      return;
+    }
+  }
+
   if (do_sort){
     // Fait une copie temporaire des ItemInternal pour le tri
     UniqueArray<ItemInternal*> items(m_internals);
@@ -627,6 +648,45 @@ beginCompactItems(ItemFamilyCompactInfos& compact_infos)
   compact_infos.setNewToOldLocalIds(std::move(new_to_old_local_ids));
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule la renumérotation pour un compactage incrémental.
+ *
+ * Les entités dont le numéro local est supérieur ou égal à m_nb_item sont
+ * échangées avec les entités supprimées dont le numéro local est inférieur
+ * à m_nb_item. Les autres entités conservent leur numéro local. Le
+ * nombre de numéros locaux modifiés est donc au plus le double du nombre
+ * de trous.
+ */
+void DynamicMeshKindInfos::
+_computeIncrementalCompactIds(Array<Int32>& old_to_new_local_ids,
+                              Array<Int32>& new_to_old_local_ids)
+{
+  const Int32 nb_item = m_nb_item;
+  const Int32 max_used_local_id = maxUsedLocalId();
+  for( Int32 i=0; i<max_used_local_id; ++i )
+    old_to_new_local_ids[i] = i;
+  for( Int32 i=0; i<nb_item; ++i )
+    new_to_old_local_ids[i] = i;
+
+  Int32 tail_index = nb_item;
+  for( Int32 hole_index=0; hole_index<nb_item; ++hole_index ){
+    if (!m_internals[hole_index]->isSuppressed())
+      continue;
+    // Cherche la prochaine entité non supprimée en fin de numérotation.
+    while (tail_index<max_used_local_id && m_internals[tail_index]->isSuppressed())
+      ++tail_index;
+    if (tail_index==max_used_local_id)
+      ARCANE_FATAL("Family '{0}' bad indices: no item left to fill hole '{1}' (nb_item={2} max_used_local_id={3})",
+                   itemFamily()->name(),hole_index,nb_item,max_used_local_id);
+    old_to_new_local_ids[tail_index] = hole_index;
+    old_to_new_local_ids[hole_index] = tail_index;
+    new_to_old_local_ids[hole_index] = tail_index;
+    ++tail_index;
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* DynamicMeshKindInfos.h                                      (C) 2000-2022 */
+/* DynamicMeshKindInfos.h                                      (C) 2000-2023 */
 /*                                                                           */
 /* Infos de maillage pour un genre d'entité donnée.                          */
 /*---------------------------------------------------------------------------*/
@@ -359,6 +359,8 @@ class ARCANE_MESH_EXPORT DynamicMeshKindInfos
   void _badSameUniqueId(Int64 unique_id) const;
   void _badUniqueIdMap() const;
   void _updateItemSharedInfoInternalView();
+  void _computeIncrementalCompactIds(Array<Int32>& old_to_new_local_ids,
+                                     Array<Int32>& new_to_old_local_ids);
 };
 
 /*---------------------------------------------------------------------------*/
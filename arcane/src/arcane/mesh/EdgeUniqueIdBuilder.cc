@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* EdgeUniqueIdBuilder.cc                                      (C) 2000-2022 */
+/* EdgeUniqueIdBuilder.cc                                      (C) 2000-2023 */
 /*                                                                           */
 /* Construction des indentifiants uniques des edges.                         */
 /*---------------------------------------------------------------------------*/
@@ -37,6 +37,12 @@ namespace Arcane::mesh
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+extern "C++" void
+arcaneComputeEdgeUniqueIdWithHash(DynamicMesh* mesh);
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 EdgeUniqueIdBuilder::
 EdgeUniqueIdBuilder(DynamicMeshIncrementalBuilder* mesh_builder)
 : TraceAccessor(mesh_builder->mesh()->traceMng())
@@ -73,10 +79,12 @@ computeEdgesUniqueIds()
     _computeEdgesUniqueIdsParallel3();
   else if (edge_version==2)
     _computeEdgesUniqueIdsParallelV2();
+  else if (edge_version==3)
+    arcaneComputeEdgeUniqueIdWithHash(m_mesh);
   else if (edge_version==0)
     info() << "No renumbering for edges";
   else
-    ARCANE_FATAL("Invalid valid version '{0}'. Valid values are 0, 1 or 2");
+    ARCANE_FATAL("Invalid valid version '{0}'. Valid values are 0, 1, 2 or 3",edge_version);
 
   double end_time = platform::getRealTime();
   Real diff = (Real)(end_time - begin_time);
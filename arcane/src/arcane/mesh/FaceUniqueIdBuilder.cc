@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* FaceUniqueIdBuilder.cc                                      (C) 2000-2022 */
+/* FaceUniqueIdBuilder.cc                                      (C) 2000-2023 */
 /*                                                                           */
 /* Construction des indentifiants uniques des faces.                         */
 /*---------------------------------------------------------------------------*/
@@ -45,6 +45,8 @@ extern "C++" void
 _FaceUiDBuilderComputeNewVersion(DynamicMesh* mesh);
 extern "C++" void
 arcaneComputeCartesianFaceUniqueId(DynamicMesh* mesh);
+extern "C++" void
+arcaneComputeFaceUniqueIdWithHash(DynamicMesh* mesh);
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -78,10 +80,12 @@ computeFacesUniqueIds()
   info() << "Using version=" << face_version << " to compute faces unique ids"
          << " mesh=" << m_mesh->name() << " is_parallel=" << is_parallel;
 
-  if (face_version>4 || face_version<0)
-    ARCANE_FATAL("Invalid value '{0}' for compute face unique ids versions: v>=0 && v<=4");
+  if (face_version>5 || face_version<0)
+    ARCANE_FATAL("Invalid value '{0}' for compute face unique ids versions: v>=0 && v<=5",face_version);
 
-  if (face_version==4)
+  if (face_version==5)
+    arcaneComputeFaceUniqueIdWithHash(m_mesh);
+  else if (face_version==4)
     arcaneComputeCartesianFaceUniqueId(m_mesh);
   else if (face_version==3)
     _FaceUiDBuilderComputeNewVersion(m_mesh);
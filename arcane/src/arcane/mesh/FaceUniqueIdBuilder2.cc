@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* FaceUniqueIdBuilder2.cc                                     (C) 2000-2022 */
+/* FaceUniqueIdBuilder2.cc                                     (C) 2000-2023 */
 /*                                                                           */
 /* Construction des indentifiants uniques des faces.                         */
 /*---------------------------------------------------------------------------*/
@@ -21,7 +21,7 @@
 #include "arcane/IParallelMng.h"
 #include "arcane/Timer.h"
 
-#include "arcane/parallel/BitonicSortT.H"
+#include "arcane/core/parallel/ParallelSort.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -661,8 +661,9 @@ _computeParallel()
   }
 
   info() << "ALL_FACE_LIST memorysize=" << sizeof(AnyFaceInfo)*all_face_list.size();
-  Parallel::BitonicSort<AnyFaceInfo,AnyFaceBitonicSortTraits> all_face_sorter(pm);
-  all_face_sorter.setNeedIndexAndRank(false);
+  auto sort_algorithm = Parallel::getDefaultParallelSortAlgorithm(pm);
+  auto all_face_sorter_ptr = Parallel::createParallelSort<AnyFaceInfo,AnyFaceBitonicSortTraits>(pm,sort_algorithm,false);
+  Parallel::IParallelSort<AnyFaceInfo>& all_face_sorter = *all_face_sorter_ptr;
   Real sort_begin_time = platform::getRealTime();
   all_face_sorter.sort(all_face_list);
   Real sort_end_time = platform::getRealTime();
@@ -685,8 +686,9 @@ _computeAndSortBoundaryFaces(Array<BoundaryFaceInfo>& boundary_faces_info)
   bool is_verbose = m_is_verbose;
   ItemInternalMap& faces_map = m_mesh->facesMap();
 
-  Parallel::BitonicSort<BoundaryFaceInfo,BoundaryFaceBitonicSortTraits> boundary_face_sorter(pm);
-  boundary_face_sorter.setNeedIndexAndRank(false);
+  auto sort_algorithm = Parallel::getDefaultParallelSortAlgorithm(pm);
+  auto boundary_face_sorter_ptr = Parallel::createParallelSort<BoundaryFaceInfo,BoundaryFaceBitonicSortTraits>(pm,sort_algorithm,false);
+  Parallel::IParallelSort<BoundaryFaceInfo>& boundary_face_sorter = *boundary_face_sorter_ptr;
 
   //UniqueArray<BoundaryFaceInfo> boundary_face_list;
   boundary_faces_info.clear();
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* GhostLayerBuilder2.cc                                       (C) 2000-2022 */
+/* GhostLayerBuilder2.cc                                       (C) 2000-2023 */
 /*                                                                           */
 /* Construction des couches fantomes.                                        */
 /*---------------------------------------------------------------------------*/
@@ -17,7 +17,10 @@
 #include "arcane/utils/ITraceMng.h"
 #include "arcane/utils/CheckedConvert.h"
 
-#include "arcane/parallel/BitonicSortT.H"
+#include "arcane/core/parallel/ParallelSort.h"
+
+#include "arcane/core/Concurrency.h"
+#include "arcane/core/IParallelNonBlockingCollective.h"
 
 #include "arcane/IParallelExchanger.h"
 #include "arcane/ISerializeMessage.h"
@@ -78,6 +81,15 @@ class GhostLayerBuilder2
   bool m_is_allocate;
   Int32 m_version;
 
+  //! Temps passé à déterminer les couches et les noeuds frontières
+  Timer m_mark_timer;
+  //! Temps passé dans le tri parallèle des noeuds frontières
+  Timer m_sort_timer;
+  //! Temps passé à calculer et sérialiser les mailles à envoyer
+  Timer m_serialize_timer;
+  //! Temps passé dans les échanges de messages
+  Timer m_exchange_timer;
+
  private:
   
   void _printItem(ItemInternal* ii,std::ostream& o);
@@ -86,6 +98,8 @@ class GhostLayerBuilder2
   void _sortBoundaryNodeList(Array<BoundaryNodeInfo>& boundary_node_list);
   void _addGhostLayer(Integer current_layer,Int32ConstArrayView node_layer);
   void _markBoundaryNodes(ArrayView<Int32> node_layer);
+  void _fillCellList(Array<Cell>& cells);
+  void _printTimers();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -100,6 +114,10 @@ GhostLayerBuilder2(DynamicMeshIncrementalBuilder* mesh_builder,bool is_allocate,
 , m_is_verbose(false)
 , m_is_allocate(is_allocate)
 , m_version(version)
+, m_mark_timer(m_parallel_mng->timerMng(),"GhostLayerBuilder2::mark",Timer::TimerReal)
+, m_sort_timer(m_parallel_mng->timerMng(),"GhostLayerBuilder2::sort",Timer::TimerReal)
+, m_serialize_timer(m_parallel_mng->timerMng(),"GhostLayerBuilder2::serialize",Timer::TimerReal)
+, m_exchange_timer(m_parallel_mng->timerMng(),"GhostLayerBuilder2::exchange",Timer::TimerReal)
 {
 }
 
@@ -122,6 +140,41 @@ _printItem(ItemInternal* ii,std::ostream& o)
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
+/*!
+ * \brief Remplit \a cells avec les mailles à traiter.
+ *
+ * Avec la version 4 et plus, il s'agit uniquement des mailles propres.
+ * L'ordre est celui du parcours de la table des mailles. Cette liste
+ * permet ensuite de traiter les mailles en parallèle.
+ */
+void GhostLayerBuilder2::
+_fillCellList(Array<Cell>& cells)
+{
+  const Int32 my_rank = m_parallel_mng->commRank();
+  ItemInternalMap& cells_map = m_mesh->cellsMap();
+  cells.clear();
+  cells.reserve(cells_map.count());
+  ENUMERATE_ITEM_INTERNAL_MAP_DATA(iid,cells_map){
+    Cell cell = iid->value();
+    // Ne traite pas les mailles qui ne m'appartiennent pas
+    if (m_version>=4 && cell.owner()!=my_rank)
+      continue;
+    cells.add(cell);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void GhostLayerBuilder2::
+_printTimers()
+{
+  info() << "GhostLayerBuilder2 timers (unit: second)"
+         << " mark=" << m_mark_timer.totalTime()
+         << " sort=" << m_sort_timer.totalTime()
+         << " serialize=" << m_serialize_timer.totalTime()
+         << " exchange=" << m_exchange_timer.totalTime();
+}
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -245,6 +298,8 @@ addGhostLayers()
   ItemInternalMap& cells_map = m_mesh->cellsMap();
   ItemInternalMap& nodes_map = m_mesh->nodesMap();
 
+  m_mark_timer.start();
+
   // Marque les noeuds frontières
   _markBoundaryItems();
 
@@ -294,44 +349,48 @@ addGhostLayers()
 
   info() << "NB BOUNDARY NODE=" << boundary_nodes_uid_count;
 
+  UniqueArray<Cell> cells;
+  _fillCellList(cells);
+  const Integer nb_cell = cells.size();
+
   for(Integer current_layer=1; current_layer<=nb_ghost_layer; ++current_layer){
-    //Integer current_layer = 1;
     info() << "Processing layer " << current_layer;
-    ENUMERATE_ITEM_INTERNAL_MAP_DATA(iid,cells_map){
-      Cell cell = iid->value();
-      // Ne traite pas les mailles qui ne m'appartiennent pas
-      if (m_version>=4 && cell.owner()!=my_rank)
-        continue;
-      //Int64 cell_uid = cell->uniqueId();
-      Int32 cell_lid = cell.localId();
-      if (cell_layer[cell_lid]!=(-1))
-        continue;
-      bool is_current_layer = false;
-      for( Int32 inode_local_id : cell.nodeIds() ){
-        Integer layer = node_layer[inode_local_id];
-        //info() << "NODE_LAYER lid=" << i_node->localId() << " layer=" << layer;
-        if (layer==current_layer){
-          is_current_layer = true;
-          break;
-        }
-      }
-      if (is_current_layer){
-        cell_layer[cell_lid] = current_layer;
-        //info() << "Current layer celluid=" << cell_uid;
-        // Si non marqué, initialise à la couche courante + 1.
+    // Détermine en parallèle les mailles de la couche courante. Cette phase
+    // ne fait que lire 'node_layer' et chaque maille ne modifie que sa
+    // propre valeur dans 'cell_layer'.
+    arcaneParallelFor(0,nb_cell,[&](Integer begin,Integer size){
+      for( Integer i=begin; i<(begin+size); ++i ){
+        Cell cell = cells[i];
+        Int32 cell_lid = cell.localId();
+        if (cell_layer[cell_lid]!=(-1))
+          continue;
         for( Int32 inode_local_id : cell.nodeIds() ){
-          Integer layer = node_layer[inode_local_id];
-          if (layer==(-1)){
-            //info() << "Marque node uid=" << i_node->uniqueId();
-            node_layer[inode_local_id] = current_layer + 1;
+          if (node_layer[inode_local_id]==current_layer){
+            cell_layer[cell_lid] = current_layer;
+            break;
           }
         }
       }
+    });
+    // Si non marqué, initialise les noeuds des mailles de la couche courante
+    // à la couche courante + 1. Comme plusieurs mailles partagent les mêmes
+    // noeuds, cette phase est séquentielle.
+    for( Integer i=0; i<nb_cell; ++i ){
+      Cell cell = cells[i];
+      if (cell_layer[cell.localId()]!=current_layer)
+        continue;
+      for( Int32 inode_local_id : cell.nodeIds() ){
+        if (node_layer[inode_local_id]==(-1))
+          node_layer[inode_local_id] = current_layer + 1;
+      }
     }
   }
+  m_mark_timer.stop();
 
   for( Integer i=1; i<=nb_ghost_layer; ++i )
     _addGhostLayer(i,node_layer);
+
+  _printTimers();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -399,37 +458,64 @@ _addGhostLayer(Integer current_layer,Int32ConstArrayView node_layer)
 
   // On doit envoyer tous les noeuds dont le numéro de couche est différent de (-1).
   // NOTE: pour la couche au dessus de 1, il ne faut envoyer qu'une seule valeur.
-  ENUMERATE_ITEM_INTERNAL_MAP_DATA(iid,cells_map){
-    Cell cell = iid->value();
-    // Ne traite pas les mailles qui ne m'appartiennent pas
-    if (m_version>=4 && cell.owner()!=my_rank)
-      continue;
-    Int64 cell_uid = cell.uniqueId();
-    for( Node node : cell.nodes() ){
-      Int32 node_lid = node.localId();
-      bool do_it = false;
-      //if (node_lid>=node_layer.size())
-      //do_it = true;
-      if (cell.owner()!=my_rank){
-        do_it = true;
-      }
-      else{
-        Integer layer = node_layer[node_lid];
-        do_it = layer<=current_layer;
-      }
-      if (do_it){
-        Int64 node_uid = node.uniqueId();
-        BoundaryNodeInfo nci;
-        nci.node_uid = node_uid;
-        nci.cell_uid = cell_uid;
-        nci.cell_owner = my_rank;
-        boundary_node_list.add(nci);
+  // La liste est construite en parallèle en deux passes: la première calcule
+  // le nombre de noeuds à envoyer pour chaque maille et la seconde remplit la
+  // liste. L'ordre est ainsi le même que lors d'un parcours séquentiel.
+  m_mark_timer.start();
+  {
+    // La liste des mailles change à chaque couche car on a reçu
+    // de nouvelles mailles fantômes.
+    UniqueArray<Cell> cells;
+    _fillCellList(cells);
+    const Integer nb_cell = cells.size();
+    auto is_node_to_send = [&](Cell cell,Int32 node_lid) -> bool
+    {
+      if (cell.owner()!=my_rank)
+        return true;
+      return node_layer[node_lid]<=current_layer;
+    };
+    UniqueArray<Int32> cell_first_index(nb_cell+1);
+    arcaneParallelFor(0,nb_cell,[&](Integer begin,Integer size){
+      for( Integer i=begin; i<(begin+size); ++i ){
+        Cell cell = cells[i];
+        Int32 n = 0;
+        for( Int32 node_lid : cell.nodeIds() )
+          if (is_node_to_send(cell,node_lid))
+            ++n;
+        cell_first_index[i] = n;
       }
+    });
+    Int32 nb_boundary_node_info = 0;
+    for( Integer i=0; i<nb_cell; ++i ){
+      Int32 n = cell_first_index[i];
+      cell_first_index[i] = nb_boundary_node_info;
+      nb_boundary_node_info += n;
     }
+    cell_first_index[nb_cell] = nb_boundary_node_info;
+    boundary_node_list.resize(nb_boundary_node_info);
+    arcaneParallelFor(0,nb_cell,[&](Integer begin,Integer size){
+      for( Integer i=begin; i<(begin+size); ++i ){
+        Cell cell = cells[i];
+        Int64 cell_uid = cell.uniqueId();
+        Int32 index = cell_first_index[i];
+        for( Node node : cell.nodes() ){
+          if (is_node_to_send(cell,node.localId())){
+            BoundaryNodeInfo& nci = boundary_node_list[index];
+            nci.node_uid = node.uniqueId();
+            nci.cell_uid = cell_uid;
+            nci.cell_owner = my_rank;
+            ++index;
+          }
+        }
+      }
+    });
   }
+  m_mark_timer.stop();
   info() << "NB BOUNDARY NODE LIST=" << boundary_node_list.size();
 
   _sortBoundaryNodeList(boundary_node_list);
+
+  m_serialize_timer.start();
   SharedArray<BoundaryNodeInfo> all_boundary_node_info = boundary_node_list;
 
   UniqueArray<BoundaryNodeToSendInfo> node_list_to_send;
@@ -510,6 +596,14 @@ _addGhostLayer(Integer current_layer,Int32ConstArrayView node_layer)
   }
   info() << "TOTAL_NB_TO_SEND=" << total_nb_to_send;
 
+  // Si possible, échange les tailles de manière non bloquante pendant
+  // qu'on remplit le tableau des valeurs à envoyer.
+  IntegerUniqueArray nb_info_to_recv(nb_rank,0);
+  IParallelNonBlockingCollective* pnbc = pm->nonBlockingCollective();
+  UniqueArray<Parallel::Request> size_requests;
+  if (pnbc)
+    size_requests.add(pnbc->allToAll(nb_info_to_send,nb_info_to_recv,1));
+
   UniqueArray<Int64> resend_infos(total_nb_to_send);
   {
     ConstArrayView<BoundaryNodeInfo> all_bni = all_boundary_node_info;
@@ -543,10 +637,15 @@ _addGhostLayer(Integer current_layer,Int32ConstArrayView node_layer)
     }
   }
 
-  IntegerUniqueArray nb_info_to_recv(nb_rank,0);
+  m_serialize_timer.stop();
+
   {
+    Timer::Sentry ts(&m_exchange_timer);
     Timer::SimplePrinter sp(traceMng(),"Sending size with AllToAll");
-    pm->allToAll(nb_info_to_send,nb_info_to_recv,1);
+    if (pnbc)
+      pm->waitAllRequests(size_requests);
+    else
+      pm->allToAll(nb_info_to_send,nb_info_to_recv,1);
   }
 
   if (is_verbose)
@@ -586,11 +685,13 @@ _addGhostLayer(Integer current_layer,Int32ConstArrayView node_layer)
 
     info() << "BUF_SIZES: send=" << send_buf.size() << " recv=" << recv_buf.size();
     {
+      Timer::Sentry ts(&m_exchange_timer);
       Timer::SimplePrinter sp(traceMng(),"Send values with AllToAll");
       pm->allToAllVariable(send_buf,send_counts,send_indexes,recv_buf,recv_counts,recv_indexes);
     }
   }
 
+  m_serialize_timer.start();
   SubDomainItemMap cells_to_send(50,true);
 
   // TODO: il n'y a a priori pas besoin d'avoir les mailles ici mais
@@ -655,6 +756,8 @@ _addGhostLayer(Integer current_layer,Int32ConstArrayView node_layer)
     }
   }
 
+  m_serialize_timer.stop();
+
   info() << "GHOST V3 SERIALIZE CELLS";
   _sendAndReceiveCells(cells_to_send);
 }
@@ -676,10 +779,12 @@ _sortBoundaryNodeList(Array<BoundaryNodeInfo>& boundary_node_list)
   Int32 nb_rank = pm->commSize();
   bool is_verbose = m_is_verbose;
 
-  Parallel::BitonicSort<BoundaryNodeInfo,BoundaryNodeBitonicSortTraits> boundary_node_sorter(pm);
-  boundary_node_sorter.setNeedIndexAndRank(false);
+  auto sort_algorithm = Parallel::getDefaultParallelSortAlgorithm(pm);
+  auto boundary_node_sorter_ptr = Parallel::createParallelSort<BoundaryNodeInfo,BoundaryNodeBitonicSortTraits>(pm,sort_algorithm,false);
+  Parallel::IParallelSort<BoundaryNodeInfo>& boundary_node_sorter = *boundary_node_sorter_ptr;
 
   {
+    Timer::Sentry ts(&m_sort_timer);
     Timer::SimplePrinter sp(traceMng(),"Sorting boundary nodes");
     boundary_node_sorter.sort(boundary_node_list);
   }
@@ -734,6 +839,7 @@ _sortBoundaryNodeList(Array<BoundaryNodeInfo>& boundary_node_list)
 
     UniqueArray<BoundaryNodeInfo> end_node_list_recv;
 
+    Timer::Sentry ts(&m_exchange_timer);
     UniqueArray<Parallel::Request> requests;
     Integer recv_message_size = 0;
     Integer send_message_size = BoundaryNodeBitonicSortTraits::messageSize(end_node_list);
@@ -745,7 +851,11 @@ _sortBoundaryNodeList(Array<BoundaryNodeInfo>& boundary_node_list)
     if (my_rank!=0){
       requests.add(pm->send(IntegerConstArrayView(1,&send_message_size),my_rank-1,false));
     }
-    
+
+    // Recopie la partie locale de la liste pendant l'échange des tailles.
+    boundary_node_list.clear();
+    boundary_node_list.addRange(all_bni.subConstView(begin_own_list_index,n-begin_own_list_index));
+
     pm->waitAllRequests(requests);
     requests.clear();
     
@@ -759,8 +869,6 @@ _sortBoundaryNodeList(Array<BoundaryNodeInfo>& boundary_node_list)
 
     pm->waitAllRequests(requests);
 
-    boundary_node_list.clear();
-    boundary_node_list.addRange(all_bni.subConstView(begin_own_list_index,n-begin_own_list_index));
     boundary_node_list.addRange(end_node_list_recv);
   }
 }
@@ -775,17 +883,29 @@ _sendAndReceiveCells(SubDomainItemMap& cells_to_send)
 
   const bool is_verbose = m_is_verbose;
 
+  m_serialize_timer.start();
+
+  // Comme la liste par sous-domaine peut contenir plusieurs
+  // fois la même maille, on trie la liste et on supprime les
+  // doublons. Chaque liste est indépendante et est donc traitée en parallèle.
+  UniqueArray<Int32Array*> items_by_rank;
+  for( SubDomainItemMap::Enumerator i_map(cells_to_send); ++i_map; )
+    items_by_rank.add(&i_map.data()->value());
+  ParallelLoopOptions loop_options;
+  loop_options.setGrainSize(1);
+  arcaneParallelFor(0,items_by_rank.size(),loop_options,[&](Integer begin,Integer size){
+    for( Integer i=begin; i<(begin+size); ++i ){
+      Int32Array& items = *items_by_rank[i];
+      std::sort(std::begin(items),std::end(items));
+      auto new_end = std::unique(std::begin(items),std::end(items));
+      items.resize(CheckedConvert::toInteger(new_end-std::begin(items)));
+    }
+  });
+
   // Envoie et réceptionne les mailles fantômes
   for( SubDomainItemMap::Enumerator i_map(cells_to_send); ++i_map; ){
     Int32 sd = i_map.data()->key();
     Int32Array& items = i_map.data()->value();
-
-    // Comme la liste par sous-domaine peut contenir plusieurs
-    // fois la même maille, on trie la liste et on supprime les
-    // doublons
-    std::sort(std::begin(items),std::end(items));
-    auto new_end = std::unique(std::begin(items),std::end(items));
-    items.resize(CheckedConvert::toInteger(new_end-std::begin(items)));
     if (is_verbose)
       info(4) << "CELLS TO SEND SD=" << sd << " Items=" << items;
     else
@@ -800,12 +920,19 @@ _sendAndReceiveCells(SubDomainItemMap& cells_to_send)
     Int32ConstArrayView items_to_send = cells_to_send[rank];
     m_mesh->serializeCells(s,items_to_send);
   }
-  exchanger->processExchange();
+  m_serialize_timer.stop();
+  {
+    Timer::Sentry ts(&m_exchange_timer);
+    exchanger->processExchange();
+  }
   info(4) << "END EXCHANGE CELLS";
-  for( Integer i=0, ns=exchanger->nbReceiver(); i<ns; ++i ){
-    ISerializeMessage* sm = exchanger->messageToReceive(i);
-    ISerializer* s = sm->serializer();
-    m_mesh->addCells(s);
+  {
+    Timer::Sentry ts(&m_serialize_timer);
+    for( Integer i=0, ns=exchanger->nbReceiver(); i<ns; ++i ){
+      ISerializeMessage* sm = exchanger->messageToReceive(i);
+      ISerializer* s = sm->serializer();
+      m_mesh->addCells(s);
+    }
   }
   m_mesh_builder->printStats();
 }
@@ -0,0 +1,480 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* HashUniqueIdBuilder.cc                                      (C) 2000-2023 */
+/*                                                                           */
+/* Construction des uniqueId() des faces et des arêtes par hachage.          */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/CheckedConvert.h"
+#include "arcane/utils/ValueConvert.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/HashFunction.h"
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/TraceAccessor.h"
+
+#include "arcane/mesh/DynamicMesh.h"
+#include "arcane/mesh/ItemInternalMap.h"
+
+#include "arcane/core/IParallelMng.h"
+
+#include <algorithm>
+#include <numeric>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::mesh
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Construction des uniqueId() des faces ou des arêtes par hachage.
+ *
+ * Contrairement à FaceUniqueIdBuilder2, cet algorithme n'utilise pas de
+ * tri parallèle. Chaque entité est identifiée par la liste triée des
+ * uniqueId() de ses noeuds. Le hachage de cette liste détermine un
+ * paquet parmi NB_BUCKET et chaque rang est responsable d'un intervalle
+ * contigu de paquets (annuaire distribué). L'algorithme est le suivant :
+ *
+ * 1. chaque rang envoie, pour chacune de ses entités, la liste des noeuds
+ *    au rang responsable de son paquet. Une entité présente sur plusieurs
+ *    rangs est donc envoyée plusieurs fois au même rang,
+ * 2. chaque rang trie localement les entités reçues suivant leur paquet
+ *    puis la liste de leurs noeuds et supprime les doublons,
+ * 3. le uniqueId() d'une entité est sa position dans cette liste à laquelle
+ *    on ajoute le nombre d'entités des rangs précédents,
+ * 4. les uniqueId() et les propriétaires sont renvoyés aux rangs d'origine.
+ *
+ * Il n'y a donc qu'un seul échange de type allToAllVariable() (plus
+ * l'échange des réponses) et un allGather() pour calculer les décalages.
+ *
+ * Comme le paquet d'une entité et l'ordre dans un paquet ne dépendent que
+ * des uniqueId() des noeuds, la numérotation est indépendante du découpage
+ * et du nombre de rangs. Par contre, elle est différente de celle des
+ * autres versions.
+ *
+ * Le propriétaire d'une entité est celui de la maille connectée
+ * de plus petit uniqueId().
+ *
+ * Si la variable d'environnement ARCANE_HASH_UNIQUE_ID_CHECK vaut 1,
+ * la numérotation obtenue est comparée à une numérotation de référence
+ * calculée séquentiellement à partir de la liste de toutes les entités
+ * (voir _checkUniqueIds()).
+ */
+class HashUniqueIdBuilder
+: public TraceAccessor
+{
+ public:
+
+  /*!
+   * \brief Nombre de paquets.
+   *
+   * Cette valeur ne doit pas dépendre du nombre de rangs sinon la
+   * numérotation en dépendrait.
+   */
+  static constexpr Int64 NB_BUCKET = 1 << 20;
+
+ public:
+
+  HashUniqueIdBuilder(DynamicMesh* mesh, eItemKind item_kind);
+
+ public:
+
+  void computeUniqueIdAndOwner();
+
+ private:
+
+  DynamicMesh* m_mesh = nullptr;
+  IParallelMng* m_parallel_mng = nullptr;
+  eItemKind m_item_kind = IK_Unknown;
+
+ private:
+
+  ItemInternalMap& _itemsMap();
+  void _checkUniqueIds();
+  static Int64 _computeBucket(ConstArrayView<Int64> sorted_node_uids);
+  Int32 _bucketRank(Int64 bucket) const;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+HashUniqueIdBuilder::
+HashUniqueIdBuilder(DynamicMesh* mesh, eItemKind item_kind)
+: TraceAccessor(mesh->traceMng())
+, m_mesh(mesh)
+, m_parallel_mng(mesh->parallelMng())
+, m_item_kind(item_kind)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ItemInternalMap& HashUniqueIdBuilder::
+_itemsMap()
+{
+  if (m_item_kind == IK_Face)
+    return m_mesh->facesMap();
+  if (m_item_kind == IK_Edge)
+    return m_mesh->edgesMap();
+  ARCANE_FATAL("Invalid item kind '{0}'. Valid values are IK_Face or IK_Edge", m_item_kind);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Int64 HashUniqueIdBuilder::
+_computeBucket(ConstArrayView<Int64> sorted_node_uids)
+{
+  Int64 hash = sorted_node_uids.size();
+  for (Int64 uid : sorted_node_uids)
+    hash = IntegerHashFunctionT<Int64>::hashfunc(hash ^ uid);
+  return static_cast<Int64>(static_cast<UInt64>(hash) % NB_BUCKET);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Rang responsable du paquet \a bucket.
+ *
+ * Le rang \a r est responsable des paquets de l'intervalle
+ * [(NB_BUCKET*r)/P,(NB_BUCKET*(r+1))/P[ avec P le nombre de rangs.
+ */
+Int32 HashUniqueIdBuilder::
+_bucketRank(Int64 bucket) const
+{
+  Int64 nb_rank = m_parallel_mng->commSize();
+  return static_cast<Int32>(((bucket + 1) * nb_rank - 1) / NB_BUCKET);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void HashUniqueIdBuilder::
+computeUniqueIdAndOwner()
+{
+  IParallelMng* pm = m_parallel_mng;
+  const Int32 nb_rank = pm->commSize();
+  const Int32 my_rank = pm->commRank();
+  ItemInternalMap& items_map = _itemsMap();
+
+  info() << "Compute uniqueId() using hashing kind=" << m_item_kind
+         << " nb_item=" << items_map.count();
+  Real begin_time = platform::getRealTime();
+
+  // Pour chaque entité, les informations envoyées sont :
+  // - le paquet,
+  // - le nombre de noeuds,
+  // - les uniqueId() triés des noeuds,
+  // - le uniqueId() de la maille connectée de plus petit uniqueId(),
+  // - le propriétaire de cette maille.
+  UniqueArray<UniqueArray<Int64>> infos_to_send(nb_rank);
+  UniqueArray<UniqueArray<ItemInternal*>> items_to_send(nb_rank);
+  {
+    Int64UniqueArray node_uids;
+    ENUMERATE_ITEM_INTERNAL_MAP_DATA (iid, items_map) {
+      ItemInternal* item = iid->value();
+      Int32 nb_node = item->nbNode();
+      node_uids.resize(nb_node);
+      for (Int32 i = 0; i < nb_node; ++i)
+        node_uids[i] = item->nodeBase(i).uniqueId().asInt64();
+      std::sort(node_uids.begin(), node_uids.end());
+      // Si l'entité n'a pas de maille, c'est le rang de plus petit numéro
+      // qui en est le propriétaire.
+      Int64 min_cell_uid = INT64_MAX;
+      Int32 min_cell_owner = my_rank;
+      for (Int32 i = 0, n = item->nbCell(); i < n; ++i) {
+        impl::ItemBase cell = item->cellBase(i);
+        Int64 cell_uid = cell.uniqueId().asInt64();
+        if (cell_uid < min_cell_uid) {
+          min_cell_uid = cell_uid;
+          min_cell_owner = cell.owner();
+        }
+      }
+      Int64 bucket = _computeBucket(node_uids);
+      Int32 dest_rank = _bucketRank(bucket);
+      Int64Array& buf = infos_to_send[dest_rank];
+      buf.add(bucket);
+      buf.add(nb_node);
+      buf.addRange(node_uids);
+      buf.add(min_cell_uid);
+      buf.add(min_cell_owner);
+      items_to_send[dest_rank].add(item);
+    }
+  }
+
+  // Envoie les informations aux rangs responsables des paquets.
+  Int32UniqueArray send_counts(nb_rank);
+  Int32UniqueArray send_indexes(nb_rank);
+  Int64UniqueArray send_buf;
+  for (Int32 i = 0; i < nb_rank; ++i) {
+    send_counts[i] = infos_to_send[i].size();
+    send_indexes[i] = send_buf.size();
+    send_buf.addRange(infos_to_send[i]);
+    infos_to_send[i].clear();
+  }
+  Int32UniqueArray recv_counts(nb_rank);
+  pm->allToAll(send_counts, recv_counts, 1);
+  Int32UniqueArray recv_indexes(nb_rank);
+  Int32 total_recv = 0;
+  for (Int32 i = 0; i < nb_rank; ++i) {
+    recv_indexes[i] = total_recv;
+    total_recv += recv_counts[i];
+  }
+  Int64UniqueArray recv_buf(total_recv);
+  pm->allToAllVariable(send_buf, send_counts, send_indexes, recv_buf, recv_counts, recv_indexes);
+  send_buf.clear();
+
+  // Position dans \a recv_buf de chaque entité reçue. Les entités
+  // sont rangées par rang d'origine.
+  Int32UniqueArray entry_positions;
+  Int32UniqueArray nb_entry_per_rank(nb_rank);
+  for (Int32 i = 0; i < nb_rank; ++i) {
+    Int32 pos = recv_indexes[i];
+    Int32 end_pos = pos + recv_counts[i];
+    Int32 nb_entry = 0;
+    while (pos < end_pos) {
+      entry_positions.add(pos);
+      pos += 4 + CheckedConvert::toInt32(recv_buf[pos + 1]);
+      ++nb_entry;
+    }
+    if (pos != end_pos)
+      ARCANE_FATAL("Bad message size from rank '{0}'", i);
+    nb_entry_per_rank[i] = nb_entry;
+  }
+  const Int32 nb_entry = entry_positions.size();
+
+  // Trie les entités reçues suivant leur paquet puis la liste de leurs noeuds.
+  // Comme les noeuds sont triés, deux entités identiques ont la même clé.
+  auto compare_entry = [&](Int32 a, Int32 b) -> int {
+    const Int64* ka = recv_buf.data() + entry_positions[a];
+    const Int64* kb = recv_buf.data() + entry_positions[b];
+    // Compare le paquet et le nombre de noeuds puis les noeuds.
+    Int64 nb_value = 2 + math::min(ka[1], kb[1]);
+    for (Int64 i = 0; i < nb_value; ++i) {
+      if (ka[i] != kb[i])
+        return (ka[i] < kb[i]) ? -1 : 1;
+    }
+    return 0;
+  };
+  Int32UniqueArray sorted_entries(nb_entry);
+  std::iota(sorted_entries.begin(), sorted_entries.end(), 0);
+  std::sort(sorted_entries.begin(), sorted_entries.end(),
+            [&](Int32 a, Int32 b) { return compare_entry(a, b) < 0; });
+
+  // Détermine pour chaque entité distincte son indice local et son propriétaire.
+  Int64UniqueArray entry_local_index(nb_entry);
+  Int32UniqueArray entry_owner(nb_entry);
+  Int64 nb_local_item = 0;
+  for (Int32 begin = 0; begin < nb_entry;) {
+    Int32 end = begin + 1;
+    while (end < nb_entry && compare_entry(sorted_entries[begin], sorted_entries[end]) == 0)
+      ++end;
+    Int64 min_cell_uid = INT64_MAX;
+    Int32 owner = A_NULL_RANK;
+    for (Int32 z = begin; z < end; ++z) {
+      const Int64* k = recv_buf.data() + entry_positions[sorted_entries[z]];
+      Int64 nb_node = k[1];
+      Int64 cell_uid = k[2 + nb_node];
+      Int32 cell_owner = CheckedConvert::toInt32(k[3 + nb_node]);
+      if (owner == A_NULL_RANK || cell_uid < min_cell_uid || (cell_uid == min_cell_uid && cell_owner < owner)) {
+        min_cell_uid = cell_uid;
+        owner = cell_owner;
+      }
+    }
+    for (Int32 z = begin; z < end; ++z) {
+      entry_local_index[sorted_entries[z]] = nb_local_item;
+      entry_owner[sorted_entries[z]] = owner;
+    }
+    ++nb_local_item;
+    begin = end;
+  }
+
+  // Calcule le uniqueId() de la première entité de ce rang. Comme les
+  // rangs sont responsables d'intervalles croissants de paquets, il s'agit
+  // du nombre d'entités des rangs précédents.
+  Int64 first_uid = 0;
+  {
+    Int64UniqueArray all_nb_item(nb_rank);
+    pm->allGather(Int64ConstArrayView(1, &nb_local_item), all_nb_item);
+    for (Int32 i = 0; i < my_rank; ++i)
+      first_uid += all_nb_item[i];
+  }
+
+  // Renvoie aux rangs d'origine les uniqueId() et les propriétaires
+  // dans l'ordre de réception.
+  Int64UniqueArray reply_buf(nb_entry * 2);
+  for (Int32 i = 0; i < nb_entry; ++i) {
+    reply_buf[i * 2] = first_uid + entry_local_index[i];
+    reply_buf[(i * 2) + 1] = entry_owner[i];
+  }
+  Int32UniqueArray reply_counts(nb_rank);
+  Int32UniqueArray reply_indexes(nb_rank);
+  Int32UniqueArray answer_counts(nb_rank);
+  Int32UniqueArray answer_indexes(nb_rank);
+  {
+    Int32 reply_index = 0;
+    Int32 answer_index = 0;
+    for (Int32 i = 0; i < nb_rank; ++i) {
+      reply_counts[i] = nb_entry_per_rank[i] * 2;
+      reply_indexes[i] = reply_index;
+      reply_index += reply_counts[i];
+      answer_counts[i] = items_to_send[i].size() * 2;
+      answer_indexes[i] = answer_index;
+      answer_index += answer_counts[i];
+    }
+  }
+  Int64UniqueArray answer_buf(answer_indexes[nb_rank - 1] + answer_counts[nb_rank - 1]);
+  pm->allToAllVariable(reply_buf, reply_counts, reply_indexes, answer_buf, answer_counts, answer_indexes);
+
+  // Positionne les uniqueId() et les propriétaires.
+  for (Int32 i = 0; i < nb_rank; ++i) {
+    ConstArrayView<ItemInternal*> items = items_to_send[i];
+    Int32 index = answer_indexes[i];
+    for (ItemInternal* item : items) {
+      item->setUniqueId(answer_buf[index]);
+      item->setOwner(CheckedConvert::toInt32(answer_buf[index + 1]), my_rank);
+      index += 2;
+    }
+  }
+
+  Real end_time = platform::getRealTime();
+  info() << "END_HASH_UNIQUE_ID nb_local_item=" << nb_local_item
+         << " nb_received=" << nb_entry << " time=" << (end_time - begin_time);
+
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_HASH_UNIQUE_ID_CHECK", true))
+    if (v.value() != 0)
+      _checkUniqueIds();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie que la numérotation est indépendante du découpage.
+ *
+ * Tous les rangs récupèrent la liste triée des uniqueId() des noeuds
+ * et le uniqueId() de chacune de leurs entités. La référence est calculée
+ * comme le ferait un calcul séquentiel : les entités distinctes sont
+ * triées suivant leur paquet puis la liste de leurs noeuds et le
+ * uniqueId() attendu est la position dans cette liste. Cette référence
+ * ne dépend que des uniqueId() des noeuds et est donc la même quel que
+ * soit le nombre de rangs.
+ *
+ * Cette vérification nécessite que chaque rang ait la liste de toutes les
+ * entités et n'est donc destinée qu'aux tests.
+ */
+void HashUniqueIdBuilder::
+_checkUniqueIds()
+{
+  IParallelMng* pm = m_parallel_mng;
+  ItemInternalMap& items_map = _itemsMap();
+
+  // Pour chaque entité : le nombre de noeuds, les uniqueId() triés des
+  // noeuds et le uniqueId() de l'entité.
+  Int64UniqueArray send_buf;
+  {
+    Int64UniqueArray node_uids;
+    ENUMERATE_ITEM_INTERNAL_MAP_DATA (iid, items_map) {
+      ItemInternal* item = iid->value();
+      Int32 nb_node = item->nbNode();
+      node_uids.resize(nb_node);
+      for (Int32 i = 0; i < nb_node; ++i)
+        node_uids[i] = item->nodeBase(i).uniqueId().asInt64();
+      std::sort(node_uids.begin(), node_uids.end());
+      send_buf.add(nb_node);
+      send_buf.addRange(node_uids);
+      send_buf.add(item->uniqueId().asInt64());
+    }
+  }
+  Int64UniqueArray all_infos;
+  pm->allGatherVariable(send_buf, all_infos);
+  send_buf.clear();
+
+  // Clé de chaque entité : paquet, nombre de noeuds puis noeuds.
+  Int64UniqueArray buckets;
+  Int32UniqueArray entry_positions;
+  for (Int32 pos = 0, n = all_infos.size(); pos < n;) {
+    Int32 nb_node = CheckedConvert::toInt32(all_infos[pos]);
+    entry_positions.add(pos);
+    buckets.add(_computeBucket(all_infos.subConstView(pos + 1, nb_node)));
+    pos += 2 + nb_node;
+  }
+  const Int32 nb_entry = entry_positions.size();
+  auto compare_entry = [&](Int32 a, Int32 b) -> int {
+    if (buckets[a] != buckets[b])
+      return (buckets[a] < buckets[b]) ? -1 : 1;
+    const Int64* ka = all_infos.data() + entry_positions[a];
+    const Int64* kb = all_infos.data() + entry_positions[b];
+    Int64 nb_value = 1 + math::min(ka[0], kb[0]);
+    for (Int64 i = 0; i < nb_value; ++i) {
+      if (ka[i] != kb[i])
+        return (ka[i] < kb[i]) ? -1 : 1;
+    }
+    return 0;
+  };
+  Int32UniqueArray sorted_entries(nb_entry);
+  std::iota(sorted_entries.begin(), sorted_entries.end(), 0);
+  std::sort(sorted_entries.begin(), sorted_entries.end(),
+            [&](Int32 a, Int32 b) { return compare_entry(a, b) < 0; });
+
+  Int64 expected_uid = 0;
+  Int32 nb_error = 0;
+  for (Int32 begin = 0; begin < nb_entry;) {
+    Int32 end = begin + 1;
+    while (end < nb_entry && compare_entry(sorted_entries[begin], sorted_entries[end]) == 0)
+      ++end;
+    for (Int32 z = begin; z < end; ++z) {
+      const Int64* k = all_infos.data() + entry_positions[sorted_entries[z]];
+      Int64 uid = k[1 + k[0]];
+      if (uid != expected_uid) {
+        if (nb_error < 10)
+          error() << "Bad uniqueId for item kind=" << m_item_kind
+                  << " first_node_uid=" << k[1] << " uid=" << uid
+                  << " expected=" << expected_uid;
+        ++nb_error;
+      }
+    }
+    ++expected_uid;
+    begin = end;
+  }
+  if (nb_error != 0)
+    ARCANE_FATAL("Bad uniqueId() for '{0}' items of kind '{1}' compared to sequential reference",
+                 nb_error, m_item_kind);
+  info() << "Hash uniqueId() check OK kind=" << m_item_kind << " nb_item=" << expected_uid;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+extern "C++" void
+arcaneComputeFaceUniqueIdWithHash(DynamicMesh* mesh)
+{
+  HashUniqueIdBuilder builder(mesh, IK_Face);
+  builder.computeUniqueIdAndOwner();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+extern "C++" void
+arcaneComputeEdgeUniqueIdWithHash(DynamicMesh* mesh)
+{
+  HashUniqueIdBuilder builder(mesh, IK_Edge);
+  builder.computeUniqueIdAndOwner();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::mesh
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
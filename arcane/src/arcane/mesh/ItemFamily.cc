@@ -1,6 +1,6 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
@@ -146,6 +146,13 @@ class ItemFamily::InternalApi
   {
     return m_family->_resizeVariables(force_resize);
   }
+  IItemInternalSortFunction* swapItemSortFunction(IItemInternalSortFunction* sort_function) override
+  {
+    ARCANE_CHECK_POINTER(sort_function);
+    IItemInternalSortFunction* old_sort_function = m_family->m_item_sort_function;
+    m_family->m_item_sort_function = sort_function;
+    return old_sort_function;
+  }
 
  private:
 
@@ -581,7 +588,7 @@ _endUpdate(bool need_check_remove)
 
   _resizeVariables(false);
   info(4) << "ItemFamily:endUpdate(): " << fullName()
-          << " hashmapsize=" << itemsMap().buckets().size()
+          << " hashmapsize=" << itemsMap().capacity()
           << " nb_group=" << m_item_groups.count();
 
   _updateGroups(need_check_remove);
@@ -615,7 +622,10 @@ _updateGroup(ItemGroup group,bool need_check_remove)
   if (group==m_infos.allItems())
     return;
 
-  if (group.internal()->hasComputeFunctor())
+  // Les groupes mis à jour de manière incrémentale l'ont déjà été lors
+  // de la modification de leur groupe parent.
+  ItemGroupImpl* group_impl = group.internal();
+  if (group_impl->hasComputeFunctor() && !group_impl->isIncrementalUpdate())
     group.invalidate();
   if (need_check_remove){
     debug(Trace::High) << "Reset SuppressedItems: " << group.name();
@@ -860,9 +870,27 @@ void ItemFamily::
 notifyItemsOwnerChanged()
 {
   debug() << "ItemFamily::notifyItemsOwnerChanged()";
-  for( ItemGroup group : m_item_groups ){
-    if (m_is_parallel && group.internal()->hasComputeFunctor())
-      group.invalidate();
+  if (m_is_parallel){
+    // Les groupes mis à jour de manière incrémentale sont modifiés à partir
+    // de la liste des entités dont le propriétaire a changé. Les autres
+    // groupes calculés sont invalidés.
+    Int32UniqueArray changed_lids;
+    bool has_changed_lids = false;
+    for( ItemGroup group : m_item_groups ){
+      if (group.internal()->isIncrementalUpdate()){
+        has_changed_lids = allItems().internal()->computeItemsOwnerChanged(changed_lids);
+        break;
+      }
+    }
+    for( ItemGroup group : m_item_groups ){
+      ItemGroupImpl* group_impl = group.internal();
+      if (!group_impl->hasComputeFunctor())
+        continue;
+      if (has_changed_lids && group_impl->isIncrementalUpdate())
+        group_impl->updateItemsOwnerChanged(changed_lids);
+      else
+        group.invalidate();
+    }
   }
 
   // Propage les modifications sur les sous-familles
@@ -1359,6 +1387,7 @@ _compactItems(bool do_sort)
 
   try{
     compacter->setSorted(do_sort);
+    compacter->setIncrementalThreshold(mesh()->properties()->getRealWithDefault("compact-incremental-threshold",0.0));
     compacter->doAllActions();
   }
   catch(...){
@@ -1707,7 +1736,7 @@ void ItemFamily::
 _preAllocate(Int32 nb_item,bool pre_alloc_connectivity)
 {
   if (nb_item>1000)
-    m_infos.itemsMap().resize(nb_item,true);
+    m_infos.itemsMap().reserve(nb_item);
   _resizeItemVariables(nb_item,false);
   for( auto& c : m_source_incremental_item_connectivities )
     c->reserveMemoryForNbSourceItems(nb_item,pre_alloc_connectivity);
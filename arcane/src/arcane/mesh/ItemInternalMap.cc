@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ItemInternalMap.cc                                          (C) 2000-2021 */
+/* ItemInternalMap.cc                                          (C) 2000-2023 */
 /*                                                                           */
 /* Tableau associatif de ItemInternal.                                       */
 /*---------------------------------------------------------------------------*/
@@ -16,6 +16,7 @@
 #include "arcane/utils/ArrayView.h"
 #include "arcane/utils/Iterator.h"
 #include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/Math.h"
 
 #include "arcane/ItemInternal.h"
 
@@ -32,7 +33,7 @@ namespace Arcane::mesh
 
 ItemInternalMap::
 ItemInternalMap()
-: BaseClass(5000,false)
+: BaseClass(5000)
 {
 }
 
@@ -64,6 +65,34 @@ notifyUniqueIdsChanged()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+Int32 ItemInternalMap::
+lookupLocalIds(Int64ConstArrayView unique_ids,Int32ArrayView local_ids) const
+{
+  const Int32 block_size = 64;
+  const Data* datas[block_size];
+  Int32 nb_not_found = 0;
+  const Int32 n = unique_ids.size();
+  for( Int32 begin=0; begin<n; begin+=block_size ){
+    Int32 size = math::min(block_size,n-begin);
+    Int64ConstArrayView block_uids = unique_ids.subView(begin,size);
+    lookupMany(block_uids,ArrayView<const Data*>(size,datas));
+    for( Int32 i=0; i<size; ++i ){
+      const Data* d = datas[i];
+      if (d)
+        local_ids[begin+i] = d->value()->localId();
+      else{
+        local_ids[begin+i] = NULL_ITEM_LOCAL_ID;
+        if (block_uids[i]!=NULL_ITEM_UNIQUE_ID)
+          ++nb_not_found;
+      }
+    }
+  }
+  return nb_not_found;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 } // End namespace Arcane::mesh
 
 /*---------------------------------------------------------------------------*/
@@ -14,7 +14,7 @@
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
-#include "arcane/utils/HashTableMap.h"
+#include "arcane/utils/OpenHashTableMap.h"
 
 #include "arcane/mesh/MeshGlobal.h"
 
@@ -40,16 +40,33 @@ namespace Arcane::mesh
  * La clé de ce tableau associatif est le UniqueId des entités.
  * S'il change, il faut appeler notifyUniqueIdsChanged() pour remettre
  * à jour le tableau associatif.
+ *
+ * Ce tableau utilise une table de hachage à adressage ouvert
+ * (OpenHashTableMapT). Les pointeurs sur Data retournés par lookup() ou
+ * lookupAdd() ne sont donc valides que jusqu'à la prochaine modification
+ * du tableau.
  */
 class ItemInternalMap
-: public HashTableMapT<Int64,ItemInternal*>
+: public OpenHashTableMapT<Int64,ItemInternal*>
 {
  private:
-  typedef HashTableMapT<Int64,ItemInternal*> BaseClass;
+  typedef OpenHashTableMapT<Int64,ItemInternal*> BaseClass;
  public:
   ItemInternalMap();
  public:
   void notifyUniqueIdsChanged();
+  /*!
+   * \brief Recherche les numéros locaux des entités de numéros uniques \a unique_ids.
+   *
+   * En retour, \a local_ids[i] contient le numéro local de l'entité
+   * de numéro unique \a unique_ids[i] ou NULL_ITEM_LOCAL_ID si elle n'est
+   * pas présente. Les recherches sont faites par lots (voir
+   * OpenHashTableMapT::lookupMany()).
+   *
+   * \return le nombre d'entités non trouvées dont le numéro unique
+   * n'est pas NULL_ITEM_UNIQUE_ID.
+   */
+  Int32 lookupLocalIds(Int64ConstArrayView unique_ids,Int32ArrayView local_ids) const;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -57,8 +74,7 @@ class ItemInternalMap
 
 //! Macro pour itérer sur les valeurs d'un ItemInternalMap
 #define ENUMERATE_ITEM_INTERNAL_MAP_DATA(iter,item_list) \
-for( auto __i__##iter : item_list .buckets() ) \
-  for( Arcane::mesh::ItemInternalMap::Data* iter = __i__##iter; iter; iter = iter->next() )
+for( Arcane::mesh::ItemInternalMap::Data* iter : (item_list).dataRange() )
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MeshCompacter.h                                             (C) 2000-2016 */
+/* MeshCompacter.h                                             (C) 2000-2023 */
 /*                                                                           */
 /* Gestion d'un compactage de familles du maillage.                          */
 /*---------------------------------------------------------------------------*/
@@ -75,11 +75,13 @@ class ARCANE_MESH_EXPORT MeshCompacter
   const ItemFamilyCompactInfos* findCompactInfos(IItemFamily* family) const override;
   ePhase phase() const override { return m_phase; }
   bool isSorted() const override { return m_is_sorted; }
+  Real incrementalThreshold() const override { return m_incremental_threshold; }
   ItemFamilyCollection families() const override;
 
  public:
 
   void setSorted(bool v) override;
+  void setIncrementalThreshold(Real v) override;
   void _setCompactVariablesAndGroups(bool v) override;
 
  private:
@@ -89,6 +91,7 @@ class ARCANE_MESH_EXPORT MeshCompacter
   ITimeStats* m_time_stats;
   ePhase m_phase;
   bool m_is_sorted;
+  Real m_incremental_threshold = 0.0;
   bool m_is_compact_variables_and_groups;
   List<IItemFamily*> m_item_families;
 
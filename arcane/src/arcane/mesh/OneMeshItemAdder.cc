@@ -24,9 +24,14 @@
 
 #include "arcane/utils/NotSupportedException.h"
 
+#include "arcane/core/Concurrency.h"
+
 #include "arcane/mesh/ConnectivityNewWithDependenciesTypes.h"
 #include "arcane/mesh/GraphDoFs.h"
 
+#include <algorithm>
+#include <numeric>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -74,6 +79,76 @@ class OneMeshItemAdder::CellInfoProxy
   bool m_allow_build_face;
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Informations sur les faces d'une liste de mailles.
+ *
+ * Ces informations sont calculées en parallèle par _computeCellFacesInfo().
+ * Chaque face d'une maille (face locale) est repérée par un indice unique
+ * dans la liste des faces locales de toutes les mailles. Les faces locales
+ * qui correspondent à la même face ont le même indice de face.
+ */
+class OneMeshItemAdder::CellFacesInfo
+{
+ public:
+
+  ConstArrayView<Int64> sortedNodes(Int32 slot) const
+  {
+    Int32 begin = m_slot_first_node[slot];
+    return m_sorted_nodes.subConstView(begin,m_slot_first_node[slot+1]-begin);
+  }
+
+ public:
+
+  //! Position dans la liste des infos de la première valeur de chaque maille
+  Int32UniqueArray m_cell_info_index;
+  //! Indice de la première face locale de chaque maille
+  Int32UniqueArray m_cell_first_slot;
+  //! Indice dans \a m_sorted_nodes du premier noeud de chaque face locale
+  Int32UniqueArray m_slot_first_node;
+  //! Type de chaque face locale
+  UniqueArray<Int16> m_slot_type;
+  //! Indique si les noeuds de la face locale ont été réordonnés
+  UniqueArray<Byte> m_slot_is_reorder;
+  //! Noeuds réordonnés via reorderNodesOfFace() de chaque face locale
+  Int64UniqueArray m_sorted_nodes;
+  //! Indice de la face de chaque face locale
+  Int32UniqueArray m_slot_face_index;
+  //! Face associée à chaque indice de face (nullptr si pas encore créée)
+  UniqueArray<ItemInternal*> m_faces;
+  //! Indique si la famille des faces contenait déjà des faces
+  bool m_has_existing_faces = false;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class OneMeshItemAdder::PrecomputedCellInfoProxy
+: public CellInfoProxy
+{
+ public:
+
+  PrecomputedCellInfoProxy(ItemTypeInfo* type_info,
+                           Int64 cell_uid,
+                           Int32 sub_domain_id,
+                           Int64ConstArrayView info,
+                           bool allow_build_face,
+                           CellFacesInfo* faces_info,
+                           Int32 cell_index)
+  : CellInfoProxy(type_info,cell_uid,sub_domain_id,info,allow_build_face)
+  , m_faces_info(faces_info)
+  , m_first_slot(faces_info->m_cell_first_slot[cell_index]) {}
+
+  CellFacesInfo* facesInfo() const { return m_faces_info; }
+  Int32 faceSlot(Integer i_face) const { return m_first_slot + i_face; }
+
+ private:
+
+  CellFacesInfo* m_faces_info;
+  Int32 m_first_slot;
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -289,6 +364,70 @@ _findInternalEdge(Integer i_edge, const CellInfoProxy& cell_info, Int64 first_no
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+template<>
+Face OneMeshItemAdder::
+_findInternalFace(Integer i_face, const PrecomputedCellInfoProxy& cell_info, bool& is_add)
+{
+  CellFacesInfo* faces_info = cell_info.facesInfo();
+  const Int32 slot = cell_info.faceSlot(i_face);
+  const Int32 face_index = faces_info->m_slot_face_index[slot];
+  ItemInternal* face = faces_info->m_faces[face_index];
+  if (face){
+    is_add = false;
+    return face;
+  }
+  // S'il y avait déjà des faces, il faut regarder si la face existe.
+  // On utilise aussi la recherche classique pour générer
+  // le message d'erreur si on n'a pas le droit de créer la face.
+  if (faces_info->m_has_existing_faces || !cell_info.allowBuildFace())
+    face = ItemCompatibility::_itemInternal(_findInternalFace<CellInfoProxy>(i_face,cell_info,is_add));
+  else{
+    ItemTypeInfo* face_type = m_item_type_mng->typeFromId(faces_info->m_slot_type[slot]);
+    face = m_face_family.allocOne(m_next_face_uid++,face_type);
+    is_add = true;
+  }
+  faces_info->m_faces[face_index] = face;
+  return face;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+template<>
+Edge OneMeshItemAdder::
+_findInternalEdge(Integer i_edge, const PrecomputedCellInfoProxy& cell_info,
+                  Int64 first_node, Int64 second_node, bool& is_add)
+{
+  return _findInternalEdge<CellInfoProxy>(i_edge,cell_info,first_node,second_node,is_add);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+template<>
+bool OneMeshItemAdder::
+_isReorder(Integer i_face, const ItemTypeInfo::LocalFace& lf, const PrecomputedCellInfoProxy& cell_info)
+{
+  ARCANE_UNUSED(lf);
+  const CellFacesInfo* faces_info = cell_info.facesInfo();
+  const Int32 slot = cell_info.faceSlot(i_face);
+  m_work_face_sorted_nodes.copy(faces_info->sortedNodes(slot));
+  return faces_info->m_slot_is_reorder[slot]!=0;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+template<> void OneMeshItemAdder::
+_AMR_Patch(Cell cell, const PrecomputedCellInfoProxy& cell_info)
+{
+  ARCANE_UNUSED(cell);
+  ARCANE_UNUSED(cell_info);
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -332,6 +471,181 @@ addOneCell(const FullCellInfo& cell_info)
   return _addOneCell(cell_info);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Ajoute une liste de mailles.
+ *
+ * Le format de \a cells_infos est le même que pour
+ * DynamicMeshIncrementalBuilder::addCells().
+ *
+ * Contrairement à des appels successifs à addOneCell(), la détermination
+ * des faces (réordonnancement des noeuds des faces et recherche des faces
+ * communes à plusieurs mailles) est effectuée en parallèle via le
+ * mécanisme des tâches. Seule la création des entités dans les familles,
+ * qui n'est pas thread-safe, est faite séquentiellement.
+ *
+ * Si \a cells n'est pas vide, il doit avoir \a nb_cell éléments et
+ * contiendra en retour les numéros locaux des mailles.
+ */
+void OneMeshItemAdder::
+addCells(Integer nb_cell, Int64ConstArrayView cells_infos, Int32 sub_domain_id,
+         Int32ArrayView cells, bool allow_build_face)
+{
+  CellFacesInfo faces_info;
+  faces_info.m_has_existing_faces = (m_face_family.nbItem()!=0);
+  _computeCellFacesInfo(nb_cell,cells_infos,faces_info);
+
+  const bool add_to_cells = !cells.empty();
+  for( Integer i_cell=0; i_cell<nb_cell; ++i_cell ){
+    Int32 index = faces_info.m_cell_info_index[i_cell];
+    ItemTypeId item_type_id(static_cast<Int16>(cells_infos[index]));
+    ItemTypeInfo* type_info = m_item_type_mng->typeFromId(item_type_id);
+    Int64 cell_uid = cells_infos[index+1];
+    Integer nb_node = type_info->nbLocalNode();
+    PrecomputedCellInfoProxy cell_info(type_info,cell_uid,sub_domain_id,
+                                       cells_infos.subConstView(index+2,nb_node),
+                                       allow_build_face,&faces_info,i_cell);
+    ItemInternal* cell = _addOneCell(cell_info);
+    if (add_to_cells)
+      cells[i_cell] = cell->localId();
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule en parallèle les informations sur les faces des mailles.
+ *
+ * Les noeuds de chaque face locale sont réordonnés comme dans _isReorder().
+ * Les faces locales sont ensuite triées suivant leur type puis leur liste
+ * de noeuds réordonnés, ce qui permet d'associer le même indice de face
+ * aux faces locales identiques.
+ */
+void OneMeshItemAdder::
+_computeCellFacesInfo(Integer nb_cell, Int64ConstArrayView cells_infos, CellFacesInfo& faces_info)
+{
+  // Calcule séquentiellement les positions de chaque maille et face locale.
+  faces_info.m_cell_info_index.resize(nb_cell);
+  faces_info.m_cell_first_slot.resize(nb_cell+1);
+  Int32 nb_slot = 0;
+  {
+    Int32 index = 0;
+    for( Integer i_cell=0; i_cell<nb_cell; ++i_cell ){
+      ItemTypeId item_type_id(static_cast<Int16>(cells_infos[index]));
+      ItemTypeInfo* type_info = m_item_type_mng->typeFromId(item_type_id);
+      faces_info.m_cell_info_index[i_cell] = index;
+      faces_info.m_cell_first_slot[i_cell] = nb_slot;
+      nb_slot += type_info->nbLocalFace();
+      index += 2 + type_info->nbLocalNode();
+    }
+    faces_info.m_cell_first_slot[nb_cell] = nb_slot;
+  }
+  faces_info.m_slot_first_node.resize(nb_slot+1);
+  faces_info.m_slot_type.resize(nb_slot);
+  faces_info.m_slot_is_reorder.resize(nb_slot);
+  {
+    Int32 nb_face_node = 0;
+    Int32 slot = 0;
+    for( Integer i_cell=0; i_cell<nb_cell; ++i_cell ){
+      Int32 index = faces_info.m_cell_info_index[i_cell];
+      ItemTypeInfo* type_info = m_item_type_mng->typeFromId(ItemTypeId(static_cast<Int16>(cells_infos[index])));
+      for( Integer i_face=0, n=type_info->nbLocalFace(); i_face<n; ++i_face ){
+        ItemTypeInfo::LocalFace lf = type_info->localFace(i_face);
+        faces_info.m_slot_first_node[slot] = nb_face_node;
+        faces_info.m_slot_type[slot] = static_cast<Int16>(lf.typeId());
+        nb_face_node += lf.nbNode();
+        ++slot;
+      }
+    }
+    faces_info.m_slot_first_node[nb_slot] = nb_face_node;
+    faces_info.m_sorted_nodes.resize(nb_face_node);
+  }
+
+  // Réordonne en parallèle les noeuds des faces.
+  const bool is_1d = (m_mesh->dimension() == 1);
+  arcaneParallelFor(0,nb_cell,[&](Integer begin,Integer size){
+    Int64UniqueArray orig_nodes;
+    for( Integer i_cell=begin; i_cell<(begin+size); ++i_cell ){
+      Int32 index = faces_info.m_cell_info_index[i_cell];
+      ItemTypeInfo* type_info = m_item_type_mng->typeFromId(ItemTypeId(static_cast<Int16>(cells_infos[index])));
+      Int64ConstArrayView cell_nodes = cells_infos.subConstView(index+2,type_info->nbLocalNode());
+      Int32 slot = faces_info.m_cell_first_slot[i_cell];
+      for( Integer i_face=0, n=type_info->nbLocalFace(); i_face<n; ++i_face, ++slot ){
+        ItemTypeInfo::LocalFace lf = type_info->localFace(i_face);
+        const Integer face_nb_node = lf.nbNode();
+        orig_nodes.resize(face_nb_node);
+        for( Integer i_node=0; i_node<face_nb_node; ++i_node )
+          orig_nodes[i_node] = cell_nodes[lf.node(i_node)];
+        Int32 first_node = faces_info.m_slot_first_node[slot];
+        Int64ArrayView sorted_nodes = faces_info.m_sorted_nodes.subView(first_node,face_nb_node);
+        bool is_reorder = false;
+        if (is_1d){
+          is_reorder = (i_face==1);
+          sorted_nodes[0] = orig_nodes[0];
+        }
+        else
+          is_reorder = mesh_utils::reorderNodesOfFace(orig_nodes,sorted_nodes);
+        faces_info.m_slot_is_reorder[slot] = (is_reorder) ? 1 : 0;
+      }
+    }
+  });
+
+  // Trie les faces locales par blocs en parallèle puis fusionne les blocs.
+  auto slot_less = [&](Int32 a,Int32 b) -> bool
+  {
+    Int16 type_a = faces_info.m_slot_type[a];
+    Int16 type_b = faces_info.m_slot_type[b];
+    if (type_a!=type_b)
+      return type_a < type_b;
+    ConstArrayView<Int64> nodes_a = faces_info.sortedNodes(a);
+    ConstArrayView<Int64> nodes_b = faces_info.sortedNodes(b);
+    return std::lexicographical_compare(nodes_a.begin(),nodes_a.end(),nodes_b.begin(),nodes_b.end());
+  };
+  Int32UniqueArray sorted_slots(nb_slot);
+  std::iota(sorted_slots.begin(),sorted_slots.end(),0);
+  {
+    const Int32 nb_block = math::max(1,math::min(TaskFactory::nbAllowedThread(),nb_slot/10000));
+    Int32UniqueArray block_begin(nb_block+1);
+    for( Int32 i=0; i<=nb_block; ++i )
+      block_begin[i] = static_cast<Int32>((static_cast<Int64>(nb_slot) * i) / nb_block);
+    Int32* slots = sorted_slots.data();
+    ParallelLoopOptions options;
+    options.setGrainSize(1);
+    arcaneParallelFor(0,nb_block,options,[&](Integer begin,Integer size){
+      for( Integer i=begin; i<(begin+size); ++i )
+        std::sort(slots+block_begin[i],slots+block_begin[i+1],slot_less);
+    });
+    for( Int32 step=1; step<nb_block; step *= 2 ){
+      Int32 nb_merge = (nb_block + 2*step - 1) / (2*step);
+      arcaneParallelFor(0,nb_merge,options,[&](Integer begin,Integer size){
+        for( Integer i=begin; i<(begin+size); ++i ){
+          Int32 first = 2*step*i;
+          Int32 middle = first + step;
+          if (middle>=nb_block)
+            continue;
+          Int32 last = math::min(middle+step,nb_block);
+          std::inplace_merge(slots+block_begin[first],slots+block_begin[middle],
+                             slots+block_begin[last],slot_less);
+        }
+      });
+    }
+  }
+
+  // Les faces locales identiques sont maintenant consécutives.
+  faces_info.m_slot_face_index.resize(nb_slot);
+  Int32 nb_face = 0;
+  for( Int32 i=0; i<nb_slot; ++i ){
+    if (i!=0 && slot_less(sorted_slots[i-1],sorted_slots[i]))
+      ++nb_face;
+    faces_info.m_slot_face_index[sorted_slots[i]] = nb_face;
+  }
+  if (nb_slot!=0)
+    ++nb_face;
+  faces_info.m_faces.resize(nb_face);
+  faces_info.m_faces.fill(nullptr);
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* OneMeshItemAdder.h                                          (C) 2000-2022 */
+/* OneMeshItemAdder.h                                          (C) 2000-2023 */
 /*                                                                           */
 /* Outil de création d'une maille                                            */
 /*---------------------------------------------------------------------------*/
@@ -49,6 +49,9 @@ private:
   // Classe servant à rendre compatible les données FullCellInfo
   // et les données fragmentées de description d'une maille
   class CellInfoProxy;
+  // Informations sur les faces des mailles calculées en parallèle
+  class CellFacesInfo;
+  class PrecomputedCellInfoProxy;
   
 public:
   
@@ -83,6 +86,12 @@ public:
  
   ItemInternal* addOneCell(const FullCellInfo& cell_info);
 
+  void addCells(Integer nb_cell,
+                Int64ConstArrayView cells_infos,
+                Int32 sub_domain_id,
+                Int32ArrayView cells,
+                bool allow_build_face);
+
   // NOTE GG: A priori plus utilisé
   ARCANE_DEPRECATED_REASON("Y2022: Use addOneItem2() instead")
   ItemInternal* addOneItem(IItemFamily* family,
@@ -144,6 +153,7 @@ public:
   template<typename CellInfo>
   void _AMR_Patch(Cell cell, const CellInfo& cell_info);
 
+  void _computeCellFacesInfo(Integer nb_cell,Int64ConstArrayView cells_infos,CellFacesInfo& faces_info);
   void _clearConnectivity(ItemLocalId item, IIncrementalItemConnectivity* connectivity);
   void _clearReverseConnectivity(ItemLocalId item, IIncrementalItemConnectivity* connectivity, IIncrementalItemConnectivity* reverse_connectivity);
   void _printRelations(ItemInternal* item);
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ParticleFamily.cc                                           (C) 2000-2022 */
+/* ParticleFamily.cc                                           (C) 2000-2023 */
 /*                                                                           */
 /* Famille de particules.                                                    */
 /*---------------------------------------------------------------------------*/
@@ -348,10 +348,7 @@ readFromDump()
 void ParticleFamily::
 preAllocate(Integer nb_item)
 {
-  Integer nb_hash = itemsMap().buckets().size();
-  Integer wanted_size = 2*(nb_item+infos().nbItem());
-  if (nb_hash<wanted_size)
-    itemsMap().resize(wanted_size,true);
+  itemsMap().reserve(nb_item+infos().nbItem());
 }
 
 /*---------------------------------------------------------------------------*/
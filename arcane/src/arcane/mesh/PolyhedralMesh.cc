@@ -1,6 +1,6 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
@@ -99,10 +99,7 @@ namespace mesh
 
     void preAllocate(Integer nb_item)
     {
-      Integer nb_hash = itemsMap().buckets().size();
-      Integer wanted_size = 2 * (nb_item + infos().nbItem());
-      if (nb_hash < wanted_size)
-        itemsMap().resize(wanted_size, true);
+      itemsMap().reserve(nb_item + infos().nbItem());
       m_empty_connectivity_indexes.resize(nb_item + nbItem(), 0);
       m_empty_connectivity_nb_item.resize(nb_item + nbItem(), 0);
       _updateEmptyConnectivity();
@@ -25,6 +25,7 @@ set( ARCANE_SOURCES
   GhostLayerBuilder.cc
   GhostLayerBuilder.h
   GhostLayerBuilder2.cc
+  HashUniqueIdBuilder.cc
   FullItemInfo.cc
   FullItemInfo.h
   OneMeshItemAdder.cc
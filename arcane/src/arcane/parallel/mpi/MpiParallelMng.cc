@@ -26,6 +26,9 @@
 #include "arcane/core/IIOMng.h"
 #include "arcane/core/Timer.h"
 #include "arcane/core/IItemFamily.h"
+#include "arcane/core/IMesh.h"
+#include "arcane/core/IVariableMng.h"
+#include "arcane/core/IVariableSynchronizerMng.h"
 #include "arcane/core/SerializeMessage.h"
 #include "arcane/core/parallel/IStat.h"
 
@@ -44,6 +47,7 @@
 #include "arcane/impl/SequentialParallelMng.h"
 #include "arcane/impl/ParallelMngUtilsFactoryBase.h"
 #include "arcane/impl/internal/VariableSynchronizer.h"
+#include "arcane/impl/internal/AutoTuneDataSynchronizeImplementation.h"
 
 #include "arccore/message_passing_mpi/MpiMessagePassingMng.h"
 #include "arccore/message_passing_mpi/MpiRequestList.h"
@@ -52,6 +56,8 @@
 #include "arccore/message_passing/Messages.h"
 #include "arccore/message_passing/SerializeMessageList.h"
 
+#include <memory>
+
 //#define ARCANE_TRACE_MPI
 
 /*---------------------------------------------------------------------------*/
@@ -81,6 +87,12 @@ extern "C++" Ref<IDataSynchronizeImplementationFactory>
 arcaneCreateMpiDirectSendrecvVariableSynchronizerFactory(MpiParallelMng* mpi_pm);
 extern "C++" Ref<IDataSynchronizeImplementationFactory>
 arcaneCreateMpiLegacyVariableSynchronizerFactory(MpiParallelMng* mpi_pm);
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateMpiPersistentVariableSynchronizerFactory(MpiParallelMng* mpi_pm);
+class MpiSharedWindowSynchronizeInfo;
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateMpiSharedWindowVariableSynchronizerFactory(MpiParallelMng* mpi_pm,
+                                                       std::shared_ptr<MpiSharedWindowSynchronizeInfo>& window_info);
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -266,6 +278,12 @@ class MpiParallelMngUtilsFactory
     }
     if (platform::getEnvironmentVariable("ARCANE_SYNCHRONIZE_VERSION")=="5")
       m_synchronizer_version = 5;
+    if (platform::getEnvironmentVariable("ARCANE_SYNCHRONIZE_VERSION")=="6")
+      m_synchronizer_version = 6;
+    if (platform::getEnvironmentVariable("ARCANE_SYNCHRONIZE_VERSION")=="7")
+      m_synchronizer_version = 7;
+    if (platform::getEnvironmentVariable("ARCANE_SYNCHRONIZE_VERSION")=="auto")
+      _initAutoTune();
   }
  public:
 
@@ -281,6 +299,37 @@ class MpiParallelMngUtilsFactory
 
  private:
 
+  /*!
+   * \brief Initialise la sélection automatique de l'implémentation.
+   *
+   * La liste des versions candidates peut être spécifiée via la variable
+   * d'environnement ARCANE_SYNCHRONIZE_AUTOTUNE_VERSIONS (par exemple '2:3:6')
+   * et le nombre de mesures par version via ARCANE_SYNCHRONIZE_AUTOTUNE_NB_TRIAL.
+   */
+  void _initAutoTune()
+  {
+    m_use_auto_tune = true;
+    String v = platform::getEnvironmentVariable("ARCANE_SYNCHRONIZE_AUTOTUNE_VERSIONS");
+    if (!v.null()){
+      UniqueArray<String> values;
+      v.split(values,':');
+      for( const String& x : values ){
+        Int32 version = 0;
+        if (builtInGetValue(version,x) || version<1 || version>7)
+          ARCANE_FATAL("Invalid value '{0}' in ARCANE_SYNCHRONIZE_AUTOTUNE_VERSIONS",x);
+        m_auto_tune_versions.add(version);
+      }
+    }
+    else{
+      m_auto_tune_versions = { 1, 2, 3, 4, 6, 7 };
+#if defined(ARCANE_HAS_MPI_NEIGHBOR)
+      m_auto_tune_versions.add(5);
+#endif
+    }
+    if (auto nb_trial = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_SYNCHRONIZE_AUTOTUNE_NB_TRIAL",true))
+      m_auto_tune_nb_trial = std::clamp(nb_trial.value(),1,1000);
+  }
+
   Ref<IVariableSynchronizer> _createSynchronizer(IParallelMng* pm,const ItemGroup& group)
   {
     Ref<IVariableSynchronizerMpiCommunicator> topology_info;
@@ -290,45 +339,85 @@ class MpiParallelMngUtilsFactory
     // N'affiche les informations que pour le groupe de toutes les mailles pour éviter d'afficher
     // plusieurs fois le même message.
     bool do_print = (group.isAllItems() && group.itemKind()==IK_Cell);
-    if (m_synchronizer_version == 2){
+    if (m_use_auto_tune){
+      if (do_print)
+        tm->info() << "Using automatic selection of MpiSynchronizer versions=" << m_auto_tune_versions
+                   << " nb_trial=" << m_auto_tune_nb_trial;
+      UniqueArray<DataSynchronizeImplementationCandidate> candidates;
+      for( Int32 version : m_auto_tune_versions ){
+        String name = String("V") + String::fromNumber(version);
+        candidates.add(DataSynchronizeImplementationCandidate(name,_createFactory(mpi_pm,version,topology_info,false)));
+      }
+      IVariableSynchronizerMng* sync_mng = group.itemFamily()->mesh()->variableMng()->synchronizerMng();
+      generic_factory = arcaneCreateAutoTuneVariableSynchronizerFactory(pm,sync_mng->_internalApi(),candidates,m_auto_tune_nb_trial);
+    }
+    else
+      generic_factory = _createFactory(mpi_pm,m_synchronizer_version,topology_info,do_print);
+    if (!generic_factory.get())
+      ARCANE_FATAL("No factory created");
+    return makeRef<IVariableSynchronizer>(new MpiVariableSynchronizer(pm,group,generic_factory,topology_info));
+  }
+
+  Ref<IDataSynchronizeImplementationFactory>
+  _createFactory(MpiParallelMng* mpi_pm,Int32 version,Ref<IVariableSynchronizerMpiCommunicator>& topology_info,
+                 bool do_print)
+  {
+    ITraceMng* tm = mpi_pm->traceMng();
+    Ref<IDataSynchronizeImplementationFactory> generic_factory;
+    if (version == 2){
       if (do_print)
         tm->info() << "Using MpiSynchronizer V2";
       generic_factory = arcaneCreateMpiVariableSynchronizerFactory(mpi_pm);
     }
-    else if (m_synchronizer_version == 3 ){
+    else if (version == 3 ){
       if (do_print)
         tm->info() << "Using MpiSynchronizer V3";
       generic_factory = arcaneCreateMpiDirectSendrecvVariableSynchronizerFactory(mpi_pm);
     }
-    else if (m_synchronizer_version == 4){
+    else if (version == 4){
       if (do_print)
         tm->info() << "Using MpiSynchronizer V4 block_size=" << m_synchronize_block_size
                    << " nb_sequence=" << m_synchronize_nb_sequence;
       generic_factory = arcaneCreateMpiBlockVariableSynchronizerFactory(mpi_pm,m_synchronize_block_size,m_synchronize_nb_sequence);
     }
-    else if (m_synchronizer_version == 5){
+    else if (version == 5){
       if (do_print)
         tm->info() << "Using MpiSynchronizer V5";
-      topology_info = makeRef<IVariableSynchronizerMpiCommunicator>(new VariableSynchronizerMpiCommunicator(mpi_pm));
+      if (!topology_info.get())
+        topology_info = makeRef<IVariableSynchronizerMpiCommunicator>(new VariableSynchronizerMpiCommunicator(mpi_pm));
 #if defined(ARCANE_HAS_MPI_NEIGHBOR)
       generic_factory = arcaneCreateMpiNeighborVariableSynchronizerFactory(mpi_pm,topology_info);
 #else
       throw NotSupportedException(A_FUNCINFO,"Synchronize implementation V5 is not supported with this version of MPI");
 #endif
     }
+    else if (version == 6){
+      if (do_print)
+        tm->info() << "Using MpiSynchronizer V6 (persistent requests)";
+      generic_factory = arcaneCreateMpiPersistentVariableSynchronizerFactory(mpi_pm);
+    }
+    else if (version == 7){
+      if (do_print)
+        tm->info() << "Using MpiSynchronizer V7 (shared memory windows)";
+      generic_factory = arcaneCreateMpiSharedWindowVariableSynchronizerFactory(mpi_pm,m_shared_window_info);
+    }
     else{
       if (do_print)
         tm->info() << "Using MpiSynchronizer V1";
       generic_factory = arcaneCreateMpiLegacyVariableSynchronizerFactory(mpi_pm);
     }
-    if (!generic_factory.get())
-      ARCANE_FATAL("No factory created");
-    return makeRef<IVariableSynchronizer>(new MpiVariableSynchronizer(pm,group,generic_factory,topology_info));
+    return generic_factory;
   }
+
  private:
   Integer m_synchronizer_version = 1;
   Int32 m_synchronize_block_size = 32000;
   Int32 m_synchronize_nb_sequence = 1;
+  bool m_use_auto_tune = false;
+  UniqueArray<Int32> m_auto_tune_versions;
+  Int32 m_auto_tune_nb_trial = 3;
+  //! Fenêtre partagée par les synchroniseurs utilisant la version 7
+  std::shared_ptr<MpiSharedWindowSynchronizeInfo> m_shared_window_info;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,381 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* MpiPersistentVariableSynchronizeDispatcher.cc               (C) 2000-2023 */
+/*                                                                           */
+/* Synchronisations des variables via des requêtes MPI persistantes.         */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/CheckedConvert.h"
+#include "arcane/utils/MemoryView.h"
+
+#include "arcane/parallel/mpi/MpiParallelMng.h"
+#include "arcane/parallel/mpi/MpiAdapter.h"
+#include "arcane/parallel/mpi/MpiTimeInterval.h"
+#include "arcane/parallel/IStat.h"
+
+#include "arcane/impl/IDataSynchronizeBuffer.h"
+#include "arcane/impl/IDataSynchronizeImplementation.h"
+#include "arcane/impl/DataSynchronizeInfo.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*
+ * Cette implémentation utilise des requêtes persistantes MPI
+ * (MPI_Send_init/MPI_Recv_init) pour les synchronisations.
+ *
+ * Les requêtes dépendent de l'adresse et de la taille des buffers d'envoi
+ * et de réception. Comme ces derniers dépendent du type de donnée
+ * synchronisée et du buffer fourni par le IVariableSynchronizerMng, on
+ * conserve un petit cache de jeux de requêtes indexé par ces valeurs.
+ * Si on trouve un jeu de requêtes correspondant aux buffers, il suffit
+ * de faire un MPI_Startall() puis un MPI_Waitall(). Sinon, on créé un
+ * nouveau jeu de requêtes.
+ *
+ * Le cache est invalidé à chaque appel à compute(), ce qui est le cas
+ * lorsque les informations de synchronisation changent (par exemple après
+ * un changement de topologie du maillage).
+ *
+ * L'algorithme est le suivant:
+ *
+ * 1. Recherche ou construit le jeu de requêtes associé aux buffers.
+ * 2. Démarre les requêtes de réception.
+ * 3. Recopie dans les buffers d'envoi les valeurs à envoyer.
+ * 4. Démarre les requêtes d'envoi.
+ * 5. Attend la fin de toutes les requêtes.
+ * 6. Recopie depuis les buffers de réception les valeurs des variables.
+ */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Implémentation de la synchronisation via des requêtes persistantes MPI.
+ */
+class MpiPersistentVariableSynchronizeDispatcher
+: public AbstractDataSynchronizeImplementation
+{
+ public:
+
+  class Factory;
+  explicit MpiPersistentVariableSynchronizeDispatcher(Factory* f);
+  ~MpiPersistentVariableSynchronizeDispatcher() override;
+
+ public:
+
+  void compute() override;
+  void beginSynchronize(IDataSynchronizeBuffer* buf) override;
+  void endSynchronize(IDataSynchronizeBuffer* buf) override;
+
+ private:
+
+  /*!
+   * \brief Jeu de requêtes persistantes associé à un couple de buffers.
+   */
+  class PersistentRequestSet
+  {
+   public:
+
+    bool isSame(const std::byte* send_data, Int64 send_size,
+                const std::byte* receive_data, Int64 receive_size) const
+    {
+      return (m_send_data == send_data && m_send_size == send_size &&
+              m_receive_data == receive_data && m_receive_size == receive_size);
+    }
+
+   public:
+
+    const std::byte* m_send_data = nullptr;
+    Int64 m_send_size = 0;
+    const std::byte* m_receive_data = nullptr;
+    Int64 m_receive_size = 0;
+    UniqueArray<MPI_Request> m_receive_requests;
+    UniqueArray<MPI_Request> m_send_requests;
+  };
+
+ private:
+
+  MpiParallelMng* m_mpi_parallel_mng = nullptr;
+  //! Liste des jeux de requêtes conservés (le plus récent en dernier)
+  UniqueArray<PersistentRequestSet*> m_request_sets;
+  //! Jeu de requêtes de la synchronisation en cours
+  PersistentRequestSet* m_current_set = nullptr;
+  //! Nombre maximum de jeux de requêtes conservés
+  Int32 m_max_nb_request_set = 8;
+
+ private:
+
+  PersistentRequestSet* _getRequestSet(IDataSynchronizeBuffer* buf);
+  PersistentRequestSet* _createRequestSet(IDataSynchronizeBuffer* buf);
+  void _freeRequestSet(PersistentRequestSet* rs);
+  void _freeAllRequestSets();
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class MpiPersistentVariableSynchronizeDispatcher::Factory
+: public IDataSynchronizeImplementationFactory
+{
+ public:
+
+  explicit Factory(MpiParallelMng* mpi_pm)
+  : m_mpi_parallel_mng(mpi_pm)
+  {}
+
+  Ref<IDataSynchronizeImplementation> createInstance() override
+  {
+    auto* x = new MpiPersistentVariableSynchronizeDispatcher(this);
+    return makeRef<IDataSynchronizeImplementation>(x);
+  }
+
+ public:
+
+  MpiParallelMng* m_mpi_parallel_mng = nullptr;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateMpiPersistentVariableSynchronizerFactory(MpiParallelMng* mpi_pm)
+{
+  auto* x = new MpiPersistentVariableSynchronizeDispatcher::Factory(mpi_pm);
+  return makeRef<IDataSynchronizeImplementationFactory>(x);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+MpiPersistentVariableSynchronizeDispatcher::
+MpiPersistentVariableSynchronizeDispatcher(Factory* f)
+: m_mpi_parallel_mng(f->m_mpi_parallel_mng)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+MpiPersistentVariableSynchronizeDispatcher::
+~MpiPersistentVariableSynchronizeDispatcher()
+{
+  _freeAllRequestSets();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Invalide les requêtes persistantes.
+ *
+ * Les informations de synchronisation ont changé et donc les déplacements
+ * et les tailles des messages ne sont plus valides.
+ */
+void MpiPersistentVariableSynchronizeDispatcher::
+compute()
+{
+  if (m_current_set)
+    ARCANE_FATAL("Can not call compute() during a synchronization");
+  _freeAllRequestSets();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiPersistentVariableSynchronizeDispatcher::
+beginSynchronize(IDataSynchronizeBuffer* buf)
+{
+  if (m_current_set)
+    ARCANE_FATAL("beginSynchronize() has already been called");
+
+  MpiParallelMng* pm = m_mpi_parallel_mng;
+
+  double prepare_time = 0.0;
+  double send_copy_time = 0.0;
+
+  {
+    MpiTimeInterval tit(&prepare_time);
+    m_current_set = _getRequestSet(buf);
+
+    // Démarre les réceptions avant de recopier les valeurs à envoyer pour
+    // faire un peu de recouvrement.
+    auto& receive_requests = m_current_set->m_receive_requests;
+    if (!receive_requests.empty())
+      MPI_Startall(receive_requests.size(), receive_requests.data());
+  }
+
+  {
+    MpiTimeInterval tit(&send_copy_time);
+    buf->copyAllSend();
+  }
+
+  {
+    MpiTimeInterval tit(&prepare_time);
+    auto& send_requests = m_current_set->m_send_requests;
+    if (!send_requests.empty())
+      MPI_Startall(send_requests.size(), send_requests.data());
+  }
+
+  Int64 total_share_size = buf->totalSendSize();
+  pm->stat()->add("SyncSendCopy", send_copy_time, total_share_size);
+  pm->stat()->add("SyncPrepare", prepare_time, total_share_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiPersistentVariableSynchronizeDispatcher::
+endSynchronize(IDataSynchronizeBuffer* buf)
+{
+  if (!m_current_set)
+    ARCANE_FATAL("No pending synchronize(). You need to call beginSynchronize() before");
+
+  MpiParallelMng* pm = m_mpi_parallel_mng;
+
+  double copy_time = 0.0;
+  double wait_time = 0.0;
+
+  {
+    MpiTimeInterval tit(&wait_time);
+    auto& receive_requests = m_current_set->m_receive_requests;
+    if (!receive_requests.empty())
+      MPI_Waitall(receive_requests.size(), receive_requests.data(), MPI_STATUSES_IGNORE);
+    auto& send_requests = m_current_set->m_send_requests;
+    if (!send_requests.empty())
+      MPI_Waitall(send_requests.size(), send_requests.data(), MPI_STATUSES_IGNORE);
+  }
+  m_current_set = nullptr;
+
+  // Recopie les valeurs recues
+  {
+    MpiTimeInterval tit(&copy_time);
+    buf->copyAllReceive();
+  }
+
+  Int64 total_ghost_size = buf->totalReceiveSize();
+  Int64 total_share_size = buf->totalSendSize();
+  Int64 total_size = total_ghost_size + total_share_size;
+  pm->stat()->add("SyncCopy", copy_time, total_ghost_size);
+  pm->stat()->add("SyncWait", wait_time, total_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Retourne le jeu de requêtes associé aux buffers de \a buf.
+ *
+ * Si aucun jeu ne correspond, en créé un nouveau et supprime le plus
+ * ancien si le nombre maximum de jeux est atteint.
+ */
+MpiPersistentVariableSynchronizeDispatcher::PersistentRequestSet*
+MpiPersistentVariableSynchronizeDispatcher::
+_getRequestSet(IDataSynchronizeBuffer* buf)
+{
+  Span<const std::byte> send_bytes = buf->globalSendBuffer().bytes();
+  Span<const std::byte> receive_bytes = buf->globalReceiveBuffer().bytes();
+
+  const Int32 nb_set = m_request_sets.size();
+  for (Int32 i = 0; i < nb_set; ++i) {
+    PersistentRequestSet* rs = m_request_sets[i];
+    if (rs->isSame(send_bytes.data(), send_bytes.size(), receive_bytes.data(), receive_bytes.size())) {
+      // Place ce jeu en dernière position pour qu'il soit supprimé en dernier.
+      m_request_sets.remove(i);
+      m_request_sets.add(rs);
+      return rs;
+    }
+  }
+
+  if (nb_set >= m_max_nb_request_set) {
+    _freeRequestSet(m_request_sets[0]);
+    m_request_sets.remove(0);
+  }
+
+  PersistentRequestSet* rs = _createRequestSet(buf);
+  m_request_sets.add(rs);
+  return rs;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+MpiPersistentVariableSynchronizeDispatcher::PersistentRequestSet*
+MpiPersistentVariableSynchronizeDispatcher::
+_createRequestSet(IDataSynchronizeBuffer* buf)
+{
+  MpiParallelMng* pm = m_mpi_parallel_mng;
+  MPI_Comm communicator = pm->communicator();
+  const MPI_Datatype mpi_dt = MP::Mpi::MpiBuiltIn::datatype(Byte());
+  constexpr int serialize_tag = 523;
+
+  auto* rs = new PersistentRequestSet();
+  Span<const std::byte> send_bytes = buf->globalSendBuffer().bytes();
+  Span<const std::byte> receive_bytes = buf->globalReceiveBuffer().bytes();
+  rs->m_send_data = send_bytes.data();
+  rs->m_send_size = send_bytes.size();
+  rs->m_receive_data = receive_bytes.data();
+  rs->m_receive_size = receive_bytes.size();
+
+  const Int32 nb_message = buf->nbRank();
+  for (Int32 i = 0; i < nb_message; ++i) {
+    Int32 target_rank = buf->targetRank(i);
+    auto rbuf = buf->receiveBuffer(i).bytes();
+    if (!rbuf.empty()) {
+      MPI_Request request = MPI_REQUEST_NULL;
+      int nb_byte = CheckedConvert::toInt32(rbuf.size());
+      MPI_Recv_init(rbuf.data(), nb_byte, mpi_dt, target_rank, serialize_tag, communicator, &request);
+      rs->m_receive_requests.add(request);
+    }
+    auto sbuf = buf->sendBuffer(i).bytes();
+    if (!sbuf.empty()) {
+      MPI_Request request = MPI_REQUEST_NULL;
+      int nb_byte = CheckedConvert::toInt32(sbuf.size());
+      MPI_Send_init(sbuf.data(), nb_byte, mpi_dt, target_rank, serialize_tag, communicator, &request);
+      rs->m_send_requests.add(request);
+    }
+  }
+  pm->stat()->add("SyncPersistentInit", 0.0, rs->m_send_size + rs->m_receive_size);
+  return rs;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiPersistentVariableSynchronizeDispatcher::
+_freeRequestSet(PersistentRequestSet* rs)
+{
+  for (MPI_Request& r : rs->m_receive_requests)
+    if (r != MPI_REQUEST_NULL)
+      MPI_Request_free(&r);
+  for (MPI_Request& r : rs->m_send_requests)
+    if (r != MPI_REQUEST_NULL)
+      MPI_Request_free(&r);
+  delete rs;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiPersistentVariableSynchronizeDispatcher::
+_freeAllRequestSets()
+{
+  for (PersistentRequestSet* rs : m_request_sets)
+    _freeRequestSet(rs);
+  m_request_sets.clear();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
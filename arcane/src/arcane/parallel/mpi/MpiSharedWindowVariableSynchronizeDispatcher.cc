@@ -0,0 +1,698 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* MpiSharedWindowVariableSynchronizeDispatcher.cc             (C) 2000-2023 */
+/*                                                                           */
+/* Synchronisations des variables via des fenêtres MPI en mémoire partagée.  */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/MemoryView.h"
+#include "arcane/utils/ValueConvert.h"
+
+#include "arcane/parallel/mpi/MpiParallelMng.h"
+#include "arcane/parallel/mpi/MpiTimeInterval.h"
+#include "arcane/parallel/IStat.h"
+
+#include "arcane/impl/IDataSynchronizeBuffer.h"
+#include "arcane/impl/IDataSynchronizeImplementation.h"
+#include "arcane/impl/DataSynchronizeInfo.h"
+#include "arcane/impl/internal/DataSynchronizeBuffer.h"
+#include "arcane/impl/internal/IBufferCopier.h"
+
+#include <map>
+#include <memory>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*
+ * Cette implémentation utilise des fenêtres MPI en mémoire partagée
+ * (MPI_Win_allocate_shared) pour les échanges entre les rangs d'un même
+ * noeud de calcul. Les échanges avec les rangs des autres noeuds utilisent
+ * des messages MPI classiques.
+ *
+ * Le communicateur des rangs du noeud est obtenu via
+ * MPI_Comm_split_type(MPI_COMM_TYPE_SHARED). Chaque rang du noeud possède une
+ * partie de la fenêtre dans laquelle il recopie directement depuis la donnée
+ * les valeurs à destination des autres rangs du noeud, précédées d'un en-tête
+ * qui indique pour chaque rang destinataire la position et la taille de ses
+ * valeurs. Les rangs destinataires recopient alors directement ces valeurs
+ * depuis la fenêtre dans leurs entités fantômes. Les buffers de
+ * synchronisation ne sont utilisés que pour les rangs des autres noeuds.
+ *
+ * Le communicateur et la fenêtre sont partagés par tous les synchroniseurs
+ * d'un même MpiParallelMng. La fenêtre est créée lors de la première
+ * synchronisation et n'est réallouée que si sa taille est insuffisante.
+ *
+ * Lors de l'appel à compute(), on détermine pour chaque rang s'il est dans
+ * le noeud et on calcule via une réduction sur le noeud le nombre maximum
+ * d'entités et de rangs destinataires dans le noeud. Cela permet à tous
+ * les rangs du noeud de calculer sans communication la même taille de
+ * fenêtre nécessaire à chaque synchronisation.
+ *
+ * L'algorithme de beginSynchronize() est le suivant:
+ *
+ * 1. Poste les réceptions pour les rangs des autres noeuds.
+ * 2. Recopie dans les buffers d'envoi les valeurs à envoyer et poste
+ *    les envois pour les rangs des autres noeuds.
+ * 3. Réalloue la fenêtre si besoin.
+ * 4. Recopie dans la fenêtre les valeurs pour les rangs du noeud.
+ * 5. Effectue une barrière sur le noeud puis recopie dans la donnée
+ *    les valeurs lues dans les fenêtres des rangs du noeud.
+ * 6. Effectue une barrière sur le noeud pour garantir que tous les rangs
+ *    ont terminé la lecture de la fenêtre avant qu'elle soit réutilisée.
+ *
+ * endSynchronize() attend la fin des messages MPI puis recopie les valeurs
+ * reçues des autres noeuds dans la donnée.
+ *
+ * La variable d'environnement ARCANE_SYNCHRONIZE_SHARED_WINDOW_NODE_SIZE
+ * permet de découper chaque noeud en groupes de rangs consécutifs de la
+ * taille spécifiée. Cela permet de tester les échanges entre noeuds sur une
+ * seule machine.
+ */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Fenêtre MPI partagée entre les rangs d'un noeud.
+ *
+ * Il n'existe qu'une instance par MpiParallelMng.
+ */
+class MpiSharedWindowSynchronizeInfo
+{
+ public:
+
+  //! En-tête de la partie de la fenêtre d'un rang
+  struct Header
+  {
+    Int64 m_nb_part;
+    Int64 m_padding;
+  };
+
+  //! Informations sur les valeurs à destination d'un rang
+  struct PartInfo
+  {
+    Int64 m_target_rank;
+    Int64 m_offset;
+    Int64 m_size;
+    Int64 m_padding;
+  };
+
+  //! Alignement des valeurs dans la fenêtre
+  static constexpr Int64 ALIGNMENT = 64;
+
+ public:
+
+  explicit MpiSharedWindowSynchronizeInfo(MpiParallelMng* pm);
+  ~MpiSharedWindowSynchronizeInfo();
+
+ public:
+
+  //! Initialise le communicateur du noeud s'il ne l'est pas encore.
+  void checkInitialize();
+  //! Rang dans le noeud du rang \a rank de parallelMng() ou (-1) s'il n'est pas dans le noeud.
+  Int32 nodeRank(Int32 rank) const
+  {
+    auto x = m_node_rank_map.find(rank);
+    return (x == m_node_rank_map.end()) ? (-1) : x->second;
+  }
+  //! Nombre de rangs du noeud
+  Int32 nodeSize() const { return m_node_size; }
+  //! Calcule le maximum sur le noeud des valeurs de \a values.
+  void computeNodeMax(ArrayView<Int64> values);
+  //! Garantit que la partie de la fenêtre de chaque rang fait au moins \a size octets.
+  void checkWindowSize(Int64 size);
+  //! Début de la partie de la fenêtre du rang \a node_rank du noeud
+  std::byte* windowBase(Int32 node_rank) const { return m_window_bases[node_rank]; }
+  //! Rend visible les écritures dans la fenêtre à tous les rangs du noeud.
+  void barrier();
+
+ private:
+
+  MpiParallelMng* m_parallel_mng = nullptr;
+  MPI_Comm m_node_communicator = MPI_COMM_NULL;
+  MPI_Win m_window = MPI_WIN_NULL;
+  Int32 m_node_size = 0;
+  Int64 m_window_size = 0;
+  std::map<Int32, Int32> m_node_rank_map;
+  UniqueArray<std::byte*> m_window_bases;
+  bool m_is_initialized = false;
+
+ private:
+
+  void _freeWindow();
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+MpiSharedWindowSynchronizeInfo::
+MpiSharedWindowSynchronizeInfo(MpiParallelMng* pm)
+: m_parallel_mng(pm)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+MpiSharedWindowSynchronizeInfo::
+~MpiSharedWindowSynchronizeInfo()
+{
+  int is_finalized = 0;
+  MPI_Finalized(&is_finalized);
+  if (is_finalized)
+    return;
+  _freeWindow();
+  if (m_node_communicator != MPI_COMM_NULL)
+    MPI_Comm_free(&m_node_communicator);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Initialise le communicateur du noeud.
+ *
+ * Cette méthode est collective sur parallelMng().
+ */
+void MpiSharedWindowSynchronizeInfo::
+checkInitialize()
+{
+  if (m_is_initialized)
+    return;
+  m_is_initialized = true;
+
+  MPI_Comm comm = m_parallel_mng->communicator();
+  int comm_rank = m_parallel_mng->commRank();
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, comm_rank, MPI_INFO_NULL, &m_node_communicator);
+
+  // Découpe éventuellement le noeud pour simuler plusieurs noeuds.
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_SYNCHRONIZE_SHARED_WINDOW_NODE_SIZE", true)) {
+    Int32 wanted_node_size = v.value();
+    if (wanted_node_size > 0) {
+      int node_rank = 0;
+      MPI_Comm_rank(m_node_communicator, &node_rank);
+      MPI_Comm split_communicator = MPI_COMM_NULL;
+      MPI_Comm_split(m_node_communicator, node_rank / wanted_node_size, node_rank, &split_communicator);
+      MPI_Comm_free(&m_node_communicator);
+      m_node_communicator = split_communicator;
+    }
+  }
+
+  int node_size = 0;
+  MPI_Comm_size(m_node_communicator, &node_size);
+  m_node_size = node_size;
+
+  // Calcule la correspondance entre les rangs de parallelMng() et ceux du noeud.
+  UniqueArray<int> node_ranks(node_size);
+  UniqueArray<int> comm_ranks(node_size);
+  for (int i = 0; i < node_size; ++i)
+    node_ranks[i] = i;
+  MPI_Group comm_group;
+  MPI_Group node_group;
+  MPI_Comm_group(comm, &comm_group);
+  MPI_Comm_group(m_node_communicator, &node_group);
+  MPI_Group_translate_ranks(node_group, node_size, node_ranks.data(), comm_group, comm_ranks.data());
+  MPI_Group_free(&node_group);
+  MPI_Group_free(&comm_group);
+  for (int i = 0; i < node_size; ++i)
+    m_node_rank_map[comm_ranks[i]] = i;
+
+  m_window_bases.resize(node_size);
+  m_window_bases.fill(nullptr);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule le maximum sur le noeud des valeurs de \a values.
+ *
+ * Cette méthode est collective sur le communicateur du noeud.
+ */
+void MpiSharedWindowSynchronizeInfo::
+computeNodeMax(ArrayView<Int64> values)
+{
+  UniqueArray<Int64> local_values(values);
+  MPI_Allreduce(local_values.data(), values.data(), values.size(), MPI_INT64_T, MPI_MAX, m_node_communicator);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Garantit que la fenêtre fait au moins \a size octets.
+ *
+ * \a size doit être identique pour tous les rangs du noeud. Dans ce cas,
+ * tous les rangs prennent la même décision et la réallocation (qui est
+ * collective sur le communicateur du noeud) n'a lieu que si nécessaire.
+ */
+void MpiSharedWindowSynchronizeInfo::
+checkWindowSize(Int64 size)
+{
+  if (size <= m_window_size)
+    return;
+
+  _freeWindow();
+
+  // Alloue un peu plus que nécessaire pour limiter le nombre de réallocations.
+  Int64 new_size = size + size / 4;
+  new_size = ((new_size + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT;
+
+  // Permet à chaque rang d'avoir sa partie de la fenêtre allouée
+  // sur sa mémoire locale (NUMA).
+  MPI_Info info;
+  MPI_Info_create(&info);
+  MPI_Info_set(info, "alloc_shared_noncontig", "true");
+  void* base_ptr = nullptr;
+  int r = MPI_Win_allocate_shared(new_size, 1, info, m_node_communicator, &base_ptr, &m_window);
+  MPI_Info_free(&info);
+  if (r != MPI_SUCCESS)
+    ARCANE_FATAL("Can not allocate MPI shared window size={0}", new_size);
+  m_window_size = new_size;
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, m_window);
+
+  for (Int32 i = 0; i < m_node_size; ++i) {
+    MPI_Aint rank_size = 0;
+    int disp_unit = 0;
+    void* rank_ptr = nullptr;
+    MPI_Win_shared_query(m_window, i, &rank_size, &disp_unit, &rank_ptr);
+    m_window_bases[i] = reinterpret_cast<std::byte*>(rank_ptr);
+  }
+  m_parallel_mng->stat()->add("SyncSharedWindowAlloc", 0.0, new_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiSharedWindowSynchronizeInfo::
+barrier()
+{
+  MPI_Win_sync(m_window);
+  MPI_Barrier(m_node_communicator);
+  MPI_Win_sync(m_window);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiSharedWindowSynchronizeInfo::
+_freeWindow()
+{
+  if (m_window == MPI_WIN_NULL)
+    return;
+  MPI_Win_unlock_all(m_window);
+  MPI_Win_free(&m_window);
+  m_window = MPI_WIN_NULL;
+  m_window_size = 0;
+  m_window_bases.fill(nullptr);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Implémentation de la synchronisation via des fenêtres MPI partagées.
+ */
+class MpiSharedWindowVariableSynchronizeDispatcher
+: public AbstractDataSynchronizeImplementation
+{
+ public:
+
+  class Factory;
+  explicit MpiSharedWindowVariableSynchronizeDispatcher(Factory* f);
+
+ public:
+
+  void compute() override;
+  void beginSynchronize(IDataSynchronizeBuffer* buf) override;
+  void endSynchronize(IDataSynchronizeBuffer* buf) override;
+
+ private:
+
+  MpiParallelMng* m_mpi_parallel_mng = nullptr;
+  std::shared_ptr<MpiSharedWindowSynchronizeInfo> m_window_info;
+  UniqueArray<Parallel::Request> m_all_requests;
+  //! Rang dans le noeud de chaque rang destinataire ou (-1) s'il n'est pas dans le noeud
+  UniqueArray<Int32> m_node_ranks;
+  //! Maximum sur le noeud du nombre d'entités à envoyer aux rangs du noeud
+  Int64 m_max_node_nb_item = 0;
+  //! Maximum sur le noeud du nombre de rangs destinataires dans le noeud
+  Int64 m_max_node_nb_part = 0;
+  bool m_is_computed = false;
+
+ private:
+
+  static DataSynchronizeBufferBase* _checkBuffer(IDataSynchronizeBuffer* buf);
+  static Int64 _copyToWindow(DataSynchronizeBufferBase* buf, Int32 index, std::byte* destination);
+  static Int64 _copyFromWindow(DataSynchronizeBufferBase* buf, Int32 index, const std::byte* source);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class MpiSharedWindowVariableSynchronizeDispatcher::Factory
+: public IDataSynchronizeImplementationFactory
+{
+ public:
+
+  Factory(MpiParallelMng* mpi_pm, std::shared_ptr<MpiSharedWindowSynchronizeInfo> window_info)
+  : m_mpi_parallel_mng(mpi_pm)
+  , m_window_info(window_info)
+  {}
+
+  Ref<IDataSynchronizeImplementation> createInstance() override
+  {
+    auto* x = new MpiSharedWindowVariableSynchronizeDispatcher(this);
+    return makeRef<IDataSynchronizeImplementation>(x);
+  }
+
+ public:
+
+  MpiParallelMng* m_mpi_parallel_mng = nullptr;
+  std::shared_ptr<MpiSharedWindowSynchronizeInfo> m_window_info;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Créé une fabrique pour l'implémentation via des fenêtres partagées.
+ *
+ * \a window_info contient la fenêtre partagée par tous les synchroniseurs
+ * de \a mpi_pm. Elle est créée si elle ne l'a pas encore été.
+ */
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateMpiSharedWindowVariableSynchronizerFactory(MpiParallelMng* mpi_pm,
+                                                       std::shared_ptr<MpiSharedWindowSynchronizeInfo>& window_info)
+{
+  if (!window_info)
+    window_info = std::make_shared<MpiSharedWindowSynchronizeInfo>(mpi_pm);
+  auto* x = new MpiSharedWindowVariableSynchronizeDispatcher::Factory(mpi_pm, window_info);
+  return makeRef<IDataSynchronizeImplementationFactory>(x);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+MpiSharedWindowVariableSynchronizeDispatcher::
+MpiSharedWindowVariableSynchronizeDispatcher(Factory* f)
+: m_mpi_parallel_mng(f->m_mpi_parallel_mng)
+, m_window_info(f->m_window_info)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule la répartition des rangs destinataires entre le noeud et
+ * les autres noeuds.
+ *
+ * Cette méthode est collective.
+ */
+void MpiSharedWindowVariableSynchronizeDispatcher::
+compute()
+{
+  MpiSharedWindowSynchronizeInfo* wi = m_window_info.get();
+  wi->checkInitialize();
+
+  DataSynchronizeInfo* sync_info = _syncInfo();
+  ARCANE_CHECK_POINTER(sync_info);
+  const DataSynchronizeBufferInfoList& send_info = sync_info->sendInfo();
+  const Int32 nb_message = sync_info->size();
+  m_node_ranks.resize(nb_message);
+  Int64 node_values[2] = { 0, 0 };
+  for (Int32 i = 0; i < nb_message; ++i) {
+    Int32 node_rank = wi->nodeRank(sync_info->targetRank(i));
+    m_node_ranks[i] = node_rank;
+    if (node_rank >= 0) {
+      node_values[0] += send_info.nbItem(i);
+      ++node_values[1];
+    }
+  }
+  if (wi->nodeSize() > 1)
+    wi->computeNodeMax(ArrayView<Int64>(2, node_values));
+  m_max_node_nb_item = node_values[0];
+  m_max_node_nb_part = node_values[1];
+  m_is_computed = true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+DataSynchronizeBufferBase* MpiSharedWindowVariableSynchronizeDispatcher::
+_checkBuffer(IDataSynchronizeBuffer* buf)
+{
+  auto* sync_buf = dynamic_cast<DataSynchronizeBufferBase*>(buf);
+  if (!sync_buf)
+    ARCANE_FATAL("Synchronize buffer has to be an instance of 'DataSynchronizeBufferBase'");
+  return sync_buf;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Recopie dans \a destination les valeurs des entités partagées avec
+ * le \a index-ème rang.
+ *
+ * Les valeurs de chaque donnée sont rangées les unes à la suite des autres
+ * comme dans les buffers de synchronisation. Retourne la taille en octet
+ * des valeurs recopiées.
+ */
+Int64 MpiSharedWindowVariableSynchronizeDispatcher::
+_copyToWindow(DataSynchronizeBufferBase* buf, Int32 index, std::byte* destination)
+{
+  IBufferCopier* copier = buf->bufferCopier();
+  ConstArrayView<Int32> local_ids = buf->sendLocalIds(index);
+  const Int64 nb_element = local_ids.size();
+  Int64 offset = 0;
+  for (MutableMemoryView data_view : buf->dataViews()) {
+    Int32 datatype_size = data_view.datatypeSize();
+    Int64 size = nb_element * datatype_size;
+    if (size != 0)
+      copier->copyToBufferAsync(local_ids, makeMutableMemoryView(destination + offset, datatype_size, nb_element), data_view);
+    offset += size;
+  }
+  return offset;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Recopie depuis \a source les valeurs des entités fantômes du
+ * \a index-ème rang.
+ *
+ * Retourne la taille en octet des valeurs recopiées.
+ */
+Int64 MpiSharedWindowVariableSynchronizeDispatcher::
+_copyFromWindow(DataSynchronizeBufferBase* buf, Int32 index, const std::byte* source)
+{
+  IBufferCopier* copier = buf->bufferCopier();
+  ConstArrayView<Int32> local_ids = buf->receiveLocalIds(index);
+  const Int64 nb_element = local_ids.size();
+  Int64 offset = 0;
+  for (MutableMemoryView data_view : buf->dataViews()) {
+    Int32 datatype_size = data_view.datatypeSize();
+    Int64 size = nb_element * datatype_size;
+    if (size != 0)
+      copier->copyFromBufferAsync(local_ids, makeConstMemoryView(source + offset, datatype_size, nb_element), data_view);
+    offset += size;
+  }
+  return offset;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiSharedWindowVariableSynchronizeDispatcher::
+beginSynchronize(IDataSynchronizeBuffer* buf)
+{
+  using Header = MpiSharedWindowSynchronizeInfo::Header;
+  using PartInfo = MpiSharedWindowSynchronizeInfo::PartInfo;
+  constexpr Int64 alignment = MpiSharedWindowSynchronizeInfo::ALIGNMENT;
+
+  MpiParallelMng* pm = m_mpi_parallel_mng;
+  MpiSharedWindowSynchronizeInfo* wi = m_window_info.get();
+  DataSynchronizeBufferBase* sync_buf = _checkBuffer(buf);
+  if (!m_is_computed)
+    compute();
+
+  const Int32 my_rank = pm->commRank();
+  const Int32 nb_message = buf->nbRank();
+  if (nb_message != m_node_ranks.size())
+    ARCANE_FATAL("Bad number of ranks n={0} expected={1}", nb_message, m_node_ranks.size());
+
+  // Taille d'une entité pour l'ensemble des données. Cette valeur est
+  // la même pour tous les rangs.
+  Int64 item_size = 0;
+  for (MutableMemoryView data_view : sync_buf->dataViews())
+    item_size += data_view.datatypeSize();
+
+  double prepare_time = 0.0;
+  double send_copy_time = 0.0;
+  double window_copy_time = 0.0;
+
+  // Poste les réceptions pour les rangs des autres noeuds.
+  {
+    MpiTimeInterval tit(&prepare_time);
+    for (Int32 i = 0; i < nb_message; ++i) {
+      if (m_node_ranks[i] >= 0)
+        continue;
+      auto rbuf = buf->receiveBuffer(i).bytes();
+      if (!rbuf.empty()) {
+        ByteArrayView bytes(rbuf.smallView().size(), reinterpret_cast<Byte*>(rbuf.data()));
+        m_all_requests.add(pm->recv(bytes, buf->targetRank(i), false));
+      }
+    }
+  }
+
+  // Seuls les buffers d'envoi des rangs des autres noeuds sont remplis.
+  Int64 remote_send_size = 0;
+  {
+    MpiTimeInterval tit(&send_copy_time);
+    for (Int32 i = 0; i < nb_message; ++i)
+      if (m_node_ranks[i] < 0) {
+        buf->copySendAsync(i);
+        remote_send_size += buf->sendBuffer(i).bytes().size();
+      }
+    buf->barrier();
+  }
+
+  // Envoie les messages aux rangs des autres noeuds.
+  {
+    MpiTimeInterval tit(&prepare_time);
+    for (Int32 i = 0; i < nb_message; ++i) {
+      if (m_node_ranks[i] >= 0)
+        continue;
+      auto sbuf = buf->sendBuffer(i).bytes();
+      if (!sbuf.empty()) {
+        ByteArrayView bytes(sbuf.smallView().size(), reinterpret_cast<Byte*>(sbuf.data()));
+        m_all_requests.add(pm->send(bytes, buf->targetRank(i), false));
+      }
+    }
+  }
+
+  // Echange via la fenêtre avec les rangs du noeud. Comme 'm_max_node_nb_part'
+  // est le même pour tous les rangs du noeud, ils prennent tous la même décision.
+  Int64 node_data_size = 0;
+  if (m_max_node_nb_part > 0) {
+    MpiTimeInterval tit(&window_copy_time);
+
+    Int64 header_size = sizeof(Header) + m_max_node_nb_part * sizeof(PartInfo);
+    header_size = ((header_size + alignment - 1) / alignment) * alignment;
+    // Taille maximale nécessaire sur le noeud en tenant compte de l'alignement de chaque partie.
+    Int64 max_window_size = header_size + m_max_node_nb_item * item_size + m_max_node_nb_part * alignment;
+    wi->checkWindowSize(max_window_size);
+
+    // Recopie dans ma partie de la fenêtre les valeurs pour les rangs du noeud.
+    std::byte* my_base = wi->windowBase(wi->nodeRank(my_rank));
+    auto* header = reinterpret_cast<Header*>(my_base);
+    auto* parts = reinterpret_cast<PartInfo*>(my_base + sizeof(Header));
+    Int64 offset = header_size;
+    Int32 part_index = 0;
+    for (Int32 i = 0; i < nb_message; ++i) {
+      if (m_node_ranks[i] < 0)
+        continue;
+      Int64 size = _copyToWindow(sync_buf, i, my_base + offset);
+      PartInfo& part = parts[part_index];
+      part.m_target_rank = buf->targetRank(i);
+      part.m_offset = offset;
+      part.m_size = size;
+      node_data_size += size;
+      offset += ((size + alignment - 1) / alignment) * alignment;
+      ++part_index;
+    }
+    header->m_nb_part = part_index;
+    buf->barrier();
+
+    wi->barrier();
+
+    // Recopie directement depuis les fenêtres des rangs du noeud les valeurs qui me sont destinées.
+    for (Int32 i = 0; i < nb_message; ++i) {
+      Int32 target_node_rank = m_node_ranks[i];
+      if (target_node_rank < 0)
+        continue;
+      Int32 target_rank = buf->targetRank(i);
+      Int64 expected_size = sync_buf->receiveLocalIds(i).size() * item_size;
+      const std::byte* target_base = wi->windowBase(target_node_rank);
+      auto* target_header = reinterpret_cast<const Header*>(target_base);
+      auto* target_parts = reinterpret_cast<const PartInfo*>(target_base + sizeof(Header));
+      bool is_found = false;
+      for (Int64 z = 0, n = target_header->m_nb_part; z < n; ++z) {
+        const PartInfo& part = target_parts[z];
+        if (part.m_target_rank != my_rank)
+          continue;
+        if (part.m_size != expected_size)
+          ARCANE_FATAL("Bad message size from rank '{0}' (expected={1} received={2})",
+                       target_rank, expected_size, part.m_size);
+        _copyFromWindow(sync_buf, i, target_base + part.m_offset);
+        is_found = true;
+        break;
+      }
+      if (!is_found)
+        ARCANE_FATAL("No message in shared window from rank '{0}'", target_rank);
+    }
+    buf->barrier();
+
+    // Garantit que tous les rangs ont terminé leur lecture avant que
+    // la fenêtre ne soit modifiée par la synchronisation suivante.
+    wi->barrier();
+  }
+
+  pm->stat()->add("SyncSendCopy", send_copy_time, remote_send_size);
+  pm->stat()->add("SyncPrepare", prepare_time, buf->totalSendSize());
+  pm->stat()->add("SyncSharedWindow", window_copy_time, node_data_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiSharedWindowVariableSynchronizeDispatcher::
+endSynchronize(IDataSynchronizeBuffer* buf)
+{
+  MpiParallelMng* pm = m_mpi_parallel_mng;
+
+  double copy_time = 0.0;
+  double wait_time = 0.0;
+
+  {
+    MpiTimeInterval tit(&wait_time);
+    if (!m_all_requests.empty()) {
+      pm->waitAllRequests(m_all_requests);
+      m_all_requests.clear();
+    }
+  }
+
+  // Recopie les valeurs reçues des autres noeuds. Celles des rangs du
+  // noeud ont déjà été recopiées dans beginSynchronize().
+  Int64 remote_receive_size = 0;
+  {
+    MpiTimeInterval tit(&copy_time);
+    const Int32 nb_message = buf->nbRank();
+    for (Int32 i = 0; i < nb_message; ++i)
+      if (m_node_ranks[i] < 0) {
+        buf->copyReceiveAsync(i);
+        remote_receive_size += buf->receiveBuffer(i).bytes().size();
+      }
+    buf->barrier();
+  }
+
+  Int64 total_ghost_size = buf->totalReceiveSize();
+  Int64 total_share_size = buf->totalSendSize();
+  Int64 total_size = total_ghost_size + total_share_size;
+  pm->stat()->add("SyncCopy", copy_time, remote_receive_size);
+  pm->stat()->add("SyncWait", wait_time, total_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* HybridParallelMng.cc                                        (C) 2000-2021 */
+/* HybridParallelMng.cc                                        (C) 2000-2023 */
 /*                                                                           */
 /* Gestionnaire de parallélisme utilisant un mixte MPI/Threads.              */
 /*---------------------------------------------------------------------------*/
@@ -30,6 +30,7 @@
 
 #include "arcane/parallel/mpithread/HybridParallelDispatch.h"
 #include "arcane/parallel/mpithread/HybridMessageQueue.h"
+#include "arcane/parallel/thread/SharedMemoryDataSynchronizeImplementation.h"
 #include "arcane/parallel/mpi/MpiParallelMng.h"
 
 #include "arcane/core/SerializeMessage.h"
@@ -182,7 +183,8 @@ HybridParallelMng(const HybridParallelMngBuildInfo& bi)
 //, m_parallel_mng_list(bi.parallel_mng_list)
 , m_sub_builder_factory(bi.sub_builder_factory)
 , m_parent_container_ref(bi.container)
-, m_utils_factory(makeRef<IParallelMngUtilsFactory>(new ParallelMngUtilsFactoryBase()))
+, m_utils_factory(makeRef<IParallelMngUtilsFactory>(new SharedMemoryParallelMngUtilsFactory(bi.thread_barrier,bi.synchronize_area,
+                                                                                             bi.local_rank,bi.local_nb_rank)))
 {
   if (!m_world_parallel_mng)
     m_world_parallel_mng = this;
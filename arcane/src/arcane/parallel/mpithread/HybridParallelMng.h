@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* HybridParallelMng.h                                         (C) 2000-2020 */
+/* HybridParallelMng.h                                         (C) 2000-2023 */
 /*                                                                           */
 /* Implémentation des messages hybrides MPI/Mémoire partagée.                */
 /*---------------------------------------------------------------------------*/
@@ -36,6 +36,7 @@ class HybridMessageQueue;
 class HybridParallelMng;
 class MpiThreadAllDispatcher;
 class HybridSerializeMessageList;
+class SharedMemoryDataSynchronizeArea;
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -55,6 +56,7 @@ struct HybridParallelMngBuildInfo
   IThreadBarrier* thread_barrier = nullptr;
   Array<HybridParallelMng*>* parallel_mng_list = nullptr;
   MpiThreadAllDispatcher* all_dispatchers = nullptr;
+  SharedMemoryDataSynchronizeArea* synchronize_area = nullptr;
   IParallelMngContainerFactory* sub_builder_factory = nullptr;
   Ref<IParallelMngContainer> container;
 };
@@ -33,6 +33,7 @@
 #include "arcane/parallel/thread/GlibThreadMng.h"
 #include "arcane/parallel/thread/SharedMemoryParallelMng.h"
 #include "arcane/parallel/thread/SharedMemoryParallelSuperMng.h"
+#include "arcane/parallel/thread/SharedMemoryDataSynchronizeImplementation.h"
 
 #include "arcane/parallel/mpithread/HybridParallelMng.h"
 #include "arcane/parallel/mpithread/HybridParallelDispatch.h"
@@ -84,6 +85,7 @@ class HybridParallelMngContainer
   IThreadBarrier* m_thread_barrier = nullptr;
   Int32 m_local_nb_rank = -1;
   MpiThreadAllDispatcher* m_all_dispatchers = nullptr;
+  SharedMemoryDataSynchronizeArea* m_synchronize_area = nullptr;
   // Cet objet est partagé par tous les HybridParallelMng.
   UniqueArray<HybridParallelMng*>* m_parallel_mng_list = nullptr;
   Mutex* m_internal_create_mutex = nullptr;
@@ -126,6 +128,7 @@ HybridParallelMngContainer::
   delete m_message_queue;
   delete m_thread_mng;
   delete m_all_dispatchers;
+  delete m_synchronize_area;
   delete m_parallel_mng_list;
   delete m_internal_create_mutex;
 }
@@ -149,6 +152,8 @@ build()
 
   m_thread_barrier = platform::getThreadImplementationService()->createBarrier();
   m_thread_barrier->init(m_local_nb_rank);
+
+  m_synchronize_area = new SharedMemoryDataSynchronizeArea(m_local_nb_rank);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -216,6 +221,7 @@ _createParallelMng(Int32 local_rank,ITraceMng* tm)
   build_info.thread_barrier = m_thread_barrier;
   build_info.parallel_mng_list = m_parallel_mng_list;
   build_info.all_dispatchers = m_all_dispatchers;
+  build_info.synchronize_area = m_synchronize_area;
   build_info.sub_builder_factory = m_sub_builder_factory;
   build_info.container = makeRef<IParallelMngContainer>(this);
 
@@ -0,0 +1,346 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* SharedMemoryDataSynchronizeImplementation.cc                (C) 2000-2023 */
+/*                                                                           */
+/* Synchronisation des variables par recopie en mémoire partagée.            */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/parallel/thread/SharedMemoryDataSynchronizeImplementation.h"
+
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/IThreadBarrier.h"
+#include "arcane/utils/MemoryView.h"
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/ITraceMng.h"
+
+#include "arcane/core/IParallelMng.h"
+#include "arcane/core/IItemFamily.h"
+#include "arcane/core/ItemGroup.h"
+
+#include "arcane/impl/IDataSynchronizeBuffer.h"
+#include "arcane/impl/IDataSynchronizeImplementation.h"
+#include "arcane/impl/internal/VariableSynchronizer.h"
+#include "arcane/impl/internal/DataSynchronizeBuffer.h"
+#include "arcane/impl/internal/IBufferCopier.h"
+
+#include <cstring>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::MessagePassing
+{
+
+namespace
+{
+  ArrayView<Byte>
+  _toLegacySmallView(MutableMemoryView memory_view)
+  {
+    Span<std::byte> bytes = memory_view.bytes();
+    void* data = bytes.data();
+    Int32 size = bytes.smallView().size();
+    return { size, reinterpret_cast<Byte*>(data) };
+  }
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Implémentation de la synchronisation pour les rangs d'un
+ * même processus.
+ *
+ * Les échanges avec les rangs locaux au processus ne passent pas par la
+ * file de messages ni par les buffers de synchronisation: chaque rang publie
+ * dans une zone partagée (SharedMemoryDataSynchronizeArea) les vues sur ses
+ * données et les indices de ses entités partagées puis, après une barrière,
+ * chaque rang recopie directement les valeurs des entités partagées de ses
+ * voisins dans ses entités fantômes. Une seconde barrière garantit que les
+ * données des voisins ne sont pas modifiées tant que tous les rangs n'ont
+ * pas terminé leur recopie.
+ *
+ * Les valeurs ne sont donc recopiées qu'une seule fois. Les recopies sont
+ * effectuées sur l'hôte et les données doivent donc y être accessibles.
+ *
+ * En mode hybride (MPI+threads), les échanges avec les rangs des autres
+ * processus utilisent les messages classiques.
+ *
+ * Comme la synchronisation est collective, tous les rangs locaux appellent
+ * beginSynchronize() dans le même ordre et les barrières sont donc
+ * toujours appariées.
+ */
+class SharedMemoryDataSynchronizeImplementation
+: public AbstractDataSynchronizeImplementation
+{
+ public:
+
+  class Factory;
+  explicit SharedMemoryDataSynchronizeImplementation(Factory* f);
+
+ protected:
+
+  void compute() override {}
+  void beginSynchronize(IDataSynchronizeBuffer* buf) override;
+  void endSynchronize(IDataSynchronizeBuffer* buf) override;
+
+ private:
+
+  IParallelMng* m_parallel_mng = nullptr;
+  IThreadBarrier* m_thread_barrier = nullptr;
+  SharedMemoryDataSynchronizeArea* m_synchronize_area = nullptr;
+  Int32 m_local_rank = A_NULL_RANK;
+  Int32 m_local_nb_rank = 0;
+  UniqueArray<Parallel::Request> m_all_requests;
+  //! Indices dans les données des entités partagées pour chaque rang local
+  UniqueArray<UniqueArray<Int32>> m_share_data_indexes;
+  //! Indices dans les données des entités fantômes
+  UniqueArray<Int32> m_ghost_data_indexes;
+
+ private:
+
+  //! Rang local correspondant au rang \a rank ou -1 s'il n'est pas dans ce processus.
+  Int32 _localRank(Int32 rank) const
+  {
+    Int32 first_rank = m_parallel_mng->commRank() - m_local_rank;
+    Int32 local_rank = rank - first_rank;
+    if (local_rank < 0 || local_rank >= m_local_nb_rank)
+      return (-1);
+    return local_rank;
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class SharedMemoryDataSynchronizeImplementation::Factory
+: public IDataSynchronizeImplementationFactory
+{
+ public:
+
+  Factory(IParallelMng* pm, IThreadBarrier* barrier, SharedMemoryDataSynchronizeArea* area,
+          Int32 local_rank, Int32 local_nb_rank)
+  : m_parallel_mng(pm)
+  , m_thread_barrier(barrier)
+  , m_synchronize_area(area)
+  , m_local_rank(local_rank)
+  , m_local_nb_rank(local_nb_rank)
+  {}
+
+  Ref<IDataSynchronizeImplementation> createInstance() override
+  {
+    auto* x = new SharedMemoryDataSynchronizeImplementation(this);
+    return makeRef<IDataSynchronizeImplementation>(x);
+  }
+
+ public:
+
+  IParallelMng* m_parallel_mng = nullptr;
+  IThreadBarrier* m_thread_barrier = nullptr;
+  SharedMemoryDataSynchronizeArea* m_synchronize_area = nullptr;
+  Int32 m_local_rank = A_NULL_RANK;
+  Int32 m_local_nb_rank = 0;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+SharedMemoryDataSynchronizeImplementation::
+SharedMemoryDataSynchronizeImplementation(Factory* f)
+: m_parallel_mng(f->m_parallel_mng)
+, m_thread_barrier(f->m_thread_barrier)
+, m_synchronize_area(f->m_synchronize_area)
+, m_local_rank(f->m_local_rank)
+, m_local_nb_rank(f->m_local_nb_rank)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateSharedMemoryVariableSynchronizerFactory(IParallelMng* pm, IThreadBarrier* barrier,
+                                                    SharedMemoryDataSynchronizeArea* area,
+                                                    Int32 local_rank, Int32 local_nb_rank)
+{
+  ARCANE_CHECK_POINTER(barrier);
+  ARCANE_CHECK_POINTER(area);
+  auto* x = new SharedMemoryDataSynchronizeImplementation::Factory(pm, barrier, area, local_rank, local_nb_rank);
+  return makeRef<IDataSynchronizeImplementationFactory>(x);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void SharedMemoryDataSynchronizeImplementation::
+beginSynchronize(IDataSynchronizeBuffer* vs_buf)
+{
+  ARCANE_CHECK_POINTER(vs_buf);
+  auto* sync_buf = dynamic_cast<DataSynchronizeBufferBase*>(vs_buf);
+  if (!sync_buf)
+    ARCANE_FATAL("Synchronize buffer has to be an instance of 'DataSynchronizeBufferBase'");
+  IParallelMng* pm = m_parallel_mng;
+  IBufferCopier* copier = sync_buf->bufferCopier();
+  const Int32 my_rank = pm->commRank();
+  const Int32 nb_message = vs_buf->nbRank();
+  ConstArrayView<MutableMemoryView> data_views = sync_buf->dataViews();
+
+  // Poste les réceptions non bloquantes pour les rangs des autres processus.
+  for (Integer i = 0; i < nb_message; ++i) {
+    Int32 target_rank = vs_buf->targetRank(i);
+    if (_localRank(target_rank) >= 0)
+      continue;
+    auto buf = _toLegacySmallView(vs_buf->receiveBuffer(i));
+    if (!buf.empty())
+      m_all_requests.add(pm->recv(buf, target_rank, false));
+  }
+
+  // Seuls les buffers d'envoi des rangs des autres processus sont remplis.
+  for (Integer i = 0; i < nb_message; ++i)
+    if (_localRank(vs_buf->targetRank(i)) < 0)
+      vs_buf->copySendAsync(i);
+  vs_buf->barrier();
+
+  // Envoie les messages aux rangs des autres processus et publie
+  // les indices des entités partagées pour les rangs locaux.
+  UniqueArray<SharedMemoryDataSynchronizeArea::SendPart>& my_parts = m_synchronize_area->sendParts(m_local_rank);
+  my_parts.clear();
+  m_share_data_indexes.resize(nb_message);
+  for (Integer i = 0; i < nb_message; ++i) {
+    Int32 target_rank = vs_buf->targetRank(i);
+    if (_localRank(target_rank) >= 0) {
+      copier->fillDataIndexes(m_share_data_indexes[i], sync_buf->sendLocalIds(i));
+      my_parts.add({ target_rank, m_share_data_indexes[i].constView(), data_views });
+      continue;
+    }
+    auto buf = _toLegacySmallView(vs_buf->sendBuffer(i));
+    if (!buf.empty())
+      m_all_requests.add(pm->send(buf, target_rank, false));
+  }
+
+  // Attend que tous les rangs locaux aient publié leurs données.
+  m_thread_barrier->wait();
+
+  // Recopie directement les valeurs des entités partagées des rangs locaux
+  // dans les entités fantômes.
+  for (Integer i = 0; i < nb_message; ++i) {
+    Int32 target_rank = vs_buf->targetRank(i);
+    Int32 target_local_rank = _localRank(target_rank);
+    if (target_local_rank < 0)
+      continue;
+    copier->fillDataIndexes(m_ghost_data_indexes, sync_buf->receiveLocalIds(i));
+    const Int32 nb_item = m_ghost_data_indexes.size();
+    bool is_found = false;
+    for (const auto& part : m_synchronize_area->sendParts(target_local_rank)) {
+      if (part.target_rank != my_rank)
+        continue;
+      if (part.data_indexes.size() != nb_item)
+        ARCANE_FATAL("Bad number of items from rank '{0}' (expected={1} received={2})",
+                     target_rank, nb_item, part.data_indexes.size());
+      if (part.data_views.size() != data_views.size())
+        ARCANE_FATAL("Bad number of data from rank '{0}' (expected={1} received={2})",
+                     target_rank, data_views.size(), part.data_views.size());
+      for (Int32 z = 0, nb_data = data_views.size(); z < nb_data; ++z) {
+        const Int64 datatype_size = data_views[z].datatypeSize();
+        if (part.data_views[z].datatypeSize() != datatype_size)
+          ARCANE_FATAL("Bad datatype size from rank '{0}' (expected={1} received={2})",
+                       target_rank, datatype_size, part.data_views[z].datatypeSize());
+        std::byte* ghost_values = data_views[z].bytes().data();
+        const std::byte* share_values = part.data_views[z].bytes().data();
+        for (Int32 k = 0; k < nb_item; ++k)
+          std::memcpy(ghost_values + m_ghost_data_indexes[k] * datatype_size,
+                      share_values + part.data_indexes[k] * datatype_size, datatype_size);
+      }
+      is_found = true;
+      break;
+    }
+    if (!is_found)
+      ARCANE_FATAL("No message from local rank '{0}'", target_rank);
+  }
+
+  // Attend que tous les rangs locaux aient terminé leurs recopies avant
+  // que leurs données puissent être modifiées.
+  m_thread_barrier->wait();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void SharedMemoryDataSynchronizeImplementation::
+endSynchronize(IDataSynchronizeBuffer* vs_buf)
+{
+  // Attend que les échanges avec les autres processus se terminent
+  if (!m_all_requests.empty()) {
+    m_parallel_mng->waitAllRequests(m_all_requests);
+    m_all_requests.clear();
+  }
+
+  // Recopie dans la variable les valeurs reçues des autres processus. Les
+  // valeurs des rangs locaux ont déjà été recopiées dans beginSynchronize().
+  const Int32 nb_message = vs_buf->nbRank();
+  for (Integer i = 0; i < nb_message; ++i)
+    if (_localRank(vs_buf->targetRank(i)) < 0)
+      vs_buf->copyReceiveAsync(i);
+  vs_buf->barrier();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+SharedMemoryParallelMngUtilsFactory::
+SharedMemoryParallelMngUtilsFactory(IThreadBarrier* barrier, SharedMemoryDataSynchronizeArea* area,
+                                    Int32 local_rank, Int32 local_nb_rank)
+: m_thread_barrier(barrier)
+, m_synchronize_area(area)
+, m_local_rank(local_rank)
+, m_local_nb_rank(local_nb_rank)
+{
+  if (platform::getEnvironmentVariable("ARCANE_SYNCHRONIZE_SHARED_MEMORY") == "1")
+    m_use_shared_memory_synchronize = true;
+  // Il faut une zone d'échange pour pouvoir utiliser cette implémentation.
+  if (!m_synchronize_area)
+    m_use_shared_memory_synchronize = false;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Ref<IVariableSynchronizer> SharedMemoryParallelMngUtilsFactory::
+createSynchronizer(IParallelMng* pm, IItemFamily* family)
+{
+  return createSynchronizer(pm, family->allItems());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Ref<IVariableSynchronizer> SharedMemoryParallelMngUtilsFactory::
+createSynchronizer(IParallelMng* pm, const ItemGroup& group)
+{
+  if (!m_use_shared_memory_synchronize)
+    return ParallelMngUtilsFactoryBase::createSynchronizer(pm, group);
+
+  // N'affiche les informations que pour le groupe de toutes les mailles pour éviter d'afficher
+  // plusieurs fois le même message.
+  bool do_print = (group.isAllItems() && group.itemKind() == IK_Cell);
+  if (do_print)
+    pm->traceMng()->info() << "Using SharedMemorySynchronizer";
+  auto generic_factory = arcaneCreateSharedMemoryVariableSynchronizerFactory(pm, m_thread_barrier, m_synchronize_area,
+                                                                             m_local_rank, m_local_nb_rank);
+  return makeRef<IVariableSynchronizer>(new VariableSynchronizer(pm, group, generic_factory));
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::MessagePassing
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,129 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* SharedMemoryDataSynchronizeImplementation.h                 (C) 2000-2023 */
+/*                                                                           */
+/* Synchronisation des variables par recopie en mémoire partagée.            */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_PARALLEL_THREAD_SHAREDMEMORYDATASYNCHRONIZEIMPLEMENTATION_H
+#define ARCANE_PARALLEL_THREAD_SHAREDMEMORYDATASYNCHRONIZEIMPLEMENTATION_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/UniqueArray.h"
+#include "arcane/utils/Ref.h"
+
+#include "arcane/impl/ParallelMngUtilsFactoryBase.h"
+
+#include "arcane/parallel/thread/ArcaneThread.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+class IDataSynchronizeImplementationFactory;
+}
+
+namespace Arcane::MessagePassing
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Zone d'échange partagée par les rangs locaux d'un même processus
+ * pour les synchronisations.
+ *
+ * Lors d'une synchronisation, chaque rang local publie dans sa partie
+ * de la zone les vues sur les valeurs de ses données ainsi que les indices
+ * des entités partagées avec chaque rang. Les rangs locaux destinataires
+ * recopient alors directement ces valeurs dans leurs entités fantômes.
+ *
+ * Chaque rang local ne modifie que sa propre partie et les accès
+ * concurrents sont ordonnés par la barrière des threads.
+ */
+class ARCANE_THREAD_EXPORT SharedMemoryDataSynchronizeArea
+{
+ public:
+
+  //! Valeurs à destination d'un rang
+  struct SendPart
+  {
+    Int32 target_rank = A_NULL_RANK;
+    //! Indices dans les données des entités partagées avec \a target_rank
+    ConstArrayView<Int32> data_indexes;
+    //! Valeurs des données
+    ConstArrayView<MutableMemoryView> data_views;
+  };
+
+ public:
+
+  explicit SharedMemoryDataSynchronizeArea(Int32 nb_local_rank)
+  {
+    m_send_parts.resize(nb_local_rank);
+  }
+
+ public:
+
+  //! Liste des parties publiées par le rang local \a local_rank
+  UniqueArray<SendPart>& sendParts(Int32 local_rank) { return m_send_parts[local_rank]; }
+
+ private:
+
+  UniqueArray<UniqueArray<SendPart>> m_send_parts;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Fabrique des fonctions utilitaires pour les gestionnaires
+ * du parallélisme en mémoire partagée.
+ *
+ * Si la variable d'environnement ARCANE_SYNCHRONIZE_SHARED_MEMORY vaut 1,
+ * les synchroniseurs créés utilisent une implémentation dans laquelle
+ * les échanges entre rangs d'un même processus se font par recopie
+ * des buffers d'envoi sans passer par la file de messages.
+ */
+class ARCANE_THREAD_EXPORT SharedMemoryParallelMngUtilsFactory
+: public ParallelMngUtilsFactoryBase
+{
+ public:
+
+  SharedMemoryParallelMngUtilsFactory(IThreadBarrier* barrier, SharedMemoryDataSynchronizeArea* area,
+                                      Int32 local_rank, Int32 local_nb_rank);
+
+ public:
+
+  Ref<IVariableSynchronizer> createSynchronizer(IParallelMng* pm, IItemFamily* family) override;
+  Ref<IVariableSynchronizer> createSynchronizer(IParallelMng* pm, const ItemGroup& group) override;
+
+ private:
+
+  IThreadBarrier* m_thread_barrier = nullptr;
+  SharedMemoryDataSynchronizeArea* m_synchronize_area = nullptr;
+  Int32 m_local_rank = A_NULL_RANK;
+  Int32 m_local_nb_rank = 0;
+  bool m_use_shared_memory_synchronize = false;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+extern "C++" ARCANE_THREAD_EXPORT Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateSharedMemoryVariableSynchronizerFactory(IParallelMng* pm, IThreadBarrier* barrier,
+                                                    SharedMemoryDataSynchronizeArea* area,
+                                                    Int32 local_rank, Int32 local_nb_rank);
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::MessagePassing
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
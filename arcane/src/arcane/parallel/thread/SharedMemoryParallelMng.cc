@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* SharedMemoryParallelMng.cc                                  (C) 2000-2021 */
+/* SharedMemoryParallelMng.cc                                  (C) 2000-2023 */
 /*                                                                           */
 /* Implémentation des messages en mode mémoire partagé.                      */
 /*---------------------------------------------------------------------------*/
@@ -30,6 +30,7 @@
 
 #include "arcane/parallel/thread/SharedMemoryParallelDispatch.h"
 #include "arcane/parallel/thread/ISharedMemoryMessageQueue.h"
+#include "arcane/parallel/thread/SharedMemoryDataSynchronizeImplementation.h"
 
 #include "arcane/SerializeMessage.h"
 #include "arcane/Timer.h"
@@ -115,7 +116,8 @@ SharedMemoryParallelMng(const SharedMemoryParallelMngBuildInfo& build_info)
 , m_sub_builder_factory(build_info.sub_builder_factory)
 , m_parent_container_ref(build_info.container)
 , m_mpi_communicator(build_info.communicator)
-, m_utils_factory(makeRef<IParallelMngUtilsFactory>(new ParallelMngUtilsFactoryBase()))
+, m_utils_factory(makeRef<IParallelMngUtilsFactory>(new SharedMemoryParallelMngUtilsFactory(build_info.thread_barrier,build_info.synchronize_area,
+                                                                                             build_info.rank,build_info.nb_rank)))
 {
   if (!m_world_parallel_mng)
     m_world_parallel_mng = this;
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* SharedMemoryParallelMng.h                                   (C) 2000-2020 */
+/* SharedMemoryParallelMng.h                                   (C) 2000-2023 */
 /*                                                                           */
 /* Implémentation des messages en mode mémoire partagé.                      */
 /*---------------------------------------------------------------------------*/
@@ -34,6 +34,7 @@ namespace Arcane::MessagePassing
 {
 class ISharedMemoryMessageQueue;
 class SharedMemoryAllDispatcher;
+class SharedMemoryDataSynchronizeArea;
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -56,6 +57,7 @@ struct ARCANE_THREAD_EXPORT SharedMemoryParallelMngBuildInfo
   ISharedMemoryMessageQueue* message_queue = nullptr;
   IThreadBarrier* thread_barrier = nullptr;
   SharedMemoryAllDispatcher* all_dispatchers = nullptr;
+  SharedMemoryDataSynchronizeArea* synchronize_area = nullptr;
   IParallelMngContainerFactory* sub_builder_factory = nullptr;
   Ref<IParallelMngContainer> container;
   MP::Communicator communicator;
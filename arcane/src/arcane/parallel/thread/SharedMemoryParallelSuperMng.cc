@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* SharedMemoryParallelSuperMng.cc                             (C) 2000-2020 */
+/* SharedMemoryParallelSuperMng.cc                             (C) 2000-2023 */
 /*                                                                           */
 /* Gestionnaire de messages utilisant uniquement la mémoire partagée.        */
 /*---------------------------------------------------------------------------*/
@@ -30,6 +30,7 @@
 #include "arcane/parallel/thread/SharedMemoryParallelMng.h"
 #include "arcane/parallel/thread/SharedMemoryParallelDispatch.h"
 #include "arcane/parallel/thread/SharedMemoryMessageQueue.h"
+#include "arcane/parallel/thread/SharedMemoryDataSynchronizeImplementation.h"
 #include "arcane/parallel/thread/GlibThreadMng.h"
 
 #include "arcane/FactoryService.h"
@@ -74,6 +75,7 @@ class SharedMemoryParallelMngContainer
   Mutex* m_internal_create_mutex = nullptr;
   IThreadBarrier* m_thread_barrier = nullptr;
   SharedMemoryAllDispatcher* m_all_dispatchers = nullptr;
+  SharedMemoryDataSynchronizeArea* m_synchronize_area = nullptr;
   IParallelMngContainerFactory* m_sub_factory_builder = nullptr;
  private:
   MP::Communicator m_communicator;
@@ -104,6 +106,7 @@ SharedMemoryParallelMngContainer::
   delete m_message_queue;
   delete m_thread_mng;
   delete m_all_dispatchers;
+  delete m_synchronize_area;
   delete m_internal_create_mutex;
 }
 
@@ -122,6 +125,8 @@ build()
   m_all_dispatchers = new SharedMemoryAllDispatcher();
   m_all_dispatchers->resize(m_nb_local_rank);
 
+  m_synchronize_area = new SharedMemoryDataSynchronizeArea(m_nb_local_rank);
+
   m_internal_create_mutex = new Mutex();
 }
 
@@ -149,6 +154,7 @@ _createParallelMng(Int32 local_rank,ITraceMng* tm)
   build_info.message_queue = m_message_queue;
   build_info.thread_barrier = m_thread_barrier;
   build_info.all_dispatchers = m_all_dispatchers;
+  build_info.synchronize_area = m_synchronize_area;
   build_info.sub_builder_factory = m_sub_factory_builder;
   build_info.container = makeRef<IParallelMngContainer>(this);
   // Seul le rang 0 positionne l'éventuel communicateur sinon tous les PE
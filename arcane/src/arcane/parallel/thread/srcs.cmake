@@ -17,6 +17,8 @@ set(ARCANE_SOURCES
   SharedMemoryMessageQueue.h
   SharedMemoryParallelMng.cc
   SharedMemoryParallelMng.h
+  SharedMemoryDataSynchronizeImplementation.cc
+  SharedMemoryDataSynchronizeImplementation.h
 
   # TODO: les fichiers suivants sont gardés pour des raisons
   # de compatibilité avec l'existant. Il faudra les supprimer
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ParallelDataReaderWriter.cc                                 (C) 2000-2021 */
+/* ParallelDataReaderWriter.cc                                 (C) 2000-2023 */
 /*                                                                           */
 /* Lecteur/Ecrivain de IData en parallèle.                                   */
 /*---------------------------------------------------------------------------*/
@@ -20,7 +20,7 @@
 #include "arcane/ISerializeMessage.h"
 #include "arcane/SerializeBuffer.h"
 #include "arcane/IData.h"
-#include "arcane/parallel/BitonicSortT.H"
+#include "arcane/core/parallel/ParallelSort.h"
 #include "arcane/ParallelMngUtils.h"
 
 /*---------------------------------------------------------------------------*/
@@ -148,7 +148,8 @@ sort(Int32ConstArrayView local_ids,Int64ConstArrayView items_uid)
   // speciale et ne pas envoyer/recevoir de messages
   IParallelMng* pm = m_parallel_mng;
 
-  Parallel::BitonicSort<Int64> uid_sorter(pm);
+  auto uid_sorter_ptr = Parallel::createParallelSort<Int64>(pm,Parallel::getDefaultParallelSortAlgorithm(pm),true);
+  Parallel::IParallelSort<Int64>& uid_sorter = *uid_sorter_ptr;
   uid_sorter.sort(items_uid);
 
   Int32ConstArrayView key_indexes = uid_sorter.keyIndexes();
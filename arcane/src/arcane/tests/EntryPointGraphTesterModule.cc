@@ -0,0 +1,474 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* EntryPointGraphTesterModule.cc                              (C) 2000-2023 */
+/*                                                                           */
+/* Modules de test de l'ordonnancement en graphe des points d'entrée.        */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/List.h"
+#include "arcane/utils/FatalErrorException.h"
+
+#include "arcane/core/BasicModule.h"
+#include "arcane/core/EntryPoint.h"
+#include "arcane/core/IEntryPointMng.h"
+#include "arcane/core/IModuleMng.h"
+#include "arcane/core/ISubDomain.h"
+#include "arcane/core/ITimeLoop.h"
+#include "arcane/core/ITimeLoopMng.h"
+#include "arcane/core/IVariableMng.h"
+#include "arcane/core/IVariableSynchronizerMng.h"
+#include "arcane/core/ItemEnumerator.h"
+#include "arcane/core/ModuleFactory.h"
+#include "arcane/core/ServiceInfo.h"
+#include "arcane/core/TimeLoopEntryPointInfo.h"
+#include "arcane/core/VariableTypes.h"
+
+#include "arcane/impl/internal/EntryPointGraphScheduler.h"
+
+#include "arcane/tests/ArcaneTestGlobal.h"
+
+#include <atomic>
+#include <stdexcept>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace ArcaneTest
+{
+
+using namespace Arcane;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Classe de base des modules de test de l'ordonnanceur en graphe.
+ *
+ * Le test utilise trois modules (A, B et C) pour que les points d'entrée
+ * de modules différents puissent être exécutés en concurrence.
+ *
+ * Chaque point d'entrée conserve un numéro d'ordre (stamp) au début et à
+ * la fin de son exécution ce qui permet de vérifier que les dépendances
+ * sont respectées.
+ */
+class EntryPointGraphTesterModuleBase
+: public BasicModule
+{
+ public:
+
+  //! Numéros d'ordre du début et de la fin d'un point d'entrée
+  struct Stamps
+  {
+    Int64 m_begin = 0;
+    Int64 m_end = 0;
+  };
+
+  //! Positionne les numéros d'ordre de \a stamps pendant sa durée de vie
+  class StampSentry
+  {
+   public:
+
+    explicit StampSentry(Stamps& stamps)
+    : m_stamps(stamps)
+    {
+      m_stamps.m_begin = _nextStamp();
+    }
+    ~StampSentry() { m_stamps.m_end = _nextStamp(); }
+
+   private:
+
+    Stamps& m_stamps;
+  };
+
+ public:
+
+  explicit EntryPointGraphTesterModuleBase(const ModuleBuildInfo& mbi)
+  : BasicModule(mbi)
+  , m_v1(VariableBuildInfo(this, "EntryPointGraphTestV1"))
+  , m_v2(VariableBuildInfo(this, "EntryPointGraphTestV2"))
+  , m_v3(VariableBuildInfo(this, "EntryPointGraphTestV3"))
+  , m_v4(VariableBuildInfo(this, "EntryPointGraphTestV4"))
+  {
+  }
+
+ public:
+
+  VersionInfo versionInfo() const override { return VersionInfo(1, 0, 0); }
+
+ protected:
+
+  //! Valeur attendue pour la variable d'indice \a index sur la maille \a cell
+  Int64 _value(Int32 index, Cell cell) const
+  {
+    Int64 uid = cell.uniqueId().asInt64();
+    Int64 iteration = m_global_iteration();
+    if (index == 3)
+      return _value(1, cell) + _value(2, cell);
+    return uid * (10 * index) + iteration;
+  }
+
+  void _fill(VariableCellInt64& var, Int32 index)
+  {
+    ENUMERATE_CELL (icell, ownCells()) {
+      var[icell] = _value(index, *icell);
+    }
+  }
+
+  //! Nombre d'erreurs pour la variable d'indice \a index sur le groupe \a cells
+  Integer _check(VariableCellInt64& var, Int32 index, const CellGroup& cells)
+  {
+    Integer nb_error = 0;
+    ENUMERATE_CELL (icell, cells) {
+      Int64 expected = _value(index, *icell);
+      if (var[icell] != expected) {
+        ++nb_error;
+        if (nb_error < 10)
+          info() << "Bad value var=" << var.name() << " uid=" << icell->uniqueId()
+                 << " value=" << var[icell] << " expected=" << expected;
+      }
+    }
+    return nb_error;
+  }
+
+ protected:
+
+  VariableCellInt64 m_v1;
+  VariableCellInt64 m_v2;
+  VariableCellInt64 m_v3;
+  VariableCellInt64 m_v4;
+
+ private:
+
+  static Int64 _nextStamp()
+  {
+    static std::atomic<Int64> stamp = 0;
+    return ++stamp;
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class EntryPointGraphTesterModuleA
+: public EntryPointGraphTesterModuleBase
+{
+ public:
+
+  explicit EntryPointGraphTesterModuleA(const ModuleBuildInfo& mbi)
+  : EntryPointGraphTesterModuleBase(mbi)
+  {
+    EntryPoint* ep = addEntryPoint(this, "WriteFirst", &EntryPointGraphTesterModuleA::writeFirst);
+    ep->addWriteDepend(m_v1.variable());
+    ep = addEntryPoint(this, "ReadSum", &EntryPointGraphTesterModuleA::readSum);
+    ep->addReadDepend(m_v1.variable());
+    ep->addReadDepend(m_v2.variable());
+    ep->addReadDepend(m_v3.variable());
+    // Ce point d'entrée n'est pas dans la boucle en temps et est utilisé
+    // uniquement pour tester la propagation des exceptions.
+    ep = addEntryPoint(this, "ThrowError", &EntryPointGraphTesterModuleA::throwError);
+    ep->addWriteDepend(m_v1.variable());
+  }
+
+ public:
+
+  void writeFirst()
+  {
+    StampSentry sentry(m_write_first_stamps);
+    _fill(m_v1, 1);
+    m_v1.deferSynchronize();
+  }
+
+  void readSum()
+  {
+    StampSentry sentry(m_read_sum_stamps);
+    Integer nb_error = _check(m_v3, 3, ownCells());
+    if (nb_error != 0)
+      ARCANE_FATAL("Bad values for '{0}' nb_error={1}", m_v3.name(), nb_error);
+  }
+
+  void throwError()
+  {
+    throw std::runtime_error("EntryPointGraphTestError");
+  }
+
+ public:
+
+  Stamps m_write_first_stamps;
+  Stamps m_read_sum_stamps;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class EntryPointGraphTesterModuleB
+: public EntryPointGraphTesterModuleBase
+{
+ public:
+
+  explicit EntryPointGraphTesterModuleB(const ModuleBuildInfo& mbi)
+  : EntryPointGraphTesterModuleBase(mbi)
+  {
+    EntryPoint* ep = addEntryPoint(this, "WriteSecond", &EntryPointGraphTesterModuleB::writeSecond);
+    ep->addWriteDepend(m_v2.variable());
+    ep = addEntryPoint(this, "WriteFourth", &EntryPointGraphTesterModuleB::writeFourth);
+    ep->addWriteDepend(m_v4.variable());
+    // Ce point d'entrée n'est pas dans la boucle en temps et est utilisé
+    // uniquement pour tester la propagation des exceptions.
+    ep = addEntryPoint(this, "AfterError", &EntryPointGraphTesterModuleB::afterError);
+    ep->addReadDepend(m_v1.variable());
+  }
+
+ public:
+
+  void writeSecond()
+  {
+    StampSentry sentry(m_write_second_stamps);
+    _fill(m_v2, 2);
+    m_v2.deferSynchronize();
+  }
+
+  void writeFourth()
+  {
+    StampSentry sentry(m_write_fourth_stamps);
+    _fill(m_v4, 4);
+    m_v4.deferSynchronize();
+  }
+
+  void afterError()
+  {
+    m_is_after_error_executed = true;
+  }
+
+ public:
+
+  Stamps m_write_second_stamps;
+  Stamps m_write_fourth_stamps;
+  bool m_is_after_error_executed = false;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Module de test de l'ordonnanceur en graphe.
+ *
+ * Ce module créé la boucle en temps 'EntryPointGraphTestLoop'. Les points
+ * d'entrée ayant déclaré leurs dépendances forment le graphe suivant:
+ *
+ * - A.WriteFirst et B.WriteSecond sont indépendants,
+ * - C.Sum dépend de A.WriteFirst et B.WriteSecond,
+ * - A.ReadSum dépend de C.Sum (et de A.WriteFirst car c'est le même module),
+ * - B.WriteFourth dépend uniquement de B.WriteSecond (même module).
+ *
+ * Les points d'entrée qui modifient une variable demandent une
+ * synchronisation différée. Le point d'entrée C.Check n'a pas de
+ * dépendances et est donc exécuté seul après les synchronisations.
+ * Il vérifie l'ordre d'exécution et les valeurs des mailles fantômes.
+ */
+class EntryPointGraphTesterModuleC
+: public EntryPointGraphTesterModuleBase
+{
+ public:
+
+  explicit EntryPointGraphTesterModuleC(const ModuleBuildInfo& mbi)
+  : EntryPointGraphTesterModuleBase(mbi)
+  {
+    EntryPoint* ep = addEntryPoint(this, "Sum", &EntryPointGraphTesterModuleC::sum);
+    ep->addReadDepend(m_v1.variable());
+    ep->addReadDepend(m_v2.variable());
+    ep->addWriteDepend(m_v3.variable());
+    addEntryPoint(this, "Check", &EntryPointGraphTesterModuleC::check);
+  }
+
+ public:
+
+  static void staticInitialize(ISubDomain* sd);
+
+ public:
+
+  void sum()
+  {
+    StampSentry sentry(m_sum_stamps);
+    ENUMERATE_CELL (icell, ownCells()) {
+      m_v3[icell] = m_v1[icell] + m_v2[icell];
+    }
+    m_v3.deferSynchronize();
+  }
+
+  void check();
+
+ private:
+
+  Stamps m_sum_stamps;
+
+ private:
+
+  void _checkOrder(const String& before_name, const Stamps& before,
+                   const String& after_name, const Stamps& after);
+  void _checkException();
+  template <typename ModuleType> ModuleType* _findModule(const String& name);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ARCANE_REGISTER_MODULE(EntryPointGraphTesterModuleA,
+                       ModuleProperty("EntryPointGraphTesterA"));
+ARCANE_REGISTER_MODULE(EntryPointGraphTesterModuleB,
+                       ModuleProperty("EntryPointGraphTesterB"));
+ARCANE_REGISTER_MODULE(EntryPointGraphTesterModuleC,
+                       ModuleProperty("EntryPointGraphTesterC"));
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void EntryPointGraphTesterModuleC::
+staticInitialize(ISubDomain* sd)
+{
+  ITimeLoopMng* tlm = sd->timeLoopMng();
+  ITimeLoop* time_loop = tlm->createTimeLoop("EntryPointGraphTestLoop");
+
+  {
+    List<TimeLoopEntryPointInfo> clist;
+    clist.add(TimeLoopEntryPointInfo("EntryPointGraphTesterA.WriteFirst"));
+    clist.add(TimeLoopEntryPointInfo("EntryPointGraphTesterB.WriteSecond"));
+    clist.add(TimeLoopEntryPointInfo("EntryPointGraphTesterC.Sum"));
+    clist.add(TimeLoopEntryPointInfo("EntryPointGraphTesterA.ReadSum"));
+    clist.add(TimeLoopEntryPointInfo("EntryPointGraphTesterB.WriteFourth"));
+    clist.add(TimeLoopEntryPointInfo("EntryPointGraphTesterC.Check"));
+    time_loop->setEntryPoints(ITimeLoop::WComputeLoop, clist);
+  }
+
+  {
+    StringList clist;
+    clist.add("EntryPointGraphTesterA");
+    clist.add("EntryPointGraphTesterB");
+    clist.add("EntryPointGraphTesterC");
+    time_loop->setRequiredModulesName(clist);
+  }
+
+  tlm->registerTimeLoop(time_loop);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+template <typename ModuleType> ModuleType* EntryPointGraphTesterModuleC::
+_findModule(const String& name)
+{
+  auto* module = dynamic_cast<ModuleType*>(subDomain()->moduleMng()->findModule(name));
+  if (!module)
+    ARCANE_FATAL("Can not find module '{0}'", name);
+  return module;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void EntryPointGraphTesterModuleC::
+check()
+{
+  info() << "Check entry point graph iteration=" << m_global_iteration();
+
+  auto* module_a = _findModule<EntryPointGraphTesterModuleA>("EntryPointGraphTesterA");
+  auto* module_b = _findModule<EntryPointGraphTesterModuleB>("EntryPointGraphTesterB");
+
+  _checkOrder("A.WriteFirst", module_a->m_write_first_stamps, "C.Sum", m_sum_stamps);
+  _checkOrder("B.WriteSecond", module_b->m_write_second_stamps, "C.Sum", m_sum_stamps);
+  _checkOrder("C.Sum", m_sum_stamps, "A.ReadSum", module_a->m_read_sum_stamps);
+  _checkOrder("B.WriteSecond", module_b->m_write_second_stamps, "B.WriteFourth", module_b->m_write_fourth_stamps);
+
+  // Les synchronisations différées des points d'entrée précédents doivent
+  // avoir été effectuées.
+  IVariableSynchronizerMng* vsm = subDomain()->variableMng()->synchronizerMng();
+  if (vsm->nbDeferredSynchronization() != 0)
+    ARCANE_FATAL("Deferred synchronizations have not been done n={0}", vsm->nbDeferredSynchronization());
+  Integer nb_error = 0;
+  nb_error += _check(m_v1, 1, allCells());
+  nb_error += _check(m_v2, 2, allCells());
+  nb_error += _check(m_v3, 3, allCells());
+  nb_error += _check(m_v4, 4, allCells());
+  if (nb_error != 0)
+    ARCANE_FATAL("Bad values after deferred synchronizations nb_error={0}", nb_error);
+
+  if (m_global_iteration() == 1)
+    _checkException();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void EntryPointGraphTesterModuleC::
+_checkOrder(const String& before_name, const Stamps& before,
+            const String& after_name, const Stamps& after)
+{
+  if (before.m_end == 0 || after.m_begin == 0)
+    ARCANE_FATAL("Entry point '{0}' or '{1}' has not been executed", before_name, after_name);
+  if (before.m_end > after.m_begin)
+    ARCANE_FATAL("Entry point '{0}' (end={1}) is not finished before the beginning of '{2}' (begin={3})",
+                 before_name, before.m_end, after_name, after.m_begin);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie que l'exception levée par un point d'entrée est propagée.
+ *
+ * B.AfterError dépend de A.ThrowError et ne doit donc pas être exécuté.
+ */
+void EntryPointGraphTesterModuleC::
+_checkException()
+{
+  auto* module_b = _findModule<EntryPointGraphTesterModuleB>("EntryPointGraphTesterB");
+  IEntryPointMng* epm = subDomain()->entryPointMng();
+  UniqueArray<IEntryPoint*> entry_points;
+  entry_points.add(epm->findEntryPoint("EntryPointGraphTesterA", "ThrowError"));
+  entry_points.add(epm->findEntryPoint("EntryPointGraphTesterB", "AfterError"));
+  for (IEntryPoint* ep : entry_points)
+    if (!ep)
+      ARCANE_FATAL("Can not find entry point");
+
+  EntryPointGraphScheduler scheduler(traceMng(), nullptr);
+  scheduler.build(entry_points);
+  if (scheduler.nbLevel() != 2)
+    ARCANE_FATAL("Bad number of level v={0} expected=2", scheduler.nbLevel());
+
+  // Vérifie que les graphes sont conservés lorsque plusieurs listes
+  // sont utilisées alternativement.
+  scheduler.build(entry_points.subConstView(0, 1));
+  if (scheduler.nbLevel() != 1)
+    ARCANE_FATAL("Bad number of level v={0} expected=1", scheduler.nbLevel());
+  scheduler.build(entry_points);
+  if (scheduler.nbLevel() != 2)
+    ARCANE_FATAL("Bad number of level v={0} expected=2", scheduler.nbLevel());
+  if (scheduler.nbGraph() != 2)
+    ARCANE_FATAL("Bad number of graph v={0} expected=2", scheduler.nbGraph());
+
+  module_b->m_is_after_error_executed = false;
+  bool has_exception = false;
+  try {
+    scheduler.execute();
+  }
+  catch (const std::runtime_error& ex) {
+    info() << "Exception caught: " << ex.what();
+    if (String(ex.what()) != "EntryPointGraphTestError")
+      ARCANE_FATAL("Bad exception message '{0}'", ex.what());
+    has_exception = true;
+  }
+  if (!has_exception)
+    ARCANE_FATAL("Exception has not been propagated by the scheduler");
+  if (module_b->m_is_after_error_executed)
+    ARCANE_FATAL("Entry point 'B.AfterError' should not have been executed");
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace ArcaneTest
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -19,6 +19,9 @@
 #include "arcane/IMesh.h"
 #include "arcane/IMeshModifier.h"
 #include "arcane/IItemFamily.h"
+#include "arcane/ItemGroupImpl.h"
+
+#include <algorithm>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -53,6 +56,8 @@ public:
  private:
   void _refineCells();
   Int64 _searchMaxUniqueId(ItemGroup group);
+  void _checkComputedGroups();
+  void _checkSameItems(ItemGroup group,Array<Int32>& expected_lids);
 
 };
 
@@ -77,8 +82,12 @@ void MeshModificationTester::
 executeTest()
 {
   info() << "execute test";
-  
+
+  // Créé les groupes calculés avant les modifications pour tester leur mise à jour
+  _checkComputedGroups();
+
   _refineCells(); // copied from MeshModifications.cs C# for easier debug
+  _checkComputedGroups();
 
   Int32UniqueArray lids(allCells().size());
   ENUMERATE_CELL(icell,allCells()) {
@@ -93,6 +102,7 @@ executeTest()
   modifier->removeCells(lids);
 
   modifier->endUpdate();
+  _checkComputedGroups();
 
   info() << "===================== THE MESH IS EMPTY";
 
@@ -120,6 +130,7 @@ executeTest()
   info() << "===================== THE CELLS ARE ADDED";
 
   modifier->endUpdate();
+  _checkComputedGroups();
 
   ENUMERATE_CELL(icell,allCells()) {
     info() << "cell[" << icell->localId() << "," << icell->uniqueId() << "] type=" 
@@ -134,6 +145,7 @@ executeTest()
   modifier->removeCells(lids);
 
   modifier->endUpdate();
+  _checkComputedGroups();
  
   ENUMERATE_CELL(icell,allCells()) {
     info() << "cell[" << icell->localId() << "," << icell->uniqueId() << "] type=" 
@@ -152,6 +164,7 @@ executeTest()
   modifier->addCells(1, cells_infos, cells_lid);
 
   modifier->endUpdate();
+  _checkComputedGroups();
 
   ENUMERATE_CELL(icell,allCells()) {
     info() << "cell[" << icell->localId() << "," << icell->uniqueId() << "] type=" 
@@ -182,6 +195,7 @@ executeTest()
   modifier->addCells(1, cells_infos, cells_lid);
 
   modifier->endUpdate();
+  _checkComputedGroups();
   
   info() << "after add/remove cell[" << "group " << group.name() << " size = " << group.size();
   ENUMERATE_CELL(icell,group) {
@@ -204,6 +218,49 @@ executeTest()
   modifier->detachCells(detached_cells);
   modifier->removeDetachedCells(detached_cells);
   modifier->endUpdate();
+  _checkComputedGroups();
+
+  ItemGroupImpl* ghost_impl = allCells().ghost().internal();
+  info() << "Ghost cells group nb_recompute=" << ghost_impl->nbRecompute()
+         << " nb_incremental_update=" << ghost_impl->nbIncrementalUpdate();
+  if (ghost_impl->isIncrementalUpdate() && ghost_impl->nbIncrementalUpdate()==0)
+    ARCANE_FATAL("Ghost cells group should have been incrementally updated");
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie que les groupes calculés des entités propres et fantômes
+ * sont identiques à ceux obtenus par un calcul complet.
+ */
+void MeshModificationTester::
+_checkComputedGroups()
+{
+  CellGroup all_cells = allCells();
+  UniqueArray<Int32> own_lids;
+  UniqueArray<Int32> ghost_lids;
+  ENUMERATE_CELL(icell,all_cells){
+    if (icell->isOwn())
+      own_lids.add(icell.itemLocalId());
+    else
+      ghost_lids.add(icell.itemLocalId());
+  }
+  _checkSameItems(all_cells.own(),own_lids);
+  _checkSameItems(all_cells.ghost(),ghost_lids);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshModificationTester::
+_checkSameItems(ItemGroup group,Array<Int32>& expected_lids)
+{
+  UniqueArray<Int32> group_lids(group.view().localIds());
+  std::sort(group_lids.begin(),group_lids.end());
+  std::sort(expected_lids.begin(),expected_lids.end());
+  if (group_lids!=expected_lids)
+    ARCANE_FATAL("Bad items for group '{0}' size={1} expected_size={2}",
+                 group.name(),group_lids.size(),expected_lids.size());
 }
 
 /*---------------------------------------------------------------------------*/
@@ -18,6 +18,7 @@
 #include "arcane/utils/ArithmeticException.h"
 #include "arcane/utils/ValueChecker.h"
 #include "arcane/utils/TestLogger.h"
+#include "arcane/utils/ValueConvert.h"
 
 #include "arcane/core/BasicUnitTest.h"
 
@@ -77,9 +78,15 @@
 #include "arcane/core/UnstructuredMeshConnectivity.h"
 #include "arcane/core/MeshVisitor.h"
 #include "arcane/core/MeshKind.h"
+#include "arcane/core/MeshBuildInfo.h"
+#include "arcane/core/IMeshMng.h"
+#include "arcane/core/MeshHandle.h"
+#include "arcane/core/IMeshFactoryMng.h"
+#include "arcane/core/UnstructuredMeshAllocateBuildInfo.h"
 #include "arcane/core/MeshEvents.h"
 
 #include <set>
+#include <map>
 
 #ifdef ARCANE_HAS_CUSTOM_MESH_TOOLS
 #include "neo/Mesh.h"
@@ -213,6 +220,9 @@ class MeshUnitTest
   void _testCoherency();
   void _testFindOneItem();
   void _testEvents();
+  void _testLocalityRenumbering();
+  void _checkLocalityOrder(ItemGroup items,const std::map<Int64,Int64>& keys);
+  void _testCompareWithSequentialAllocation();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -258,6 +268,9 @@ executeTest()
   info() << "Infos sur AllNodes:";
   allNodes().applyOperation(&op);
   _logMeshInfos();
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_TEST_COMPARE_SEQUENTIAL_ALLOCATION", true))
+    if (v.value()!=0)
+      _testCompareWithSequentialAllocation();
   if (options()->writeMesh())
     _dumpMesh();
   _testNullItem();
@@ -317,6 +330,9 @@ executeTest()
   _testCoherency();
   _testFindOneItem();
   _testEvents();
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_TEST_LOCALITY_RENUMBERING", true))
+    if (v.value()!=0)
+      _testLocalityRenumbering();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1424,6 +1440,31 @@ _testUnstructuredConnectivities()
     }
   }
 
+  {
+    // Teste Cell->Node avec une vue de taille fixe si toutes les mailles sont
+    // des hexaèdres. Dans ce cas, la connectivité doit être de taille fixe.
+    IndexedCellNodeConnectivityView icv(connectivity_view.cellNode());
+    bool is_all_hexa = true;
+    ENUMERATE_(Cell,icell,allCells()){
+      if (icell->type()!=IT_Hexaedron8){
+        is_all_hexa = false;
+        break;
+      }
+    }
+    if (is_all_hexa){
+      if (!icv.isFixedSize(8))
+        ARCANE_FATAL("Cell->Node connectivity should be of fixed size 8 for a mesh with only hexaedrons");
+      info() << "Test fixed size Cell->Node connectivity view";
+      IndexedCellNodeFixedSizeConnectivityView<8> fixed_icv(icv);
+      vc.areEqual(fixed_icv.nbSourceItem(),icv.nbSourceItem(),"SameFixedNbSourceItem");
+      ENUMERATE_(Cell,icell,allCells()){
+        vc.areEqual(fixed_icv.itemIds(icell),icv.nodeIds(icell),"SameFixedNodeArray");
+        for( Int32 i=0; i<8; ++i )
+          vc.areEqual(fixed_icv.itemId(icell,i),icv.nodeId(icell,i),"SameFixedNodeItem");
+      }
+    }
+  }
+
   {
     // Teste Cell->Edge
     IndexedCellEdgeConnectivityView icv(connectivity_view.cellEdge());
@@ -1687,6 +1728,188 @@ _testEvents()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+/*!
+ * \brief Vérifie que les entités de \a items sont rangées par numéro local
+ * suivant les clés \a keys (indexées par uniqueId()) puis les uniqueId().
+ */
+void MeshUnitTest::
+_checkLocalityOrder(ItemGroup items,const std::map<Int64,Int64>& keys)
+{
+  IItemFamily* family = items.itemFamily();
+  ItemInfoListView items_info(family);
+  Int32 nb_item = family->nbItem();
+  if (family->maxLocalId()!=nb_item)
+    ARCANE_FATAL("Family '{0}' is not compacted max_local_id={1} nb_item={2}",
+                 family->name(),family->maxLocalId(),nb_item);
+  for( Int32 lid=1; lid<nb_item; ++lid ){
+    Int64 uid1 = items_info[lid-1].uniqueId();
+    Int64 uid2 = items_info[lid].uniqueId();
+    Int64 key1 = keys.at(uid1);
+    Int64 key2 = keys.at(uid2);
+    if (key1>key2 || (key1==key2 && uid1>uid2))
+      ARCANE_FATAL("Bad locality order for family '{0}' lid={1} uid={2} key={3} previous_uid={4} previous_key={5}",
+                   family->name(),lid,uid2,key2,uid1,key1);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshUnitTest::
+_testLocalityRenumbering()
+{
+  info() << A_FUNCINFO;
+  ValueChecker vc(A_FUNCINFO);
+  IMesh* mesh = this->mesh();
+  VariableNodeReal3& nodes_coordinates(mesh->toPrimaryMesh()->nodesCoordinates());
+
+  // Sauve la connectivité et les coordonnées suivant les uniqueId()
+  // pour vérifier qu'elles ne sont pas modifiées par la renumérotation.
+  std::map<Int64,UniqueArray<Int64>> ref_cells_nodes;
+  ENUMERATE_(Cell,icell,allCells()){
+    Cell cell = *icell;
+    UniqueArray<Int64>& nodes_uid = ref_cells_nodes[cell.uniqueId()];
+    for( Node node : cell.nodes() )
+      nodes_uid.add(node.uniqueId());
+  }
+  std::map<Int64,Real3> ref_nodes_coordinates;
+  ENUMERATE_(Node,inode,allNodes()){
+    ref_nodes_coordinates[inode->uniqueId()] = nodes_coordinates[inode];
+  }
+  const Integer nb_face = allFaces().size();
+
+  MeshUtils::eLocalityRenumberingAlgorithm algorithms[3] = {
+    MeshUtils::eLocalityRenumberingAlgorithm::Hilbert,
+    MeshUtils::eLocalityRenumberingAlgorithm::Morton,
+    MeshUtils::eLocalityRenumberingAlgorithm::ReverseCuthillMcKee
+  };
+  IItemFamily* cell_family = mesh->cellFamily();
+  for( auto algorithm : algorithms ){
+    // Calcule les clés attendues suivant les uniqueId() avant renumérotation.
+    // Pour les noeuds et les faces, la clé est la plus petite clé
+    // des mailles connectées.
+    UniqueArray<Int64> cell_keys(cell_family->maxLocalId(),INT64_MAX);
+    MeshUtils::computeCellLocalityKeys(mesh,algorithm,cell_keys);
+    std::map<Int64,Int64> ref_cells_key;
+    ENUMERATE_(Cell,icell,allCells()){
+      ref_cells_key[icell->uniqueId()] = cell_keys[icell.itemLocalId()];
+    }
+    std::map<Int64,Int64> ref_nodes_key;
+    ENUMERATE_(Node,inode,allNodes()){
+      Int64 key = INT64_MAX;
+      for( CellLocalId cell_id : inode->cellIds() )
+        key = math::min(key,cell_keys[cell_id]);
+      ref_nodes_key[inode->uniqueId()] = key;
+    }
+    std::map<Int64,Int64> ref_faces_key;
+    ENUMERATE_(Face,iface,allFaces()){
+      Int64 key = INT64_MAX;
+      for( CellLocalId cell_id : iface->cellIds() )
+        key = math::min(key,cell_keys[cell_id]);
+      ref_faces_key[iface->uniqueId()] = key;
+    }
+    // Conserve les fonctions de tri pour vérifier qu'elles sont remises en place.
+    IItemInternalSortFunction* cell_sort_function = cell_family->itemSortFunction();
+    IItemInternalSortFunction* face_sort_function = mesh->faceFamily()->itemSortFunction();
+
+    MeshUtils::renumberItemsForLocality(mesh,algorithm);
+    mesh->checkValidMesh();
+    if (cell_family->itemSortFunction()!=cell_sort_function)
+      ARCANE_FATAL("Cell sort function has not been restored");
+    if (mesh->faceFamily()->itemSortFunction()!=face_sort_function)
+      ARCANE_FATAL("Face sort function has not been restored");
+    _checkLocalityOrder(allCells(),ref_cells_key);
+    _checkLocalityOrder(allNodes(),ref_nodes_key);
+    _checkLocalityOrder(allFaces(),ref_faces_key);
+    vc.areEqual(allCells().size(),(Integer)ref_cells_nodes.size(),"NbCell");
+    vc.areEqual(allNodes().size(),(Integer)ref_nodes_coordinates.size(),"NbNode");
+    vc.areEqual(allFaces().size(),nb_face,"NbFace");
+    ENUMERATE_(Cell,icell,allCells()){
+      Cell cell = *icell;
+      const UniqueArray<Int64>& nodes_uid = ref_cells_nodes[cell.uniqueId()];
+      vc.areEqual(cell.nbNode(),nodes_uid.size(),"CellNbNode");
+      for( Integer i=0, n=cell.nbNode(); i<n; ++i )
+        vc.areEqual(cell.node(i).uniqueId().asInt64(),nodes_uid[i],"CellNodeUid");
+    }
+    ENUMERATE_(Node,inode,allNodes()){
+      vc.areEqual(nodes_coordinates[inode],ref_nodes_coordinates[inode->uniqueId()],"NodeCoordinates");
+    }
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Compare le maillage avec celui obtenu par une allocation séquentielle.
+ *
+ * Créé un maillage avec les mêmes mailles que le maillage courant en
+ * désactivant le multi-threading lors de l'allocation et vérifie que
+ * les faces ont les mêmes uniqueId(), les mêmes noeuds et les mêmes
+ * mailles connectées et que les mailles ont les mêmes faces.
+ * Cela permet de vérifier que l'allocation multi-thread
+ * (ARCANE_UNSTRUCTURED_MESH_ALLOCATE_MULTI_THREADING) donne le même
+ * maillage que l'allocation séquentielle.
+ */
+void MeshUnitTest::
+_testCompareWithSequentialAllocation()
+{
+  info() << A_FUNCINFO;
+  ValueChecker vc(A_FUNCINFO);
+  IParallelMng* pm = mesh()->parallelMng();
+  if (pm->isParallel()){
+    info() << "Test only available in sequential";
+    return;
+  }
+
+  MeshBuildInfo mbi("SequentialAllocationMesh");
+  mbi.addParallelMng(makeRef(pm));
+  IPrimaryMesh* ref_mesh = mesh()->meshMng()->meshFactoryMng()->createMesh(mbi);
+  {
+    UnstructuredMeshAllocateBuildInfo build_info(ref_mesh);
+    build_info.setMeshDimension(mesh()->dimension());
+    build_info.setUseMultiThreading(false);
+    UniqueArray<Int64> nodes_uid;
+    ENUMERATE_(Cell,icell,allCells()){
+      Cell cell = *icell;
+      nodes_uid.clear();
+      for( Node node : cell.nodes() )
+        nodes_uid.add(node.uniqueId());
+      build_info.addCell(cell.itemTypeId(),cell.uniqueId(),nodes_uid.view());
+    }
+    build_info.allocateMesh();
+  }
+
+  IItemFamily* ref_face_family = ref_mesh->faceFamily();
+  IItemFamily* ref_cell_family = ref_mesh->cellFamily();
+  vc.areEqual(ref_mesh->nbNode(),mesh()->nbNode(),"NbNode");
+  vc.areEqual(ref_mesh->nbFace(),mesh()->nbFace(),"NbFace");
+  vc.areEqual(ref_mesh->nbCell(),mesh()->nbCell(),"NbCell");
+  ENUMERATE_(Face,iface,allFaces()){
+    Face face = *iface;
+    Face ref_face = MeshUtils::findOneItem(ref_face_family,face.uniqueId());
+    if (ref_face.null())
+      ARCANE_FATAL("Face {0} is missing in sequential mesh",ItemPrinter(face));
+    vc.areEqual(face.nbNode(),ref_face.nbNode(),"FaceNbNode");
+    for( Integer i=0, n=face.nbNode(); i<n; ++i )
+      vc.areEqual(face.node(i).uniqueId(),ref_face.node(i).uniqueId(),"FaceNodeUid");
+    vc.areEqual(face.backCell().uniqueId(),ref_face.backCell().uniqueId(),"FaceBackCellUid");
+    vc.areEqual(face.frontCell().uniqueId(),ref_face.frontCell().uniqueId(),"FaceFrontCellUid");
+  }
+  ENUMERATE_(Cell,icell,allCells()){
+    Cell cell = *icell;
+    Cell ref_cell = MeshUtils::findOneItem(ref_cell_family,cell.uniqueId());
+    if (ref_cell.null())
+      ARCANE_FATAL("Cell {0} is missing in sequential mesh",ItemPrinter(cell));
+    vc.areEqual(cell.nbFace(),ref_cell.nbFace(),"CellNbFace");
+    for( Integer i=0, n=cell.nbFace(); i<n; ++i )
+      vc.areEqual(cell.face(i).uniqueId(),ref_cell.face(i).uniqueId(),"CellFaceUid");
+  }
+  mesh()->meshMng()->destroyMesh(ref_mesh->handle());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 } // End namespace ArcaneTest
 
 /*---------------------------------------------------------------------------*/
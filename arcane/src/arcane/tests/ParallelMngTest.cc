@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ParallelMngTest.cc                                          (C) 2000-2020 */
+/* ParallelMngTest.cc                                          (C) 2000-2023 */
 /*                                                                           */
 /* Test des opérations de base du parallèlisme.                              */
 /*---------------------------------------------------------------------------*/
@@ -23,6 +23,7 @@
 #include "arcane/utils/Real2x2.h"
 #include "arcane/utils/Real3x3.h"
 #include "arcane/utils/HPReal.h"
+#include "arcane/utils/ExactRealSum.h"
 #include "arcane/utils/ScopedPtr.h"
 
 #include "arcane/FactoryService.h"
@@ -45,6 +46,7 @@
 #include "arccore/message_passing/Messages.h"
 
 #include <cstdint>
+#include <random>
 #include <thread>
 
 /*---------------------------------------------------------------------------*/
@@ -101,6 +103,7 @@ class ParallelMngTest
   void _testSerializerWithMessageInfo(Integer nb_value,bool use_wait);
   template<typename DataType> void _testParallelBasic(DataType data);
   void _testReduce2();
+  void _testReproducibleSum();
   void _launchTest(const String& test_name,void (ParallelMngTest::*func)());
   void _testBarrier();
   void _testProcessMessages();
@@ -166,6 +169,7 @@ execute()
   _launchTest("send_receive_nb3",&ParallelMngTest::_testSendRecvNonBlocking3);
 
   _launchTest("reduce2",&ParallelMngTest::_testReduce2);
+  _launchTest("reproducible_sum",&ParallelMngTest::_testReproducibleSum);
 
   if (m_test_broadcast_serializer){
     _launchTest("broadcast_serializer",&ParallelMngTest::_testBroadcastSerializer);
@@ -910,6 +914,83 @@ _testReduce2()
   _testParallelBasic(HPReal(math::log(3.0),math::log(3.14159)));
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ParallelMngTest::
+_testReproducibleSum()
+{
+  ValueChecker vc(A_FUNCINFO);
+  IParallelMng* pm = m_parallel_mng;
+  const Int32 rank = pm->commRank();
+  const Int32 nb_rank = pm->commSize();
+
+  // Tous les rangs génèrent les mêmes valeurs et chacun en accumule une
+  // partie. La somme doit être identique à celle calculée localement
+  // sur toutes les valeurs et donc ne pas dépendre du nombre de rangs.
+  {
+    const Int32 nb_value = 100000;
+    std::mt19937_64 randomizer(29);
+    std::uniform_real_distribution<Real> value_distrib(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent_distrib(-60, 60);
+    ExactRealSum reference;
+    ExactRealSum local_sum;
+    for( Int32 i=0; i<nb_value; ++i ){
+      Real v = std::ldexp(value_distrib(randomizer), exponent_distrib(randomizer));
+      reference.add(v);
+      if ((i % nb_rank)==rank)
+        local_sum.add(v);
+    }
+    ParallelMngUtils::reduceExactSum(pm,ArrayView<ExactRealSum>(1,&local_sum));
+    info() << "ReproducibleSum value=" << String::fromNumber(local_sum.toReal(),20);
+    vc.areEqual(local_sum.toReal(),reference.toReal(),"ExactSum");
+  }
+
+  // Avec le mode reproductible, reduce() donne la somme exacte même
+  // lorsque l'ordre des additions change le résultat classique.
+  {
+    const bool old_mode = ParallelMngUtils::isReproducibleReduceSum(pm);
+    ParallelMngUtils::setReproducibleReduceSum(pm,true);
+    auto rank_value = [nb_rank](Int32 r) -> Real
+    {
+      const Real big_value = std::ldexp(1.0,60);
+      if (r==0)
+        return big_value;
+      if (r==(nb_rank-1))
+        return -big_value;
+      return 1.0;
+    };
+    ExactRealSum reference;
+    for( Int32 r=0; r<nb_rank; ++r )
+      reference.add(rank_value(r));
+    const Real expected = reference.toReal();
+    Real v = rank_value(rank);
+    Real r1 = pm->reduce(Parallel::ReduceSum,v);
+    vc.areEqual(r1,expected,"ReproducibleReduceSum");
+    UniqueArray<Real> values = { v, 2.0 * v };
+    pm->reduce(Parallel::ReduceSum,values.view());
+    vc.areEqual(values[0],expected,"ReproducibleReduceSumArray0");
+    vc.areEqual(values[1],2.0 * expected,"ReproducibleReduceSumArray1");
+
+    // Mesure le surcoût du mode reproductible.
+    const Int32 nb_loop = 20;
+    UniqueArray<Real> bench_values(10000);
+    Real times[2];
+    for( Int32 mode=0; mode<2; ++mode ){
+      ParallelMngUtils::setReproducibleReduceSum(pm,mode==1);
+      Real t0 = platform::getRealTime();
+      for( Int32 k=0; k<nb_loop; ++k ){
+        bench_values.fill(static_cast<Real>(rank + k));
+        pm->reduce(Parallel::ReduceSum,bench_values.view());
+      }
+      times[mode] = platform::getRealTime() - t0;
+    }
+    info() << "ReproducibleSum time classic=" << times[0] << " reproducible=" << times[1]
+           << " ratio=" << ((times[0]>0.0) ? (times[1] / times[0]) : 0.0);
+    ParallelMngUtils::setReproducibleReduceSum(pm,old_mode);
+  }
+}
+
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -16,6 +16,9 @@
 #include "arcane/utils/CheckedConvert.h"
 #include "arcane/utils/ValueChecker.h"
 #include "arcane/utils/Event.h"
+#include "arcane/utils/JSONWriter.h"
+#include "arcane/utils/JSONReader.h"
+#include "arcane/utils/PlatformUtils.h"
 
 #include "arcane/core/MeshVariableInfo.h"
 #include "arcane/core/EntryPoint.h"
@@ -30,6 +33,7 @@
 #include "arcane/core/IMesh.h"
 #include "arcane/core/IMeshModifier.h"
 #include "arcane/core/ItemGroup.h"
+#include "arcane/core/ItemPrinter.h"
 #include "arcane/core/ItemEnumerator.h"
 #include "arcane/core/Timer.h"
 #include "arcane/core/IItemFamily.h"
@@ -48,6 +52,8 @@
 #include "arcane/core/ParallelMngUtils.h"
 #include "arcane/core/IVariableMng.h"
 #include "arcane/core/IVariableSynchronizerMng.h"
+#include "arcane/core/IVariableSynchronizerRequest.h"
+#include "arcane/core/Connectivity.h"
 
 #include "arcane/SerializeBuffer.h"
 
@@ -58,6 +64,7 @@
 #include "arcane/tests/ParallelTester_axl.h"
 
 #include "arcane/parallel/BitonicSortT.H"
+#include "arcane/core/parallel/ParallelSort.h"
 #include "arcane/IParallelExchanger.h"
 #include "arcane/ISerializeMessage.h"
 
@@ -317,6 +324,9 @@ class ParallelTesterModule
 
   void _testSynchronize();
   void _testMultiSynchronize();
+  void _testDeferredSynchronize();
+  void _testAsyncSynchronize();
+  void _testDeltaSynchronize();
   void _testSameValuesOnAllReplica();
   void _testDifferentValuesOnAllReplica();
   void _testAccumulate();
@@ -328,7 +338,9 @@ class ParallelTesterModule
   void _doInit();
   void _checkEnd();
   void _testBitonicSort();
+  void _testSampleSort();
   void _testPartialVariables();
+  void _checkSynchronizeProfiling();
   void _initParticleFamily(IItemFamily* family);
 };
 
@@ -517,6 +529,11 @@ void ParallelTesterModule::
 testBuild()
 {
   info() << "TEST BUILD";
+  if (options()->hasEdges()) {
+    info() << "Adding edge connectivity";
+    Connectivity c(defaultMesh()->connectivity());
+    c.enableConnectivity(Connectivity::CT_HasEdge);
+  }
   // Créé un autre maillage pour s'assurer que le partitonneur interne
   // fonctionne bien avec un 2ème maillage vide.
   ISubDomain* sd = subDomain();
@@ -573,6 +590,9 @@ testLoop()
   if (m_nb_test_synchronize>=1){
     _testSynchronize();
     _testMultiSynchronize();
+    _testDeferredSynchronize();
+    _testAsyncSynchronize();
+    _testDeltaSynchronize();
     _testSameValuesOnAllReplica();
     _testDifferentValuesOnAllReplica();
   }
@@ -584,6 +604,7 @@ testLoop()
       _testAccumulate();
       _testGhostItemsReduceOperation();
       _testBitonicSort();
+      _testSampleSort();
       _testLoadBalance();
       _testGetVariableValues();
       _testGhostItemsReduceOperation();
@@ -622,6 +643,74 @@ testExit()
 {
   for( ParticleFamilyTester* p : m_particle_family_testers )
     p->unregisterBuilder();
+  _checkSynchronizeProfiling();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie les informations de profilage des synchronisations.
+ *
+ * Génère le bloc 'SynchronizeStats' tel qu'il est écrit dans les
+ * statistiques JSON de fin d'exécution, le relit et vérifie que les
+ * compteurs attendus sont présents pour chaque synchronisateur.
+ */
+void ParallelTesterModule::
+_checkSynchronizeProfiling()
+{
+  IVariableSynchronizerMng* sync_mng = subDomain()->variableMng()->synchronizerMng();
+  JSONWriter json_writer(JSONWriter::FormatFlags::None);
+  json_writer.beginObject();
+  {
+    JSONWriter::Object jo(json_writer,"SynchronizeStats");
+    sync_mng->dumpStatsJSON(json_writer);
+  }
+  json_writer.endObject();
+
+  JSONDocument json_doc;
+  json_doc.parse(json_writer.getBuffer().bytes());
+  JSONValue stats = json_doc.root().expectedChild("SynchronizeStats");
+  bool is_profiling = stats.expectedChild("IsProfiling").valueAsBool();
+  bool want_profiling = (platform::getEnvironmentVariable("ARCANE_SYNCHRONIZE_PROFILING")=="1");
+  info() << "Check synchronize profiling is_profiling=" << is_profiling;
+  if (want_profiling && !is_profiling)
+    ARCANE_FATAL("Synchronize profiling is not enabled");
+  if (!is_profiling)
+    return;
+
+  const char* counter_names[] = { "NbSynchronize", "NbVariable", "NbMessage", "SendSize", "ReceiveSize",
+                                  "MaxSendMessageSize", "ElapsedTime", "CopyTime", "WaitTime",
+                                  "NeighbourImbalance" };
+  auto check_counters = [&](JSONValue v)
+  {
+    for( const char* name : counter_names )
+      v.expectedChild(name);
+    if (v.expectedChild("NbSynchronize").valueAsInt64()<=0)
+      ARCANE_FATAL("Bad value for 'NbSynchronize' of '{0}'",v.expectedChild("Name").value());
+  };
+
+  String cell_group_name = defaultMesh()->allCells().fullName();
+  bool has_cell_synchronizer = false;
+  for( JSONValue v : stats.expectedChild("Synchronizers").valueAsArray() ){
+    check_counters(v);
+    if (v.expectedChild("Name").value()!=cell_group_name)
+      continue;
+    has_cell_synchronizer = true;
+    if (parallelMng()->commSize()>1 && v.expectedChild("NbMessage").valueAsInt64()<=0)
+      ARCANE_FATAL("No message for synchronizer '{0}'",cell_group_name);
+    if (v.expectedChild("ElapsedTime").valueAsReal()<0.0)
+      ARCANE_FATAL("Bad elapsed time for synchronizer '{0}'",cell_group_name);
+  }
+  if (!has_cell_synchronizer)
+    ARCANE_FATAL("No profiling information for synchronizer '{0}'",cell_group_name);
+
+  Int32 nb_variable = 0;
+  for( JSONValue v : stats.expectedChild("Variables").valueAsArray() ){
+    check_counters(v);
+    ++nb_variable;
+  }
+  if (nb_variable==0)
+    ARCANE_FATAL("No profiling information for variables");
 }
 
 /*---------------------------------------------------------------------------*/
@@ -924,6 +1013,299 @@ _testMultiSynchronize()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void ParallelTesterModule::
+_testDeferredSynchronize()
+{
+  info() << "Test deferred synchronize";
+
+  IMesh* mesh = defaultMesh();
+  IVariableSynchronizerMng* vsm = mesh->variableMng()->synchronizerMng();
+
+  Integer wanted_value = m_global_iteration() + 3;
+  // Positionne les valeurs
+  {
+    m_nodes.setValues(wanted_value,mesh->ownNodes());
+    m_faces.setValues(wanted_value,mesh->ownFaces());
+    m_cells.setValues(wanted_value,mesh->ownCells());
+    m_array_nodes.setValues(wanted_value,mesh->ownNodes());
+    m_array_faces.setValues(wanted_value,mesh->ownFaces());
+    m_array_cells.setValues(wanted_value,mesh->ownCells());
+  }
+
+  // Ajoute les variables en mélangeant les familles et le type des données.
+  VariableList vars;
+  m_cells.addToCollection(vars);
+  m_array_nodes.addToCollection(vars);
+  m_faces.addToCollection(vars);
+  m_array_cells.addToCollection(vars);
+  m_nodes.addToCollection(vars);
+  m_array_faces.addToCollection(vars);
+  for( VariableCollection::Enumerator ivar(vars); ++ivar; ){
+    vsm->addDeferredSynchronization(*ivar);
+    // Ajoute deux fois pour vérifier que cela ne fait qu'une synchronisation
+    vsm->addDeferredSynchronization(*ivar);
+  }
+  if (vsm->nbDeferredSynchronization()!=vars.count())
+    ARCANE_FATAL("Bad number of deferred synchronization n={0} expected={1}",
+                 vsm->nbDeferredSynchronization(),vars.count());
+
+  vsm->flushDeferredSynchronizations();
+  if (vsm->nbDeferredSynchronization()!=0)
+    ARCANE_FATAL("Deferred synchronizations are still pending after flush");
+
+  // Vérifie les valeurs
+  {
+    Integer nb_error = 0;
+    nb_error += m_nodes.checkValues(wanted_value,mesh->allNodes());
+    nb_error += m_faces.checkValues(wanted_value,mesh->allFaces());
+    nb_error += m_cells.checkValues(wanted_value,mesh->allCells());
+    nb_error += m_array_nodes.checkValues(wanted_value,mesh->allNodes());
+    nb_error += m_array_faces.checkValues(wanted_value,mesh->allFaces());
+    nb_error += m_array_cells.checkValues(wanted_value,mesh->allCells());
+    if (nb_error!=0)
+      ARCANE_FATAL("Error in deferred synchronize test: n={0}",nb_error);
+  }
+
+  // Mélange des variables partielles et des variables sur toutes les entités.
+  // Les variables partielles sont synchronisées par le synchroniseur de leur
+  // groupe, une par une.
+  {
+    IItemFamily* cell_family = mesh->cellFamily();
+    PartialVariableCellInt32 partial_var2(VariableBuildInfo(mesh,"TestDeferredSynchronizePartial",
+                                                            cell_family->name(),m_partial_cell_group.name()));
+    ENUMERATE_CELL(icell,m_partial_cell_group){
+      Cell cell = *icell;
+      if (cell.isOwn())
+        partial_var2[icell] = CheckedConvert::toInt32(cell.uniqueId().asInt64() % 1000) + wanted_value;
+      else{
+        partial_var2[icell] = -1;
+        (*m_partial_cell_variable)[icell] = -1.0;
+      }
+    }
+    m_cells.setValues(wanted_value+1,mesh->ownCells());
+    m_array_nodes.setValues(wanted_value+1,mesh->ownNodes());
+
+    vsm->addDeferredSynchronization(m_partial_cell_variable->variable());
+    for( VariableCollection::Enumerator ivar(vars); ++ivar; ){
+      vsm->addDeferredSynchronization(*ivar);
+      vsm->addDeferredSynchronization(partial_var2.variable());
+    }
+    if (vsm->nbDeferredSynchronization()!=(vars.count()+2))
+      ARCANE_FATAL("Bad number of deferred synchronization n={0} expected={1}",
+                   vsm->nbDeferredSynchronization(),vars.count()+2);
+    vsm->flushDeferredSynchronizations();
+
+    Integer nb_error = 0;
+    ENUMERATE_CELL(icell,m_partial_cell_group){
+      Cell cell = *icell;
+      Int32 expected_value = CheckedConvert::toInt32(cell.uniqueId().asInt64() % 1000) + wanted_value;
+      if (partial_var2[icell]!=expected_value)
+        ++nb_error;
+    }
+    nb_error += m_cells.checkValues(wanted_value+1,mesh->allCells());
+    nb_error += m_array_nodes.checkValues(wanted_value+1,mesh->allNodes());
+    if (nb_error!=0)
+      ARCANE_FATAL("Error in deferred synchronize test with partial variables: n={0}",nb_error);
+    // Vérifie aussi les valeurs de la variable partielle réelle
+    _testPartialVariables();
+  }
+
+  // Une variable détruite avant l'appel à flushDeferredSynchronizations()
+  // doit être retirée des synchronisations différées.
+  {
+    VariableCellInt32 tmp_var(VariableBuildInfo(mesh,"TestDeferredSynchronizeTemporary"));
+    tmp_var.fill(0);
+    tmp_var.deferSynchronize();
+    if (vsm->nbDeferredSynchronization()!=1)
+      ARCANE_FATAL("Bad number of deferred synchronization n={0} expected=1",
+                   vsm->nbDeferredSynchronization());
+  }
+  if (vsm->nbDeferredSynchronization()!=0)
+    ARCANE_FATAL("Removed variable is still in the deferred synchronization list");
+  vsm->flushDeferredSynchronizations();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ParallelTesterModule::
+_testAsyncSynchronize()
+{
+  info() << "Test asynchronous synchronize";
+
+  IMesh* mesh = defaultMesh();
+
+  Integer wanted_value = m_global_iteration() + 5;
+  {
+    m_nodes.setValues(wanted_value,mesh->ownNodes());
+    m_faces.setValues(wanted_value,mesh->ownFaces());
+    m_cells.setValues(wanted_value,mesh->ownCells());
+    m_array_cells.setValues(wanted_value,mesh->ownCells());
+  }
+
+  VariableList vars;
+  m_cells.addToCollection(vars);
+  m_nodes.addToCollection(vars);
+  m_faces.addToCollection(vars);
+  m_array_cells.addToCollection(vars);
+
+  // Commence toutes les synchronisations avant d'attendre la fin
+  // de la première pour avoir plusieurs synchronisations en cours.
+  UniqueArray<Ref<IVariableSynchronizerRequest>> requests;
+  for( VariableCollection::Enumerator ivar(vars); ++ivar; ){
+    IVariable* var = *ivar;
+    IVariableSynchronizer* sync = var->itemFamily()->allItemsSynchronizer();
+    requests.add(sync->synchronizeAsync(var));
+  }
+
+  // Vérifie que les entités internes et frontières forment une partition
+  // des entités propres.
+  IItemFamily* families[3] = { mesh->nodeFamily(), mesh->faceFamily(), mesh->cellFamily() };
+  for( IItemFamily* family : families ){
+    IVariableSynchronizer* sync = family->allItemsSynchronizer();
+    ItemGroup inner_items = sync->innerItems();
+    ItemGroup boundary_items = sync->boundaryItems();
+    Integer nb_own = family->allItems().own().size();
+    info() << "Family=" << family->name() << " nb_own=" << nb_own
+           << " nb_inner=" << inner_items.size() << " nb_boundary=" << boundary_items.size();
+    if (inner_items.size()+boundary_items.size()!=nb_own)
+      ARCANE_FATAL("Bad inner/boundary items for family '{0}' nb_inner={1} nb_boundary={2} nb_own={3}",
+                   family->name(),inner_items.size(),boundary_items.size(),nb_own);
+    ENUMERATE_ITEM(iitem,boundary_items){
+      if (!(*iitem).isOwn())
+        ARCANE_FATAL("Boundary item '{0}' is not owned",ItemPrinter(*iitem));
+    }
+  }
+
+  // Effectue des calculs pendant les synchronisations. Seules les entités
+  // internes peuvent être modifiées car leurs valeurs ne sont pas envoyées.
+  IVariableSynchronizer* cell_sync = mesh->cellFamily()->allItemsSynchronizer();
+  CellGroup inner_cells = cell_sync->innerItems();
+  CellGroup boundary_cells = cell_sync->boundaryItems();
+  Integer inner_value = wanted_value + 1;
+  m_cells.setValues(inner_value,inner_cells);
+  m_array_cells.setValues(inner_value,inner_cells);
+  ENUMERATE_CELL(icell,inner_cells){
+    Cell cell = *icell;
+    Real sum = 0.0;
+    for( Node node : cell.nodes() )
+      sum += (Real)node.uniqueId().asInt64();
+    m_cell_real_values[icell] = sum;
+  }
+
+  for( auto& r : requests ){
+    r->wait();
+    if (!r->isDone())
+      ARCANE_FATAL("Request for variable '{0}' is not done after wait()",r->variable()->name());
+  }
+
+  {
+    Integer nb_error = 0;
+    nb_error += m_nodes.checkValues(wanted_value,mesh->allNodes());
+    nb_error += m_faces.checkValues(wanted_value,mesh->allFaces());
+    nb_error += m_cells.checkValues(wanted_value,mesh->allCells().ghost());
+    nb_error += m_cells.checkValues(wanted_value,boundary_cells);
+    nb_error += m_cells.checkValues(inner_value,inner_cells);
+    nb_error += m_array_cells.checkValues(wanted_value,mesh->allCells().ghost());
+    nb_error += m_array_cells.checkValues(wanted_value,boundary_cells);
+    nb_error += m_array_cells.checkValues(inner_value,inner_cells);
+    ENUMERATE_CELL(icell,inner_cells){
+      Cell cell = *icell;
+      Real sum = 0.0;
+      for( Node node : cell.nodes() )
+        sum += (Real)node.uniqueId().asInt64();
+      if (m_cell_real_values[icell]!=sum)
+        ++nb_error;
+    }
+    if (nb_error!=0)
+      ARCANE_FATAL("Error in asynchronous synchronize test: n={0}",nb_error);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ParallelTesterModule::
+_testDeltaSynchronize()
+{
+  info() << "Test delta synchronize";
+
+  IMesh* mesh = defaultMesh();
+  IVariableSynchronizerMng* vsm = mesh->variableMng()->synchronizerMng();
+
+  VariableList vars;
+  m_cells.addToCollection(vars);
+  m_array_faces.addToCollection(vars);
+  for( VariableCollection::Enumerator ivar(vars); ++ivar; )
+    vsm->setDeltaSynchronization(*ivar,true);
+
+  // La première synchronisation envoie toutes les valeurs, la deuxième
+  // aucune car les valeurs n'ont pas changé et la troisième toutes les
+  // valeurs car elles ont toutes changé.
+  Integer base_value = m_global_iteration() + 7;
+  Integer values[3] = { base_value, base_value, base_value+1 };
+  for( Integer wanted_value : values ){
+    m_cells.setValues(wanted_value,mesh->ownCells());
+    m_array_faces.setValues(wanted_value,mesh->ownFaces());
+    for( VariableCollection::Enumerator ivar(vars); ++ivar; )
+      (*ivar)->synchronize();
+    Integer nb_error = 0;
+    nb_error += m_cells.checkValues(wanted_value,mesh->allCells());
+    nb_error += m_array_faces.checkValues(wanted_value,mesh->allFaces());
+    if (nb_error!=0)
+      ARCANE_FATAL("Error in delta synchronize test: n={0}",nb_error);
+  }
+
+  // Ne modifie qu'une partie des entités pour que seules les valeurs
+  // modifiées soient envoyées. Le choix des entités se fait à partir
+  // du uniqueId() pour être cohérent entre les sous-domaines.
+  {
+    UniqueArray<Int32> changed_ids;
+    UniqueArray<Int32> unchanged_ids;
+    ENUMERATE_CELL(icell,mesh->allCells()){
+      if ((icell->uniqueId().asInt64() % 7)==0)
+        changed_ids.add(icell.itemLocalId());
+      else
+        unchanged_ids.add(icell.itemLocalId());
+    }
+    CellGroup changed_cells = mesh->cellFamily()->createGroup("TestDeltaChangedCells",changed_ids,true);
+    CellGroup unchanged_cells = mesh->cellFamily()->createGroup("TestDeltaUnchangedCells",unchanged_ids,true);
+    changed_ids.clear();
+    unchanged_ids.clear();
+    ENUMERATE_FACE(iface,mesh->allFaces()){
+      if ((iface->uniqueId().asInt64() % 7)==0)
+        changed_ids.add(iface.itemLocalId());
+      else
+        unchanged_ids.add(iface.itemLocalId());
+    }
+    FaceGroup changed_faces = mesh->faceFamily()->createGroup("TestDeltaChangedFaces",changed_ids,true);
+    FaceGroup unchanged_faces = mesh->faceFamily()->createGroup("TestDeltaUnchangedFaces",unchanged_ids,true);
+
+    Integer old_value = base_value + 1;
+    Integer new_value = base_value + 2;
+    m_cells.setValues(new_value,changed_cells.own());
+    m_array_faces.setValues(new_value,changed_faces.own());
+    for( VariableCollection::Enumerator ivar(vars); ++ivar; )
+      (*ivar)->synchronize();
+    Integer nb_error = 0;
+    nb_error += m_cells.checkValues(new_value,changed_cells);
+    nb_error += m_cells.checkValues(old_value,unchanged_cells);
+    nb_error += m_array_faces.checkValues(new_value,changed_faces);
+    nb_error += m_array_faces.checkValues(old_value,unchanged_faces);
+    if (nb_error!=0)
+      ARCANE_FATAL("Error in partial delta synchronize test: n={0}",nb_error);
+  }
+
+  for( VariableCollection::Enumerator ivar(vars); ++ivar; ){
+    if (!vsm->isDeltaSynchronization(*ivar))
+      ARCANE_FATAL("Delta synchronization is not enabled for variable '{0}'",(*ivar)->name());
+    vsm->setDeltaSynchronization(*ivar,false);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void ParallelTesterModule::
 _writeAccumulateInfos(std::ostream& ofile,eItemKind ik,const String& msg)
 {
@@ -1406,6 +1788,70 @@ _testBitonicSort()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void ParallelTesterModule::
+_testSampleSort()
+{
+  info() << "SAMPLE SORT !!!";
+  IMesh* mesh = defaultMesh();
+  IParallelMng* pm = subDomain()->parallelMng();
+  IItemFamily* family = mesh->cellFamily();
+
+  // Mélange les uniqueId() pour que la répartition initiale des clés
+  // ne soit pas déjà triée.
+  Int64UniqueArray cells_uid;
+  CellGroup own_group = family->allItems().own();
+  ENUMERATE_CELL(icell,own_group){
+    Int64 uid = (*icell).uniqueId().asInt64();
+    cells_uid.add((uid*7919) % 100003);
+  }
+
+  auto bitonic_sorter = Parallel::createParallelSort<Int64>(pm,Parallel::eParallelSortAlgorithm::Bitonic,true);
+  bitonic_sorter->sort(cells_uid);
+  Parallel::SampleSort<Int64> sample_sorter(pm);
+  // Utilise peu d'échantillons pour que la répartition soit déséquilibrée.
+  sample_sorter.setNbSamplePerRank(3);
+  sample_sorter.sort(cells_uid);
+
+  Int64ConstArrayView keys = sample_sorter.keys();
+  Int32ConstArrayView key_ranks = sample_sorter.keyRanks();
+  Int32ConstArrayView key_indexes = sample_sorter.keyIndexes();
+  info() << "END SAMPLE SORT SIZE=" << keys.size();
+
+  // Les clés sont triées localement et le rang et l'indice d'origine
+  // doivent permettre de retrouver la clé.
+  for( Integer i=1, n=keys.size(); i<n; ++i )
+    if (keys[i]<keys[i-1])
+      ARCANE_FATAL("Keys are not sorted i={0} key={1} previous={2}",i,keys[i],keys[i-1]);
+  Int32 my_rank = pm->commRank();
+  for( Integer i=0, n=keys.size(); i<n; ++i ){
+    if (key_ranks[i]==my_rank && cells_uid[key_indexes[i]]!=keys[i])
+      ARCANE_FATAL("Bad index i={0} key={1} index={2}",i,keys[i],key_indexes[i]);
+  }
+
+  // La concaténation des clés de tous les rangs doit être identique
+  // à celle obtenue avec le tri bitonique.
+  Int64UniqueArray all_bitonic_keys;
+  pm->allGatherVariable(bitonic_sorter->keys(),all_bitonic_keys);
+  Int64UniqueArray all_sample_keys;
+  pm->allGatherVariable(keys,all_sample_keys);
+  if (all_bitonic_keys.size()!=all_sample_keys.size())
+    ARCANE_FATAL("Bad number of keys bitonic={0} sample={1}",all_bitonic_keys.size(),all_sample_keys.size());
+  for( Integer i=0, n=all_sample_keys.size(); i<n; ++i )
+    if (all_bitonic_keys[i]!=all_sample_keys[i])
+      ARCANE_FATAL("Bad key i={0} bitonic={1} sample={2}",i,all_bitonic_keys[i],all_sample_keys[i]);
+
+  // Les rangs sans clés doivent être les derniers.
+  Int64 nb_key = keys.size();
+  Int64UniqueArray all_nb_keys(pm->commSize());
+  pm->allGather(ConstArrayView<Int64>(1,&nb_key),all_nb_keys);
+  for( Integer i=1, n=all_nb_keys.size(); i<n; ++i )
+    if (all_nb_keys[i]!=0 && all_nb_keys[i-1]==0)
+      ARCANE_FATAL("Empty rank '{0}' before non empty rank '{1}'",i-1,i);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void ParallelTesterModule::
 _testPartialVariables()
 {
@@ -1,6 +1,6 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
@@ -22,6 +22,7 @@
 #include "arcane/SimdItem.h"
 #include "arcane/VariableView.h"
 #include "arcane/Timer.h"
+#include "arcane/UnstructuredMeshConnectivity.h"
 
 #include "arcane/tests/ArcaneTestGlobal.h"
 
@@ -123,6 +124,7 @@ class VariableSimdUnitTest
   void _doItemPointer() ARCANE_GCC_VECTORIZE;
   void _doItemNoIndirect() ARCANE_GCC_VECTORIZE;
   void _doTest( void (VariableSimdUnitTest::*functor)(), const String& name);
+  void _testNodeGatherScatter();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -399,6 +401,8 @@ executeTest()
     }
   }
 
+  _testNodeGatherScatter();
+
   _doTest(&VariableSimdUnitTest::_doSimdItem,"SimdItem");
   _doTest(&VariableSimdUnitTest::_doSimdItemIter,"SimdItemIter");
   _doTest(&VariableSimdUnitTest::_doSimdItemDirect,"SimdItemDirect");
@@ -411,6 +415,90 @@ executeTest()
   _doTest(&VariableSimdUnitTest::_doItemNoIndirect,"ItemNoIndirect");
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Teste la lecture vectorielle des coordonnées des noeuds des mailles
+ * et l'accumulation vectorielle aux noeuds.
+ */
+void VariableSimdUnitTest::
+_testNodeGatherScatter()
+{
+  IMesh* mesh = this->mesh();
+  UnstructuredMeshConnectivityView connectivity_view(mesh);
+  auto cell_node = connectivity_view.cellNode();
+
+  // Le test nécessite que toutes les mailles aient le même nombre de noeuds.
+  Int32 nb_node = -1;
+  ENUMERATE_CELL(icell,m_cells){
+    Int32 n = cell_node.nbNode(icell);
+    if (nb_node==(-1))
+      nb_node = n;
+    if (n!=nb_node){
+      info() << "Skipping SIMD node gather/scatter test because cells have different number of nodes";
+      return;
+    }
+  }
+  info() << "Test SIMD node gather/scatter nb_node_per_cell=" << nb_node;
+
+  VariableNodeReal3& nodes_coord = mesh->nodesCoordinates();
+  VariableNodeReal3 simd_node_sum(VariableBuildInfo(mesh,"SimdNodeSum"));
+  VariableNodeReal3 ref_node_sum(VariableBuildInfo(mesh,"RefNodeSum"));
+  VariableCellReal3 simd_center(VariableBuildInfo(mesh,"SimdCellCenter"));
+  simd_node_sum.fill(Real3::zero());
+  ref_node_sum.fill(Real3::zero());
+
+  {
+    auto in_coords = viewIn(nodes_coord);
+    auto out_center = viewOut(simd_center);
+    auto out_node_sum = viewOut(simd_node_sum);
+    const Real inv_nb_node = 1.0 / static_cast<Real>(nb_node);
+    ENUMERATE_SIMD_CELL(icell,m_cells){
+      SimdCell vi(*icell);
+      SimdReal3 center(SimdReal(0.0),SimdReal(0.0),SimdReal(0.0));
+      for( Int32 n=0; n<nb_node; ++n ){
+        SimdConnectedItemIndexT<Cell,Node> node_index(cell_node,vi,n);
+        center = center + in_coords[node_index];
+      }
+      center = center * inv_nb_node;
+      out_center[vi] = center;
+      for( Int32 n=0; n<nb_node; ++n ){
+        SimdConnectedItemIndexT<Cell,Node> node_index(cell_node,vi,n);
+        out_node_sum.simdAdd(node_index,icell.nbValid(),center);
+      }
+    }
+  }
+
+  // L'ordre des additions aux noeuds n'est pas le même qu'en scalaire
+  // et on compare donc à un epsilon près.
+  auto is_nearly_equal = [](Real3 a,Real3 b){
+    return math::isNearlyEqual(a.x,b.x) && math::isNearlyEqual(a.y,b.y) && math::isNearlyEqual(a.z,b.z);
+  };
+  Integer nb_error = 0;
+  ENUMERATE_CELL(icell,m_cells){
+    Real3 center = Real3::zero();
+    for( NodeLocalId node : cell_node.nodes(icell) )
+      center += nodes_coord[node];
+    center /= static_cast<Real>(nb_node);
+    if (!is_nearly_equal(simd_center[icell],center)){
+      ++nb_error;
+      if (nb_error<10)
+        info() << "ERROR: Bad center e=" << center << " v=" << simd_center[icell] << " lid=" << icell.itemLocalId();
+    }
+    for( NodeLocalId node : cell_node.nodes(icell) )
+      ref_node_sum[node] += center;
+  }
+  ENUMERATE_NODE(inode,mesh->allNodes()){
+    if (!is_nearly_equal(simd_node_sum[inode],ref_node_sum[inode])){
+      ++nb_error;
+      if (nb_error<10)
+        info() << "ERROR: Bad node sum e=" << ref_node_sum[inode] << " v=" << simd_node_sum[inode] << " lid=" << inode.itemLocalId();
+    }
+  }
+  if (nb_error!=0)
+    ARCANE_FATAL("Errors in SIMD node gather/scatter test nb_error={0}",nb_error);
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -15,6 +15,7 @@
 
 #include "arcane/utils/ValueChecker.h"
 #include "arcane/utils/MemoryView.h"
+#include "arcane/utils/PlatformUtils.h"
 
 #include "arcane/BasicUnitTest.h"
 #include "arcane/ServiceFactory.h"
@@ -71,6 +72,7 @@ class AcceleratorFilterUnitTest
  private:
 
   void executeTest2(Int32 size, Int32 test_id);
+  void _executeBenchmark(Int32 size);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -117,6 +119,47 @@ executeTest()
     executeTest2(15, i);
     executeTest2(1000000, i);
   }
+  Int32 benchmark_size = options()->benchmarkSize();
+  if (benchmark_size > 0)
+    _executeBenchmark(benchmark_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Mesure le temps d'un filtrage avec la politique d'exécution de la file.
+ */
+void AcceleratorFilterUnitTest::
+_executeBenchmark(Int32 size)
+{
+  ValueChecker vc(A_FUNCINFO);
+
+  const Int32 nb_iteration = 10;
+  NumArray<double, MDDim1> t1(size);
+  NumArray<double, MDDim1> t2(size);
+  Int32 nb_expected = 0;
+  for (Int32 i = 0; i < size; ++i) {
+    double v = static_cast<double>(i % 17);
+    t1[i] = v;
+    if (v > 8.0)
+      ++nb_expected;
+  }
+  auto filter_lambda = [] ARCCORE_HOST_DEVICE(const double& x) -> bool {
+    return (x > 8.0);
+  };
+
+  Int32 nb_out = 0;
+  Real x0 = platform::getRealTime();
+  for (Int32 z = 0; z < nb_iteration; ++z) {
+    Arcane::Accelerator::Filterer<double> filterer(m_queue);
+    filterer.applyIf(t1, t2, filter_lambda);
+    nb_out = filterer.nbOutputElement();
+  }
+  Real x1 = platform::getRealTime();
+  info() << "Benchmark Filter policy=" << m_queue->executionPolicy()
+         << " size=" << size << " nb_iteration=" << nb_iteration
+         << " time_per_iteration=" << (x1 - x0) / nb_iteration;
+  vc.areEqual(nb_out, nb_expected, "BenchmarkFilter");
 }
 
 /*---------------------------------------------------------------------------*/
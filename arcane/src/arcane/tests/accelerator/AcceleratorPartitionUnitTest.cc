@@ -0,0 +1,187 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* AcceleratorPartitionUnitTest.cc                             (C) 2000-2023 */
+/*                                                                           */
+/* Service de test des algorithmes de partitionnement sur accélérateur.      */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/NumArray.h"
+
+#include "arcane/utils/ValueChecker.h"
+
+#include "arcane/BasicUnitTest.h"
+#include "arcane/ServiceFactory.h"
+
+#include "arcane/accelerator/core/RunQueueBuildInfo.h"
+#include "arcane/accelerator/core/Runner.h"
+
+#include "arcane/accelerator/core/IAcceleratorMng.h"
+
+#include "arcane/tests/accelerator/AcceleratorPartitionUnitTest_axl.h"
+#include "arcane/accelerator/Partition.h"
+
+#include <random>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace ArcaneTest
+{
+using namespace Arcane;
+namespace ax = Arcane::Accelerator;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Service de test de la classe 'GenericPartitioner'.
+ */
+class AcceleratorPartitionUnitTest
+: public ArcaneAcceleratorPartitionUnitTestObject
+{
+ public:
+
+  explicit AcceleratorPartitionUnitTest(const ServiceBuildInfo& cb);
+
+ public:
+
+  void initializeTest() override;
+  void executeTest() override;
+
+ private:
+
+  ax::RunQueue* m_queue = nullptr;
+
+ public:
+
+  template <typename DataType> void _executeTestDataType(Int32 size, Int32 test_id);
+
+ private:
+
+  void _executeTest2(Int32 size, Int32 test_id);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ARCANE_REGISTER_SERVICE_ACCELERATORPARTITIONUNITTEST(AcceleratorPartitionUnitTest, AcceleratorPartitionUnitTest);
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+AcceleratorPartitionUnitTest::
+AcceleratorPartitionUnitTest(const ServiceBuildInfo& sb)
+: ArcaneAcceleratorPartitionUnitTestObject(sb)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AcceleratorPartitionUnitTest::
+initializeTest()
+{
+  m_queue = subDomain()->acceleratorMng()->defaultQueue();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AcceleratorPartitionUnitTest::
+executeTest()
+{
+  for (Int32 i = 0; i < 2; ++i) {
+    _executeTest2(15, i);
+    _executeTest2(1000000, i);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AcceleratorPartitionUnitTest::
+_executeTest2(Int32 size, Int32 test_id)
+{
+  _executeTestDataType<Int64>(size, test_id);
+  _executeTestDataType<Int32>(size, test_id);
+  _executeTestDataType<double>(size, test_id);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+template <typename DataType> void AcceleratorPartitionUnitTest::
+_executeTestDataType(Int32 size, Int32 test_id)
+{
+  ValueChecker vc(A_FUNCINFO);
+
+  info() << "Execute Partition Test1 size=" << size << " test_id=" << test_id;
+
+  constexpr Int32 min_size_display = 100;
+  const Int32 n1 = size;
+
+  NumArray<DataType, MDDim1> t1(n1);
+  NumArray<DataType, MDDim1> t2(n1);
+  NumArray<DataType, MDDim1> expected_t2(n1);
+  NumArray<Int16, MDDim1> partition_flags(n1);
+
+  std::seed_seq rng_seed{ 37, 49, 23 };
+  std::mt19937 randomizer(rng_seed);
+  std::uniform_int_distribution<> rng_distrib(0, 32);
+  Int32 nb_first_part = 0;
+  Int32 last_index = n1 - 1;
+  for (Int32 i = 0; i < n1; ++i) {
+    int to_add = 2 + (rng_distrib(randomizer));
+    DataType v = static_cast<DataType>(to_add + ((i * 2) % 2348));
+    t1[i] = v;
+    t2[i] = 0;
+
+    bool is_first_part = (v > static_cast<DataType>(569));
+    if (is_first_part) {
+      expected_t2[nb_first_part] = v;
+      ++nb_first_part;
+    }
+    else {
+      expected_t2[last_index] = v;
+      --last_index;
+    }
+    partition_flags[i] = (is_first_part) ? 1 : 0;
+  }
+  if (n1 < min_size_display) {
+    info() << "T1=" << t1.to1DSpan();
+  }
+  info() << "Expected NbFirstPart=" << nb_first_part;
+
+  ax::GenericPartitioner<DataType> partitioner(m_queue);
+  switch (test_id) {
+  case 0: // Mode avec flag
+  {
+    SmallSpan<const Int16> partition_flags_view = partition_flags;
+    partitioner.apply(t1, t2, partition_flags_view);
+  } break;
+  case 1: // Mode avec lambda
+  {
+    auto select_lambda = [] ARCCORE_HOST_DEVICE(const DataType& x) -> bool {
+      return (x > static_cast<DataType>(569));
+    };
+    partitioner.applyIf(t1, t2, select_lambda);
+  } break;
+  }
+  Int32 nb_out = partitioner.nbFirstPart();
+  info() << "NB_FIRST_PART_accelerator=" << nb_out;
+  vc.areEqual(nb_first_part, nb_out, "NbFirstPart");
+  vc.areEqualArray(t2.to1DSpan(), expected_t2.to1DSpan(), "OutputArray");
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace ArcaneTest
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -15,6 +15,9 @@
 
 #include "arcane/utils/ValueChecker.h"
 #include "arcane/utils/MemoryView.h"
+#include "arcane/utils/ParallelLoopOptions.h"
+#include "arcane/utils/ExactRealSum.h"
+#include "arcane/utils/PlatformUtils.h"
 
 #include "arcane/BasicUnitTest.h"
 #include "arcane/ServiceFactory.h"
@@ -29,6 +32,9 @@
 
 #include "arcane/tests/accelerator/AcceleratorReduceUnitTest_axl.h"
 
+#include <cstring>
+#include <random>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -83,8 +89,34 @@ class AcceleratorReduceUnitTest
  private:
 
   void executeTest2(Int32 nb_iteration);
+  void _executeTestReproducible();
+  void _executeTestHostReducer();
+  void _executeTestReproducibleSum();
+  void _executeBenchmark(Int32 size);
+  Real _computeReproducibleSum(ax::RunQueue& queue, const NumArray<Real, MDDim1>& t1, Int32 max_thread);
 };
 
+namespace
+{
+  //! Structure pour tester les réductions sur plusieurs valeurs.
+  struct SumMaxCount
+  {
+    Real sum;
+    Real max;
+    Int64 count;
+  };
+  struct SumMaxCountOperator
+  {
+    ARCCORE_HOST_DEVICE static SumMaxCount identity() { return { 0.0, -DBL_MAX, 0 }; }
+    ARCCORE_HOST_DEVICE static void combine(SumMaxCount& a, const SumMaxCount& b)
+    {
+      a.sum += b.sum;
+      a.max = (b.max > a.max) ? b.max : a.max;
+      a.count += b.count;
+    }
+  };
+} // namespace
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -137,6 +169,12 @@ executeTest()
     m_runner.setDeviceReducePolicy(ax::eDeviceReducePolicy::Grid);
     executeTest2(10);
   }
+  _executeTestReproducible();
+  _executeTestHostReducer();
+  _executeTestReproducibleSum();
+  Int32 benchmark_size = options()->benchmarkSize();
+  if (benchmark_size > 0)
+    _executeBenchmark(benchmark_size);
 }
 
 void AcceleratorReduceUnitTest::
@@ -242,6 +280,200 @@ _executeTestDataType(Int32 nb_iteration)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+Real AcceleratorReduceUnitTest::
+_computeReproducibleSum(ax::RunQueue& queue, const NumArray<Real, MDDim1>& t1, Int32 max_thread)
+{
+  auto command = makeCommand(queue);
+  if (max_thread > 0) {
+    ParallelLoopOptions loop_options;
+    loop_options.setMaxThread(max_thread);
+    command.setParallelLoopOptions(loop_options);
+  }
+  ax::ReducerSum<Real> acc_sum(command);
+  auto in_t1 = viewIn(command, t1);
+  command << RUNCOMMAND_LOOP1(iter, t1.extent0())
+  {
+    acc_sum.add(in_t1(iter));
+  };
+  return acc_sum.reduce();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie qu'en multi-thread la somme ne dépend pas du nombre de threads.
+ */
+void AcceleratorReduceUnitTest::
+_executeTestReproducible()
+{
+  auto queue = makeQueue(m_runner);
+  if (queue.executionPolicy() != ax::eExecutionPolicy::Thread)
+    return;
+
+  // Utilise des valeurs d'ordres de grandeur très différents pour que
+  // le résultat dépende de l'ordre des additions.
+  const Int32 n1 = 1000003;
+  NumArray<Real, MDDim1> t1(n1);
+  std::mt19937_64 randomizer(42);
+  for (Int32 i = 0; i < n1; ++i) {
+    Real v = static_cast<Real>(randomizer() % 1000000) - 500000.0;
+    t1[i] = std::ldexp(v, static_cast<int>(randomizer() % 60) - 30);
+  }
+
+  Real ref_sum = _computeReproducibleSum(queue, t1, 1);
+  info() << "ReproducibleSum max_thread=1 sum=" << ref_sum;
+  for (Int32 max_thread : { 2, 3, 0 }) {
+    Real sum = _computeReproducibleSum(queue, t1, max_thread);
+    info() << "ReproducibleSum max_thread=" << max_thread << " sum=" << sum;
+    if (std::memcmp(&sum, &ref_sum, sizeof(Real)) != 0)
+      ARCANE_FATAL("Sum is not reproducible max_thread={0} sum={1} expected={2}",
+                   max_thread, sum, ref_sum);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Teste la réduction de plusieurs valeurs en une seule passe.
+ */
+void AcceleratorReduceUnitTest::
+_executeTestHostReducer()
+{
+  auto queue = makeQueue(m_runner);
+  if (isAcceleratorPolicy(queue.executionPolicy()))
+    return;
+
+  const Int32 n1 = 500000;
+  NumArray<Real, MDDim1> t1(n1);
+  Real expected_max = -DBL_MAX;
+  for (Int32 i = 0; i < n1; ++i) {
+    Real v = static_cast<Real>((i * 7) % 1031);
+    t1[i] = v;
+    expected_max = math::max(expected_max, v);
+  }
+  Real expected_sum = _computeReproducibleSum(queue, t1, 0);
+
+  auto command = makeCommand(queue);
+  ax::HostReducer<SumMaxCount, SumMaxCountOperator> reducer(command);
+  auto in_t1 = viewIn(command, t1);
+  command << RUNCOMMAND_LOOP1(iter, n1)
+  {
+    Real v = in_t1(iter);
+    reducer.combine({ v, v, 1 });
+  };
+  SumMaxCount r = reducer.reduce();
+  info() << "HostReducer sum=" << r.sum << " max=" << r.max << " count=" << r.count;
+  if (r.count != n1)
+    ARCANE_FATAL("Bad count v={0} expected={1}", r.count, n1);
+  if (r.max != expected_max)
+    ARCANE_FATAL("Bad max v={0} expected={1}", r.max, expected_max);
+  _compareSum(r.sum, expected_sum);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie que 'ReducerReproducibleSum' donne la somme exacte.
+ *
+ * Le résultat ne doit dépendre ni du nombre de threads ni de l'ordre des
+ * valeurs.
+ */
+void AcceleratorReduceUnitTest::
+_executeTestReproducibleSum()
+{
+  auto queue = makeQueue(m_runner);
+  if (isAcceleratorPolicy(queue.executionPolicy()))
+    return;
+
+  const Int32 n1 = 1000003;
+  NumArray<Real, MDDim1> t1(n1);
+  std::mt19937_64 randomizer(17);
+  ExactRealSum exact_sum;
+  for (Int32 i = 0; i < n1; ++i) {
+    Real v = static_cast<Real>(randomizer() % 1000000) - 500000.0;
+    v = std::ldexp(v, static_cast<int>(randomizer() % 200) - 100);
+    t1[i] = v;
+    exact_sum.add(v);
+  }
+  const Real expected_sum = exact_sum.toReal();
+
+  for (Int32 max_thread : { 1, 3, 0 }) {
+    // Inverse l'ordre des valeurs à chaque itération.
+    for (Int32 i = 0; i < n1 / 2; ++i)
+      std::swap(t1[i], t1[n1 - 1 - i]);
+    ParallelLoopOptions loop_options;
+    loop_options.setMaxThread(max_thread);
+    auto command = makeCommand(queue);
+    command.setParallelLoopOptions(loop_options);
+    ax::ReducerReproducibleSum reducer(command);
+    auto in_t1 = viewIn(command, t1);
+    command << RUNCOMMAND_LOOP1(iter, n1)
+    {
+      reducer.add(in_t1(iter));
+    };
+    Real sum = reducer.reduce();
+    info() << "ReducerReproducibleSum max_thread=" << max_thread << " sum=" << sum;
+    if (std::memcmp(&sum, &expected_sum, sizeof(Real)) != 0)
+      ARCANE_FATAL("Bad reproducible sum max_thread={0} sum={1} expected={2}",
+                   max_thread, sum, expected_sum);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Mesure le surcoût de 'ReducerReproducibleSum' par rapport à 'ReducerSum'.
+ */
+void AcceleratorReduceUnitTest::
+_executeBenchmark(Int32 size)
+{
+  auto queue = makeQueue(m_runner);
+  if (isAcceleratorPolicy(queue.executionPolicy()))
+    return;
+
+  const Int32 nb_iteration = 10;
+  NumArray<Real, MDDim1> t1(size);
+  for (Int32 i = 0; i < size; ++i)
+    t1[i] = static_cast<Real>(i % 1031) * 1.0e-3;
+
+  Real sum = 0.0;
+  Real x0 = platform::getRealTime();
+  for (Int32 z = 0; z < nb_iteration; ++z) {
+    auto command = makeCommand(queue);
+    ax::ReducerSum<Real> reducer(command);
+    auto in_t1 = viewIn(command, t1);
+    command << RUNCOMMAND_LOOP1(iter, size)
+    {
+      reducer.add(in_t1(iter));
+    };
+    sum = reducer.reduce();
+  }
+  Real x1 = platform::getRealTime();
+  Real reproducible_sum = 0.0;
+  for (Int32 z = 0; z < nb_iteration; ++z) {
+    auto command = makeCommand(queue);
+    ax::ReducerReproducibleSum reducer(command);
+    auto in_t1 = viewIn(command, t1);
+    command << RUNCOMMAND_LOOP1(iter, size)
+    {
+      reducer.add(in_t1(iter));
+    };
+    reproducible_sum = reducer.reduce();
+  }
+  Real x2 = platform::getRealTime();
+  Real sum_time = (x1 - x0) / nb_iteration;
+  Real reproducible_time = (x2 - x1) / nb_iteration;
+  info() << "Benchmark Reduce policy=" << queue.executionPolicy()
+         << " size=" << size << " nb_iteration=" << nb_iteration
+         << " time_per_iteration sum=" << sum_time
+         << " reproducible_sum=" << reproducible_time
+         << " ratio=" << ((sum_time > 0.0) ? (reproducible_time / sum_time) : 0.0);
+  _compareSum(reproducible_sum, sum);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 } // End namespace ArcaneTest
 
 /*---------------------------------------------------------------------------*/
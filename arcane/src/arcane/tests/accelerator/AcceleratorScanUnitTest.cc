@@ -15,6 +15,7 @@
 
 #include "arcane/utils/ValueChecker.h"
 #include "arcane/utils/MemoryView.h"
+#include "arcane/utils/PlatformUtils.h"
 
 #include "arcane/BasicUnitTest.h"
 #include "arcane/ServiceFactory.h"
@@ -71,6 +72,7 @@ class AcceleratorScanUnitTest
  private:
 
   void executeTest2(Int32 size, Int32 nb_iteration);
+  void _executeBenchmark(Int32 size);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -115,6 +117,41 @@ executeTest()
 {
   executeTest2(15, 10);
   executeTest2(1000000, 1);
+  Int32 benchmark_size = options()->benchmarkSize();
+  if (benchmark_size > 0)
+    _executeBenchmark(benchmark_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Mesure le temps d'un scan avec la politique d'exécution de la file.
+ */
+void AcceleratorScanUnitTest::
+_executeBenchmark(Int32 size)
+{
+  ValueChecker vc(A_FUNCINFO);
+
+  const Int32 nb_iteration = 10;
+  NumArray<double, MDDim1> t1(size);
+  NumArray<double, MDDim1> t2(size);
+  double expected_sum = 0.0;
+  for (Int32 i = 0; i < size; ++i) {
+    double v = static_cast<double>(i % 17);
+    t1[i] = v;
+    expected_sum += v;
+  }
+
+  Real x0 = platform::getRealTime();
+  for (Int32 z = 0; z < nb_iteration; ++z) {
+    ax::Scanner<double> scanner;
+    scanner.inclusiveSum(m_queue, t1, t2);
+  }
+  Real x1 = platform::getRealTime();
+  info() << "Benchmark Scan policy=" << m_queue->executionPolicy()
+         << " size=" << size << " nb_iteration=" << nb_iteration
+         << " time_per_iteration=" << (x1 - x0) / nb_iteration;
+  vc.areEqual(t2[size - 1], expected_sum, "BenchmarkInclusiveSum");
 }
 
 void AcceleratorScanUnitTest::
@@ -0,0 +1,254 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* AcceleratorSortUnitTest.cc                                  (C) 2000-2023 */
+/*                                                                           */
+/* Service de test des algorithmes de tri sur accélérateur.                  */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/NumArray.h"
+
+#include "arcane/utils/ValueChecker.h"
+#include "arcane/utils/PlatformUtils.h"
+
+#include "arcane/BasicUnitTest.h"
+#include "arcane/ServiceFactory.h"
+
+#include "arcane/accelerator/core/RunQueueBuildInfo.h"
+#include "arcane/accelerator/core/Runner.h"
+
+#include "arcane/accelerator/core/IAcceleratorMng.h"
+
+#include "arcane/tests/accelerator/AcceleratorSortUnitTest_axl.h"
+#include "arcane/accelerator/Sort.h"
+
+#include <algorithm>
+#include <random>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace ArcaneTest
+{
+using namespace Arcane;
+namespace ax = Arcane::Accelerator;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Service de test des classes 'GenericSorter' et 'GenericSegmentedSorter'.
+ */
+class AcceleratorSortUnitTest
+: public ArcaneAcceleratorSortUnitTestObject
+{
+ public:
+
+  explicit AcceleratorSortUnitTest(const ServiceBuildInfo& cb);
+
+ public:
+
+  void initializeTest() override;
+  void executeTest() override;
+
+ private:
+
+  ax::RunQueue* m_queue = nullptr;
+
+ public:
+
+  template <typename DataType> void _executeTestDataType(Int32 size);
+
+ private:
+
+  void _executeTest2(Int32 size);
+  void _executeBenchmark(Int32 size);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ARCANE_REGISTER_SERVICE_ACCELERATORSORTUNITTEST(AcceleratorSortUnitTest, AcceleratorSortUnitTest);
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+AcceleratorSortUnitTest::
+AcceleratorSortUnitTest(const ServiceBuildInfo& sb)
+: ArcaneAcceleratorSortUnitTestObject(sb)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AcceleratorSortUnitTest::
+initializeTest()
+{
+  m_queue = subDomain()->acceleratorMng()->defaultQueue();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AcceleratorSortUnitTest::
+executeTest()
+{
+  _executeTest2(15);
+  _executeTest2(1000000);
+  Int32 benchmark_size = options()->benchmarkSize();
+  if (benchmark_size > 0)
+    _executeBenchmark(benchmark_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AcceleratorSortUnitTest::
+_executeTest2(Int32 size)
+{
+  _executeTestDataType<Int64>(size);
+  _executeTestDataType<Int32>(size);
+  _executeTestDataType<Int16>(size);
+  _executeTestDataType<double>(size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+template <typename DataType> void AcceleratorSortUnitTest::
+_executeTestDataType(Int32 size)
+{
+  ValueChecker vc(A_FUNCINFO);
+
+  info() << "Execute Sort Test size=" << size;
+
+  constexpr Int32 min_size_display = 100;
+  const Int32 n1 = size;
+
+  NumArray<DataType, MDDim1> keys(n1);
+  NumArray<Int32, MDDim1> values(n1);
+  NumArray<DataType, MDDim1> keys_out(n1);
+  NumArray<Int32, MDDim1> values_out(n1);
+
+  // Utilise beaucoup de clés identiques pour vérifier que le tri est stable.
+  std::seed_seq rng_seed{ 37, 49, 23 };
+  std::mt19937 randomizer(rng_seed);
+  std::uniform_int_distribution<> rng_distrib(-500, 1000);
+  for (Int32 i = 0; i < n1; ++i) {
+    keys[i] = static_cast<DataType>(rng_distrib(randomizer));
+    values[i] = i;
+  }
+  if (n1 < min_size_display) {
+    info() << "Keys=" << keys.to1DSpan();
+  }
+
+  // Valeurs de référence
+  UniqueArray<Int32> expected_values(n1);
+  for (Int32 i = 0; i < n1; ++i)
+    expected_values[i] = i;
+  std::stable_sort(expected_values.begin(), expected_values.end(),
+                   [&](Int32 a, Int32 b) { return keys[a] < keys[b]; });
+  UniqueArray<DataType> expected_keys(n1);
+  for (Int32 i = 0; i < n1; ++i)
+    expected_keys[i] = keys[expected_values[i]];
+
+  {
+    ax::GenericSorter<DataType> sorter(m_queue);
+    sorter.apply(keys, keys_out);
+    m_queue->barrier();
+    vc.areEqualArray(keys_out.to1DSpan(), expected_keys.span(), "SortKeys");
+  }
+  {
+    ax::GenericSorter<DataType, Int32> sorter(m_queue);
+    sorter.apply(keys, keys_out, values, values_out);
+    m_queue->barrier();
+    vc.areEqualArray(keys_out.to1DSpan(), expected_keys.span(), "SortPairsKeys");
+    vc.areEqualArray(values_out.to1DSpan(), expected_values.span(), "SortPairsValues");
+  }
+
+  // Tri par segment. Les segments sont de taille variable et certains sont vides.
+  NumArray<Int32, MDDim1> segment_offsets;
+  {
+    UniqueArray<Int32> offsets;
+    offsets.add(0);
+    Int32 segment_index = 0;
+    while (offsets.back() < n1) {
+      Int32 segment_size = (segment_index * 7) % 53;
+      offsets.add(std::min(offsets.back() + segment_size, n1));
+      ++segment_index;
+    }
+    segment_offsets.resize(offsets.size());
+    for (Int32 i = 0, n = offsets.size(); i < n; ++i)
+      segment_offsets[i] = offsets[i];
+  }
+  const Int32 nb_segment = segment_offsets.extent0() - 1;
+  for (Int32 s = 0; s < nb_segment; ++s) {
+    Int32* begin = expected_values.data() + segment_offsets[s];
+    Int32* end = expected_values.data() + segment_offsets[s + 1];
+    for (Int32 i = segment_offsets[s]; i < segment_offsets[s + 1]; ++i)
+      expected_values[i] = i;
+    std::stable_sort(begin, end, [&](Int32 a, Int32 b) { return keys[a] < keys[b]; });
+  }
+  for (Int32 i = 0; i < n1; ++i)
+    expected_keys[i] = keys[expected_values[i]];
+  info() << "NbSegment=" << nb_segment;
+
+  {
+    ax::GenericSegmentedSorter<DataType> sorter(m_queue);
+    sorter.apply(segment_offsets, keys, keys_out);
+    m_queue->barrier();
+    vc.areEqualArray(keys_out.to1DSpan(), expected_keys.span(), "SegmentedSortKeys");
+  }
+  {
+    ax::GenericSegmentedSorter<DataType, Int32> sorter(m_queue);
+    sorter.apply(segment_offsets, keys, keys_out, values, values_out);
+    m_queue->barrier();
+    vc.areEqualArray(keys_out.to1DSpan(), expected_keys.span(), "SegmentedSortPairsKeys");
+    vc.areEqualArray(values_out.to1DSpan(), expected_values.span(), "SegmentedSortPairsValues");
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Mesure le temps d'un tri avec la politique d'exécution de la file.
+ */
+void AcceleratorSortUnitTest::
+_executeBenchmark(Int32 size)
+{
+  ValueChecker vc(A_FUNCINFO);
+
+  const Int32 nb_iteration = 10;
+  NumArray<Int64, MDDim1> keys(size);
+  NumArray<Int64, MDDim1> keys_out(size);
+  std::mt19937_64 randomizer(42);
+  for (Int32 i = 0; i < size; ++i)
+    keys[i] = static_cast<Int64>(randomizer() % 1000000000);
+
+  Real x0 = platform::getRealTime();
+  for (Int32 z = 0; z < nb_iteration; ++z) {
+    ax::GenericSorter<Int64> sorter(m_queue);
+    sorter.apply(keys, keys_out);
+  }
+  m_queue->barrier();
+  Real x1 = platform::getRealTime();
+  info() << "Benchmark Sort policy=" << m_queue->executionPolicy()
+         << " size=" << size << " nb_iteration=" << nb_iteration
+         << " time_per_iteration=" << (x1 - x0) / nb_iteration;
+  auto out_span = keys_out.to1DSpan();
+  bool is_sorted = std::is_sorted(out_span.begin(), out_span.end());
+  vc.areEqual(is_sorted, true, "BenchmarkSort");
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace ArcaneTest
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
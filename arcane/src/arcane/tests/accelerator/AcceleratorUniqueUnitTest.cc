@@ -0,0 +1,188 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* AcceleratorUniqueUnitTest.cc                                (C) 2000-2023 */
+/*                                                                           */
+/* Service de test des algorithmes 'Unique' et 'RunLengthEncode'.            */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/NumArray.h"
+
+#include "arcane/utils/ValueChecker.h"
+
+#include "arcane/BasicUnitTest.h"
+#include "arcane/ServiceFactory.h"
+
+#include "arcane/accelerator/core/RunQueueBuildInfo.h"
+#include "arcane/accelerator/core/Runner.h"
+
+#include "arcane/accelerator/core/IAcceleratorMng.h"
+
+#include "arcane/tests/accelerator/AcceleratorUniqueUnitTest_axl.h"
+#include "arcane/accelerator/Unique.h"
+
+#include <random>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace ArcaneTest
+{
+using namespace Arcane;
+namespace ax = Arcane::Accelerator;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Service de test des classes 'GenericUnique' et 'GenericRunLengthEncode'.
+ */
+class AcceleratorUniqueUnitTest
+: public ArcaneAcceleratorUniqueUnitTestObject
+{
+ public:
+
+  explicit AcceleratorUniqueUnitTest(const ServiceBuildInfo& cb);
+
+ public:
+
+  void initializeTest() override;
+  void executeTest() override;
+
+ private:
+
+  ax::RunQueue* m_queue = nullptr;
+
+ public:
+
+  template <typename DataType> void _executeTestDataType(Int32 size);
+
+ private:
+
+  void _executeTest2(Int32 size);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ARCANE_REGISTER_SERVICE_ACCELERATORUNIQUEUNITTEST(AcceleratorUniqueUnitTest, AcceleratorUniqueUnitTest);
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+AcceleratorUniqueUnitTest::
+AcceleratorUniqueUnitTest(const ServiceBuildInfo& sb)
+: ArcaneAcceleratorUniqueUnitTestObject(sb)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AcceleratorUniqueUnitTest::
+initializeTest()
+{
+  m_queue = subDomain()->acceleratorMng()->defaultQueue();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AcceleratorUniqueUnitTest::
+executeTest()
+{
+  _executeTest2(15);
+  _executeTest2(1000000);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AcceleratorUniqueUnitTest::
+_executeTest2(Int32 size)
+{
+  _executeTestDataType<Int64>(size);
+  _executeTestDataType<Int32>(size);
+  _executeTestDataType<double>(size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+template <typename DataType> void AcceleratorUniqueUnitTest::
+_executeTestDataType(Int32 size)
+{
+  ValueChecker vc(A_FUNCINFO);
+
+  info() << "Execute Unique Test1 size=" << size;
+
+  constexpr Int32 min_size_display = 100;
+  const Int32 n1 = size;
+
+  NumArray<DataType, MDDim1> t1(n1);
+  NumArray<DataType, MDDim1> t2(n1);
+  NumArray<Int32, MDDim1> counts(n1);
+  UniqueArray<DataType> expected_t2;
+  UniqueArray<Int32> expected_counts;
+
+  // Génère des plages de taille variable. Certaines sont assez longues
+  // pour être réparties sur plusieurs blocs en multi-thread.
+  std::seed_seq rng_seed{ 37, 49, 23 };
+  std::mt19937 randomizer(rng_seed);
+  std::uniform_int_distribution<> rng_distrib(0, 32);
+  Int32 current_value = 0;
+  for (Int32 i = 0; i < n1; ++i) {
+    Int32 r = rng_distrib(randomizer);
+    bool is_long_run = (i > 100000 && i < 300000);
+    bool is_new_run = (is_long_run) ? (i == 200000) : (r < 8);
+    if (is_new_run)
+      ++current_value;
+    DataType v = static_cast<DataType>(current_value);
+    t1[i] = v;
+    if (i == 0 || t1[i - 1] != v) {
+      expected_t2.add(v);
+      expected_counts.add(1);
+    }
+    else
+      ++expected_counts.back();
+  }
+  if (n1 < min_size_display) {
+    info() << "T1=" << t1.to1DSpan();
+  }
+  const Int32 nb_expected = expected_t2.size();
+  info() << "Expected NbUnique=" << nb_expected;
+
+  {
+    ax::GenericUnique<DataType> unique(m_queue);
+    unique.apply(t1, t2);
+    Int32 nb_out = unique.nbOutputElement();
+    info() << "NB_OUT_unique=" << nb_out;
+    vc.areEqual(nb_expected, nb_out, "NbUnique");
+    t2.resize(nb_out);
+    vc.areEqualArray(t2.to1DSpan(), expected_t2.span(), "UniqueOutput");
+  }
+  {
+    t2.resize(n1);
+    ax::GenericRunLengthEncode<DataType> encoder(m_queue);
+    encoder.apply(t1, t2, counts);
+    Int32 nb_run = encoder.nbRun();
+    info() << "NB_RUN=" << nb_run;
+    vc.areEqual(nb_expected, nb_run, "NbRun");
+    t2.resize(nb_run);
+    counts.resize(nb_run);
+    vc.areEqualArray(t2.to1DSpan(), expected_t2.span(), "RunLengthEncodeUnique");
+    vc.areEqualArray(counts.to1DSpan(), expected_counts.span(), "RunLengthEncodeCounts");
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace ArcaneTest
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
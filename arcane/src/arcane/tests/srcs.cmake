@@ -16,6 +16,7 @@ set(ARCANE_SOURCES
   ModuleSimpleHydroGeneric.cc
   ModuleSimpleHydroSimd.cc
   ModuleSimpleHydroDepend.cc
+  EntryPointGraphTesterModule.cc
   MeshMergeBoundariesUnitTest.cc
   MeshMergeNodesUnitTest.cc
   MeshUnitTest.cc
@@ -117,6 +118,9 @@ set(AXL_FILES
   accelerator/AcceleratorReduceUnitTest
   accelerator/AcceleratorScanUnitTest
   accelerator/AcceleratorFilterUnitTest
+  accelerator/AcceleratorSortUnitTest
+  accelerator/AcceleratorPartitionUnitTest
+  accelerator/AcceleratorUniqueUnitTest
   PDESRandomNumberGeneratorUnitTest
   RandomNumberGeneratorUnitTest
   ServiceInterface1ImplTest
@@ -0,0 +1,247 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* ExactRealSum.h                                              (C) 2000-2023 */
+/*                                                                           */
+/* Accumulateur exact pour les sommes reproductibles de réels.               */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_UTILS_EXACTREALSUM_H
+#define ARCANE_UTILS_EXACTREALSUM_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/ArrayView.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Accumulateur exact pour les sommes reproductibles de réels.
+ *
+ * Chaque valeur ajoutée est convertie sans perte en un entier en virgule
+ * fixe couvrant toute la plage des 'double' (le bit de poids faible vaut
+ * 2^-1074). Cet entier est découpé en NB_DIGIT chiffres de 32 bits
+ * conservés dans des entiers 64 bits ce qui permet d'effectuer un grand
+ * nombre d'additions avant de devoir propager les retenues.
+ *
+ * La somme de deux accumulateurs est une somme d'entiers et est donc
+ * associative et commutative. Le résultat de toReal() ne dépend ni de
+ * l'ordre des additions, ni du nombre de threads ou de processus utilisés
+ * pour calculer la somme.
+ *
+ * Les valeurs infinies et NaN sont comptées séparément et toReal()
+ * retourne le même résultat que la somme classique dans ce cas.
+ *
+ * L'instance occupe environ 600 octets. Pour échanger un accumulateur
+ * entre processus, il faut appeler normalize() puis utiliser words().
+ * La somme terme à terme de ces mots sur l'ensemble des processus donne
+ * la somme des accumulateurs (voir ParallelMngUtils::reduceExactSum()).
+ *
+ * \code
+ * ExactRealSum s;
+ * for( Real v : values )
+ *   s.add(v);
+ * Real r = s.toReal();
+ * \endcode
+ */
+class ExactRealSum
+{
+ public:
+
+  //! Nombre de chiffres de 32 bits de la partie en virgule fixe
+  static constexpr Int32 NB_DIGIT = 68;
+  //! Nombre de mots de words()
+  static constexpr Int32 NB_WORD = NB_DIGIT + 3;
+
+ private:
+
+  static constexpr Int32 DIGIT_NB_BIT = 32;
+  static constexpr Int64 DIGIT_MASK = 0xFFFFFFFF;
+  //! Exposant du bit de poids faible
+  static constexpr int MIN_EXPONENT = -1074;
+  //! Nombre d'additions avant de devoir propager les retenues
+  static constexpr Int32 MAX_PENDING = 1 << 28;
+  static constexpr Int32 NAN_INDEX = NB_DIGIT;
+  static constexpr Int32 POSITIVE_INFINITY_INDEX = NB_DIGIT + 1;
+  static constexpr Int32 NEGATIVE_INFINITY_INDEX = NB_DIGIT + 2;
+
+ public:
+
+  //! Créé un accumulateur de valeur nulle
+  ARCCORE_HOST_DEVICE ExactRealSum()
+  {
+    for (Int32 i = 0; i < NB_WORD; ++i)
+      m_words[i] = 0;
+  }
+
+  //! Créé un accumulateur contenant la valeur \a v
+  ARCCORE_HOST_DEVICE explicit ExactRealSum(Real v)
+  : ExactRealSum()
+  {
+    add(v);
+  }
+
+ public:
+
+  //! Ajoute la valeur \a v
+  ARCCORE_HOST_DEVICE void add(Real v)
+  {
+    UInt64 bits = 0;
+    std::memcpy(&bits, &v, sizeof(Real));
+    const bool is_negative = (bits >> 63) != 0;
+    const Int32 biased_exponent = static_cast<Int32>((bits >> 52) & 0x7FF);
+    UInt64 mantissa = bits & ((UInt64(1) << 52) - 1);
+    if (biased_exponent == 0x7FF) {
+      if (mantissa != 0)
+        ++m_words[NAN_INDEX];
+      else
+        ++m_words[(is_negative) ? NEGATIVE_INFINITY_INDEX : POSITIVE_INFINITY_INDEX];
+      return;
+    }
+    // Position du bit de poids faible de la mantisse par rapport à 2^-1074.
+    Int32 position = 0;
+    if (biased_exponent != 0) {
+      mantissa |= (UInt64(1) << 52);
+      position = biased_exponent - 1;
+    }
+    if (mantissa == 0)
+      return;
+    const Int32 index = position / DIGIT_NB_BIT;
+    const Int32 shift = position % DIGIT_NB_BIT;
+    // La mantisse décalée occupe au plus 84 bits, soit 3 chiffres.
+    const UInt64 low = (mantissa & DIGIT_MASK) << shift;
+    const UInt64 high = (mantissa >> DIGIT_NB_BIT) << shift;
+    const Int64 d0 = static_cast<Int64>(low & DIGIT_MASK);
+    const Int64 d1 = static_cast<Int64>((low >> DIGIT_NB_BIT) + (high & DIGIT_MASK));
+    const Int64 d2 = static_cast<Int64>(high >> DIGIT_NB_BIT);
+    if (is_negative) {
+      m_words[index] -= d0;
+      m_words[index + 1] -= d1;
+      m_words[index + 2] -= d2;
+    }
+    else {
+      m_words[index] += d0;
+      m_words[index + 1] += d1;
+      m_words[index + 2] += d2;
+    }
+    if (++m_nb_pending >= MAX_PENDING)
+      normalize();
+  }
+
+  //! Ajoute l'accumulateur \a v
+  ARCCORE_HOST_DEVICE void add(const ExactRealSum& v)
+  {
+    for (Int32 i = 0; i < NB_WORD; ++i)
+      m_words[i] += v.m_words[i];
+    m_nb_pending += v.m_nb_pending;
+    if (m_nb_pending >= MAX_PENDING)
+      normalize();
+  }
+
+  //! Ajoute la valeur \a v
+  ARCCORE_HOST_DEVICE void operator+=(Real v) { add(v); }
+
+  //! Ajoute l'accumulateur \a v
+  ARCCORE_HOST_DEVICE void operator+=(const ExactRealSum& v) { add(v); }
+
+  /*!
+   * \brief Propage les retenues.
+   *
+   * Après appel, tous les chiffres sauf le dernier sont compris entre
+   * 0 et 2^32-1. Le dernier chiffre porte le signe.
+   */
+  ARCCORE_HOST_DEVICE void normalize()
+  {
+    for (Int32 i = 0; i < (NB_DIGIT - 1); ++i) {
+      const Int64 x = m_words[i];
+      const Int64 low = x & DIGIT_MASK;
+      m_words[i] = low;
+      m_words[i + 1] += (x - low) / (DIGIT_MASK + 1);
+    }
+    m_nb_pending = 1;
+  }
+
+  /*!
+   * \brief Convertit la somme en réel.
+   *
+   * La conversion est déterministe mais n'est pas correctement arrondie :
+   * le résultat peut différer de quelques ulp de l'arrondi au plus proche
+   * de la somme exacte. Il est en revanche toujours le même pour une même
+   * somme exacte.
+   */
+  ARCCORE_HOST_DEVICE Real toReal() const
+  {
+    const bool has_positive_infinity = m_words[POSITIVE_INFINITY_INDEX] != 0;
+    const bool has_negative_infinity = m_words[NEGATIVE_INFINITY_INDEX] != 0;
+    if (m_words[NAN_INDEX] != 0 || (has_positive_infinity && has_negative_infinity))
+      return std::numeric_limits<Real>::quiet_NaN();
+    if (has_positive_infinity)
+      return std::numeric_limits<Real>::infinity();
+    if (has_negative_infinity)
+      return -std::numeric_limits<Real>::infinity();
+
+    ExactRealSum a(*this);
+    a.normalize();
+    // Travaille sur la valeur absolue pour que tous les chiffres soient
+    // positifs et éviter les annulations lors de la conversion.
+    const bool is_negative = a.m_words[NB_DIGIT - 1] < 0;
+    if (is_negative) {
+      for (Int32 i = 0; i < NB_DIGIT; ++i)
+        a.m_words[i] = -a.m_words[i];
+      a.normalize();
+    }
+    // Ajoute les chiffres par ordre croissant de poids.
+    Real r = 0.0;
+    for (Int32 i = 0; i < NB_DIGIT; ++i) {
+      if (a.m_words[i] != 0)
+        r += std::ldexp(static_cast<Real>(a.m_words[i]), MIN_EXPONENT + DIGIT_NB_BIT * i);
+    }
+    return (is_negative) ? -r : r;
+  }
+
+  /*!
+   * \brief Mots représentant l'accumulateur.
+   *
+   * Il faut appeler normalize() avant d'échanger ces valeurs.
+   */
+  ConstArrayView<Int64> words() const { return { NB_WORD, m_words }; }
+
+  //! Créé un accumulateur à partir des mots \a words issus de words()
+  static ExactRealSum fromWords(ConstArrayView<Int64> words)
+  {
+    ExactRealSum s;
+    for (Int32 i = 0; i < NB_WORD; ++i)
+      s.m_words[i] = words[i];
+    s.normalize();
+    return s;
+  }
+
+ private:
+
+  Int64 m_words[NB_WORD];
+  //! Borne (en nombre d'additions) de la valeur absolue des chiffres non normalisés
+  Int32 m_nb_pending = 1;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
@@ -0,0 +1,661 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* OpenHashTableMap.h                                          (C) 2000-2023 */
+/*                                                                           */
+/* Tableau associatif utilisant une table de hachage à adressage ouvert.     */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_UTILS_OPENHASHTABLEMAP_H
+#define ARCANE_UTILS_OPENHASHTABLEMAP_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/Array.h"
+#include "arcane/utils/HashFunction.h"
+#include "arcane/utils/FatalErrorException.h"
+
+#include <utility>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Table de hachage à adressage ouvert pour tableaux associatifs.
+ *
+ * Cette classe propose la même interface que HashTableMapT mais les
+ * couples (clé,valeur) sont conservés directement dans un tableau contigu
+ * au lieu d'être dans une liste chaînée par bucket. Les collisions sont
+ * gérées par sondage linéaire avec la technique dite "Robin Hood" : lors
+ * d'un ajout, un élément prend la place d'un élément plus proche de sa
+ * position idéale. Cela borne la longueur des recherches et permet
+ * de les arrêter dès qu'on rencontre un élément plus proche de sa position
+ * idéale que la clé recherchée. Les suppressions décalent les
+ * éléments suivants et ne laissent donc pas d'emplacements inutilisables.
+ *
+ * Pour chaque emplacement, on conserve dans un tableau séparé d'octets la
+ * distance (plus un) à la position idéale. La valeur 0 indique un
+ * emplacement libre. Une recherche ne lit donc en général qu'une ou deux
+ * lignes de cache.
+ *
+ * La taille de la table est toujours une puissance de 2 et la table est
+ * agrandie dès que le taux de remplissage dépasse 7/8.
+ *
+ * \warning Contrairement à HashTableMapT, les pointeurs sur Data retournés
+ * par lookup() ou lookupAdd() ne sont valides que jusqu'à la prochaine
+ * modification de la table (ajout ou suppression).
+ */
+template <typename KeyType, typename ValueType, typename KeyTraitsType = HashTraitsT<KeyType>>
+class OpenHashTableMapT
+{
+ public:
+
+  typedef typename KeyTraitsType::KeyTypeConstRef KeyTypeConstRef;
+  typedef typename KeyTraitsType::KeyTypeValue KeyTypeValue;
+  typedef OpenHashTableMapT<KeyType, ValueType, KeyTraitsType> ThatClass;
+
+ public:
+
+  struct Data
+  {
+   public:
+
+    Data()
+    : m_key(KeyTypeValue())
+    , m_value(ValueType())
+    {}
+    Data(KeyTypeConstRef key, const ValueType& value)
+    : m_key(key)
+    , m_value(value)
+    {}
+
+   public:
+
+    KeyTypeConstRef key() const { return m_key; }
+    const ValueType& value() const { return m_value; }
+    ValueType& value() { return m_value; }
+    //! Modifie la valeur de l'instance.
+    void setValue(const ValueType& avalue) { m_value = avalue; }
+    /*!
+     * \brief Change la valeur de la clé.
+     *
+     * Après avoir changé la valeur d'une ou plusieurs clés, il faut faire un rehash().
+     */
+    void setKey(const KeyType& new_key) { m_key = new_key; }
+
+   public:
+
+    KeyTypeValue m_key; //!< Clé de recherche
+    ValueType m_value; //!< Valeur de l'élément
+  };
+
+  //! Itérateur sur les éléments présents dans la table
+  class DataIterator
+  {
+   public:
+
+    DataIterator(Data* slots, const Byte* distances, Int64 index, Int64 size)
+    : m_slots(slots)
+    , m_distances(distances)
+    , m_index(index)
+    , m_size(size)
+    {
+      _skipEmpty();
+    }
+
+   public:
+
+    Data* operator*() const { return m_slots + m_index; }
+    DataIterator& operator++()
+    {
+      ++m_index;
+      _skipEmpty();
+      return *this;
+    }
+    friend bool operator!=(const DataIterator& a, const DataIterator& b)
+    {
+      return a.m_index != b.m_index;
+    }
+
+   private:
+
+    Data* m_slots;
+    const Byte* m_distances;
+    Int64 m_index;
+    Int64 m_size;
+
+   private:
+
+    void _skipEmpty()
+    {
+      while (m_index < m_size && m_distances[m_index] == 0)
+        ++m_index;
+    }
+  };
+
+  //! Intervalle d'itération sur les éléments présents dans la table
+  class DataRange
+  {
+   public:
+
+    DataRange(Data* slots, const Byte* distances, Int64 size)
+    : m_slots(slots)
+    , m_distances(distances)
+    , m_size(size)
+    {}
+
+   public:
+
+    DataIterator begin() const { return { m_slots, m_distances, 0, m_size }; }
+    DataIterator end() const { return { m_slots, m_distances, m_size, m_size }; }
+
+   private:
+
+    Data* m_slots;
+    const Byte* m_distances;
+    Int64 m_size;
+  };
+
+ private:
+
+  //! Distance maximale (plus un) d'un élément à sa position idéale
+  static constexpr Int32 MAX_DISTANCE = 255;
+  //! Nombre de clés traitées par bloc dans les opérations par lots
+  static constexpr Int32 BATCH_BLOCK_SIZE = 16;
+
+ public:
+
+  OpenHashTableMapT()
+  {
+    _allocate(MIN_CAPACITY);
+  }
+
+  //! Crée une table pouvant contenir au moins \a nb_element éléments sans être agrandie
+  explicit OpenHashTableMapT(Integer nb_element)
+  {
+    _allocate(_capacityForCount(nb_element));
+  }
+
+  OpenHashTableMapT(const ThatClass& rhs) = default;
+  ThatClass& operator=(const ThatClass& rhs) = default;
+
+ public:
+
+  //! Nombre d'éléments dans la table
+  Integer count() const { return m_count; }
+
+  //! Nombre d'emplacements de la table
+  Integer capacity() const { return m_slots.size(); }
+
+  //! \a true si une valeur avec la clé \a id est présente
+  bool hasKey(KeyTypeConstRef id) const
+  {
+    return _findIndex(id) >= 0;
+  }
+
+  //! Supprime tous les éléments de la table
+  void clear()
+  {
+    m_distances.fill(0);
+    m_count = 0;
+  }
+
+  /*!
+   * \brief Recherche la valeur correspondant à la clé \a id.
+   *
+   * \return la structure associé à la clé \a id (nullptr si aucune)
+   */
+  Data* lookup(KeyTypeConstRef id)
+  {
+    Int64 index = _findIndex(id);
+    return (index >= 0) ? &m_slots[index] : nullptr;
+  }
+
+  /*!
+   * \brief Recherche la valeur correspondant à la clé \a id.
+   *
+   * \return la structure associé à la clé \a id (nullptr si aucune)
+   */
+  const Data* lookup(KeyTypeConstRef id) const
+  {
+    Int64 index = _findIndex(id);
+    return (index >= 0) ? &m_slots[index] : nullptr;
+  }
+
+  /*!
+   * \brief Recherche la valeur correspondant à la clé \a id.
+   *
+   * Une exception est générée si la valeur n'est pas trouvé.
+   */
+  ValueType& lookupValue(KeyTypeConstRef id)
+  {
+    Int64 index = _findIndex(id);
+    if (index < 0)
+      _throwNotFound(id);
+    return m_slots[index].m_value;
+  }
+
+  /*!
+   * \brief Recherche la valeur correspondant à la clé \a id.
+   *
+   * Une exception est générée si la valeur n'est pas trouvé.
+   */
+  const ValueType& lookupValue(KeyTypeConstRef id) const
+  {
+    Int64 index = _findIndex(id);
+    if (index < 0)
+      _throwNotFound(id);
+    return m_slots[index].m_value;
+  }
+
+  ValueType& operator[](KeyTypeConstRef id) { return lookupValue(id); }
+  const ValueType& operator[](KeyTypeConstRef id) const { return lookupValue(id); }
+
+  /*!
+   * \brief Ajoute la valeur \a value correspondant à la clé \a id
+   *
+   * Si une valeur correspondant à \a id existe déjà, elle est remplacée.
+   *
+   * \retval true si la clé est ajoutée
+   * \retval false si la clé existe déjà et est remplacée
+   */
+  bool add(KeyTypeConstRef id, const ValueType& value)
+  {
+    Int64 index = _findIndex(id);
+    if (index >= 0) {
+      m_slots[index].m_value = value;
+      return false;
+    }
+    _insertNew(id, value);
+    return true;
+  }
+
+  /*!
+   * \brief Ajoute la valeur \a value correspondant à la clé \a id
+   *
+   * Si une valeur correspondant à \a id existe déjà, le résultat est
+   * indéfini.
+   */
+  void nocheckAdd(KeyTypeConstRef id, const ValueType& value)
+  {
+    _insertNew(id, value);
+  }
+
+  /*!
+   * \brief Supprime la valeur associée à la clé \a id
+   *
+   * Une exception est générée si la valeur n'est pas trouvé.
+   */
+  void remove(KeyTypeConstRef id)
+  {
+    Int64 index = _findIndex(id);
+    if (index < 0)
+      _throwNotFound(id);
+    _removeIndex(index);
+  }
+
+  /*!
+   * \brief Recherche ou ajoute la valeur correspondant à la clé \a id.
+   *
+   * Si la clé \a id est déjà dans la table, retourne une référence sur cette
+   * valeur et positionne \a is_add à \c false. Sinon, ajoute la clé \a id
+   * avec pour valeur \a value et positionne \a is_add à \c true.
+   *
+   * La structure retournée n'est valide que jusqu'à la prochaine
+   * modification de la table.
+   */
+  Data* lookupAdd(KeyTypeConstRef id, const ValueType& value, bool& is_add)
+  {
+    Int64 index = _findIndex(id);
+    is_add = (index < 0);
+    if (is_add)
+      index = _insertNew(id, value);
+    return &m_slots[index];
+  }
+
+  /*!
+   * \brief Recherche ou ajoute la valeur correspondant à la clé \a id.
+   *
+   * Si la clé \a id n'est pas dans la table, l'ajoute avec pour valeur
+   * \a ValueType() (qui doit exister).
+   *
+   * La structure retournée n'est valide que jusqu'à la prochaine
+   * modification de la table.
+   */
+  Data* lookupAdd(KeyTypeConstRef id)
+  {
+    bool is_add = false;
+    return lookupAdd(id, ValueType(), is_add);
+  }
+
+  /*!
+   * \brief Recherche les valeurs correspondant aux clés \a ids.
+   *
+   * En retour, \a datas[i] contient la structure associée à \a ids[i] ou
+   * \a nullptr si cette clé n'est pas présente. Les recherches sont
+   * effectuées par blocs: on calcule d'abord les positions idéales de
+   * toutes les clés du bloc et on précharge les zones mémoire
+   * correspondantes avant de faire les recherches, ce qui permet de
+   * recouvrir les défauts de cache.
+   */
+  void lookupMany(ConstArrayView<KeyTypeValue> ids, ArrayView<Data*> datas)
+  {
+    if (datas.size() < ids.size())
+      ARCANE_FATAL("Bad size for 'datas' ({0}<{1})", datas.size(), ids.size());
+    _lookupMany(ids, [&](Int32 i, Int64 index) {
+      datas[i] = (index >= 0) ? &m_slots[index] : nullptr;
+    });
+  }
+
+  //! Recherche les valeurs correspondant aux clés \a ids (version constante)
+  void lookupMany(ConstArrayView<KeyTypeValue> ids, ArrayView<const Data*> datas) const
+  {
+    if (datas.size() < ids.size())
+      ARCANE_FATAL("Bad size for 'datas' ({0}<{1})", datas.size(), ids.size());
+    _lookupMany(ids, [&](Int32 i, Int64 index) {
+      datas[i] = (index >= 0) ? &m_slots[index] : nullptr;
+    });
+  }
+
+  /*!
+   * \brief Ajoute les couples (\a ids[i], \a values[i]).
+   *
+   * Si une clé existe déjà, sa valeur est remplacée. La table est agrandie
+   * une seule fois au début de l'opération si nécessaire.
+   */
+  void addMany(ConstArrayView<KeyTypeValue> ids, ConstArrayView<ValueType> values)
+  {
+    const Int32 n = ids.size();
+    if (values.size() < n)
+      ARCANE_FATAL("Bad size for 'values' ({0}<{1})", values.size(), n);
+    reserve(m_count + n);
+    for (Int32 i = 0; i < n; ++i)
+      add(ids[i], values[i]);
+  }
+
+  //! Garantit que la table peut contenir \a nb_element éléments sans être agrandie
+  void reserve(Integer nb_element)
+  {
+    Int64 wanted_capacity = _capacityForCount(nb_element);
+    if (wanted_capacity > m_slots.size())
+      _rehash(wanted_capacity);
+  }
+
+  /*!
+   * \brief Redimensionne la table de hachage.
+   *
+   * Cette méthode existe pour compatibilité avec HashTableMapT et
+   * est équivalente à reserve(). L'argument \a use_prime est ignoré car la
+   * taille de la table est toujours une puissance de 2.
+   */
+  void resize(Integer new_size, [[maybe_unused]] bool use_prime = false)
+  {
+    reserve(new_size);
+  }
+
+  //! Repositionne les données après changement de valeur des clés
+  void rehash()
+  {
+    _rehash(m_slots.size());
+  }
+
+  //! Intervalle pour itérer sur les éléments de la table
+  DataRange dataRange()
+  {
+    return { m_slots.data(), m_distances.data(), m_slots.size() };
+  }
+
+  /*!
+   * \brief Longueur maximale de sondage.
+   *
+   * Il s'agit du nombre maximum d'emplacements à parcourir pour trouver
+   * une clé. Cette méthode parcourt toute la table et n'est utile que
+   * pour les statistiques.
+   */
+  Int32 maxProbeLength() const
+  {
+    Int32 max_distance = 0;
+    for (Byte d : m_distances)
+      max_distance = std::max(max_distance, static_cast<Int32>(d));
+    return max_distance;
+  }
+
+ public:
+
+  //! Applique le fonctor \a f à tous les éléments de la collection
+  template <class Lambda> void
+  each(const Lambda& lambda)
+  {
+    for (Data* d : dataRange())
+      lambda(d);
+  }
+
+  /*!
+   * \brief Applique le fonctor \a f à tous les éléments de la collection
+   * et utilise x->value() (de type ValueType) comme argument.
+   */
+  template <class Lambda> void
+  eachValue(const Lambda& lambda)
+  {
+    for (Data* d : dataRange())
+      lambda(d->value());
+  }
+
+ private:
+
+  static constexpr Int64 MIN_CAPACITY = 16;
+
+  UniqueArray<Data> m_slots;
+  //! Distance (plus un) de chaque élément à sa position idéale (0 si libre)
+  UniqueArray<Byte> m_distances;
+  Integer m_count = 0;
+  //! Nombre maximal d'élément avant retaillage
+  Integer m_max_count = 0;
+  //! Décalage pour convertir une valeur de hachage en position
+  Int32 m_hash_shift = 64;
+
+ private:
+
+  static void _prefetch([[maybe_unused]] const void* address)
+  {
+#if defined(__GNUC__)
+    __builtin_prefetch(address);
+#endif
+  }
+
+  static Int64 _capacityForCount(Int64 nb_element)
+  {
+    Int64 capacity = MIN_CAPACITY;
+    while ((capacity / 8) * 7 < nb_element)
+      capacity *= 2;
+    return capacity;
+  }
+
+  void _allocate(Int64 capacity)
+  {
+    m_slots.resize(capacity);
+    m_distances.resize(capacity);
+    m_distances.fill(0);
+    m_count = 0;
+    m_max_count = static_cast<Integer>((capacity / 8) * 7);
+    Int32 nb_bit = 0;
+    while ((Int64(1) << nb_bit) < capacity)
+      ++nb_bit;
+    m_hash_shift = 64 - nb_bit;
+  }
+
+  /*!
+   * \brief Position idéale de la clé \a id.
+   *
+   * La valeur de hachage est multipliée par une constante (hachage de
+   * Fibonacci) et on garde les bits de poids fort. Cela permet de répartir
+   * les clés même si la fonction de hachage donne des valeurs dont les bits
+   * de poids faible sont peu différents.
+   */
+  Int64 _idealPosition(KeyTypeConstRef id) const
+  {
+    UInt64 h = static_cast<UInt64>(KeyTraitsType::hashFunction(id));
+    return static_cast<Int64>((h * 11400714819323198485ULL) >> m_hash_shift);
+  }
+
+  Int64 _mask() const { return m_slots.size() - 1; }
+
+  /*!
+   * \brief Recherche par blocs les positions des clés \a ids.
+   *
+   * Appelle \a func(i,index) avec \a index la position de \a ids[i] ou (-1)
+   * si elle n'est pas présente.
+   */
+  template <typename Lambda> void
+  _lookupMany(ConstArrayView<KeyTypeValue> ids, const Lambda& func) const
+  {
+    const Int32 n = ids.size();
+    Int64 positions[BATCH_BLOCK_SIZE];
+    for (Int32 block_begin = 0; block_begin < n; block_begin += BATCH_BLOCK_SIZE) {
+      const Int32 block_size = std::min(BATCH_BLOCK_SIZE, n - block_begin);
+      for (Int32 i = 0; i < block_size; ++i) {
+        Int64 pos = _idealPosition(ids[block_begin + i]);
+        positions[i] = pos;
+        _prefetch(m_distances.data() + pos);
+        _prefetch(m_slots.data() + pos);
+      }
+      for (Int32 i = 0; i < block_size; ++i)
+        func(block_begin + i, _findIndexFrom(ids[block_begin + i], positions[i]));
+    }
+  }
+
+  Int64 _findIndex(KeyTypeConstRef id) const
+  {
+    return _findIndexFrom(id, _idealPosition(id));
+  }
+
+  Int64 _findIndexFrom(KeyTypeConstRef id, Int64 pos) const
+  {
+    const Int64 mask = _mask();
+    const Byte* distances = m_distances.data();
+    const Data* slots = m_slots.data();
+    for (Int32 dist = 1;; ++dist) {
+      Int32 d = distances[pos];
+      // Un élément plus proche de sa position idéale que ne le serait \a id
+      // ou un emplacement vide indique que \a id n'est pas présent.
+      if (d < dist)
+        return (-1);
+      if (d == dist && slots[pos].m_key == id)
+        return pos;
+      pos = (pos + 1) & mask;
+    }
+  }
+
+  /*!
+   * \brief Ajoute le couple (\a id, \a value) en supposant que \a id n'est
+   * pas présent.
+   *
+   * \return la position de \a id dans la table.
+   */
+  Int64 _insertNew(KeyTypeConstRef id, const ValueType& value)
+  {
+    if (m_count >= m_max_count)
+      _rehash(m_slots.size() * 2);
+    Int64 index = _insertNoGrow(Data(id, value));
+    // Si la table a été agrandie pendant l'ajout, la position n'est plus valide.
+    if (index < 0)
+      index = _findIndex(id);
+    return index;
+  }
+
+  /*!
+   * \brief Ajoute \a new_data sans agrandir la table sauf si une distance
+   * dépasse MAX_DISTANCE.
+   *
+   * \return la position de \a new_data dans la table ou (-1) si la table
+   * a été agrandie.
+   */
+  Int64 _insertNoGrow(Data new_data)
+  {
+    const Int64 mask = _mask();
+    Int64 pos = _idealPosition(new_data.m_key);
+    Int64 new_data_index = (-1);
+    Int32 dist = 1;
+    for (;;) {
+      Int32 d = m_distances[pos];
+      if (d == 0) {
+        m_slots[pos] = std::move(new_data);
+        m_distances[pos] = static_cast<Byte>(dist);
+        ++m_count;
+        return (new_data_index < 0) ? pos : new_data_index;
+      }
+      if (d < dist) {
+        // Prend la place de l'élément courant, plus proche de sa position
+        // idéale, et continue avec ce dernier.
+        std::swap(m_slots[pos], new_data);
+        m_distances[pos] = static_cast<Byte>(dist);
+        dist = d;
+        if (new_data_index < 0)
+          new_data_index = pos;
+      }
+      pos = (pos + 1) & mask;
+      ++dist;
+      if (dist >= MAX_DISTANCE) {
+        _rehash(m_slots.size() * 2);
+        _insertNoGrow(std::move(new_data));
+        return (-1);
+      }
+    }
+  }
+
+  //! Supprime l'élément en position \a index en décalant les éléments suivants
+  void _removeIndex(Int64 index)
+  {
+    const Int64 mask = _mask();
+    Int64 pos = index;
+    for (;;) {
+      Int64 next = (pos + 1) & mask;
+      Int32 d = m_distances[next];
+      if (d <= 1) {
+        m_distances[pos] = 0;
+        m_slots[pos] = Data();
+        break;
+      }
+      m_slots[pos] = std::move(m_slots[next]);
+      m_distances[pos] = static_cast<Byte>(d - 1);
+      pos = next;
+    }
+    --m_count;
+  }
+
+  void _rehash(Int64 new_capacity)
+  {
+    UniqueArray<Data> old_slots;
+    UniqueArray<Byte> old_distances;
+    old_slots.swap(m_slots);
+    old_distances.swap(m_distances);
+    _allocate(new_capacity);
+    for (Int64 i = 0, n = old_slots.size(); i < n; ++i)
+      if (old_distances[i] != 0)
+        _insertNoGrow(std::move(old_slots[i]));
+  }
+
+  void _throwNotFound ARCANE_NORETURN(KeyTypeConstRef id) const
+  {
+    ARCANE_FATAL("key '{0}' not found", id);
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* Simd.h                                                      (C) 2000-2017 */
+/* Simd.h                                                      (C) 2000-2023 */
 /*                                                                           */
 /* Types pour la vectorisation.                                              */
 /*---------------------------------------------------------------------------*/
@@ -156,12 +156,10 @@ class ARCANE_UTILS_EXPORT SimdReal3
   SimdReal z;
   SimdReal3() {}
   SimdReal3(SimdReal _x,SimdReal _y,SimdReal _z) : x(_x), y(_y), z(_z){}
+  //! Charge les valeurs de \a base d'indices \a idx (utilise si possible les instructions 'gather')
   SimdReal3(const Real3* base,const Int32IndexType& idx)
   {
-    for( Integer i=0, n=SimdReal::BLOCK_SIZE; i<n; ++i ){
-      Real3 v = base[idx[i]];
-      this->set(i,v);
-    }
+    impl::simdGatherReal3(_asReal(base),idx,x,y,z);
   }
   const Real3 operator[](Integer i) const { return Real3(x[i],y[i],z[i]); }
 
@@ -172,6 +170,19 @@ class ARCANE_UTILS_EXPORT SimdReal3
     }
   }
 
+  /*!
+   * \brief Ajoute les valeurs de l'instance aux valeurs de \a base d'indices \a idx.
+   *
+   * Seules les \a nb_valid premières composantes sont prises en compte.
+   * Contrairement à set(), plusieurs composantes peuvent avoir le même
+   * indice, ce qui est le cas par exemple lors de l'accumulation aux noeuds
+   * de valeurs calculées aux mailles.
+   */
+  void scatterAdd(Real3* base,const Int32IndexType& idx,Integer nb_valid) const
+  {
+    impl::simdScatterAddReal3(_asReal(base),idx,nb_valid,x,y,z);
+  }
+
   // TODO: renommer cette méthode
   void set(Integer i,Real3 r)
   {
@@ -183,6 +194,12 @@ class ARCANE_UTILS_EXPORT SimdReal3
   {
     return Real3(x[i],y[i],z[i]);
   }
+
+ private:
+
+  static_assert(sizeof(Real3)==3*sizeof(Real),"Real3 has to be three contiguous Real");
+  static const Real* _asReal(const Real3* v) { return reinterpret_cast<const Real*>(v); }
+  static Real* _asReal(Real3* v) { return reinterpret_cast<Real*>(v); }
 };
 
 /*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* SimdAVX.h                                                   (C) 2000-2016 */
+/* SimdAVX.h                                                   (C) 2000-2023 */
 /*                                                                           */
 /* Vectorisation pour AVX et AVX2.                                           */
 /*---------------------------------------------------------------------------*/
@@ -341,6 +341,28 @@ ARCANE_UTILS_EXPORT std::ostream& operator<<(std::ostream& o,const AVXSimdReal&
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+#ifdef __AVX2__
+namespace impl
+{
+/*!
+ * \internal
+ * \brief Lecture avec indirection de triplets de réels via le gather de l'AVX2.
+ */
+inline void
+simdGatherReal3(const Real* base, const SSESimdX4Int32& idx,
+                AVXSimdX4Real& x, AVXSimdX4Real& y, AVXSimdX4Real& z)
+{
+  __m128i idx3 = _mm_mullo_epi32(idx.v0, _mm_set1_epi32(3));
+  x.v0 = _mm256_i32gather_pd(base, idx3, 8);
+  y.v0 = _mm256_i32gather_pd(base + 1, idx3, 8);
+  z.v0 = _mm256_i32gather_pd(base + 2, idx3, 8);
+}
+} // namespace impl
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 ARCANE_END_NAMESPACE
 
 /*---------------------------------------------------------------------------*/
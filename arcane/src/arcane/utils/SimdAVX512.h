@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* SimdAVX512.h                                                (C) 2000-2016 */
+/* SimdAVX512.h                                                (C) 2000-2023 */
 /*                                                                           */
 /* Vectorisation pour l'AVX512.                                              */
 /*---------------------------------------------------------------------------*/
@@ -161,6 +161,57 @@ ARCANE_UTILS_EXPORT std::ostream& operator<<(std::ostream& o,const AVX512SimdRea
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+namespace impl
+{
+/*!
+ * \internal
+ * \brief Lecture avec indirection de triplets de réels via le gather de l'AVX512.
+ */
+inline void
+simdGatherReal3(const Real* base, const AVXSimdX8Int32& idx,
+                AVX512SimdReal& x, AVX512SimdReal& y, AVX512SimdReal& z)
+{
+  __m256i idx3 = _mm256_mullo_epi32(idx.v0, _mm256_set1_epi32(3));
+  x.v0 = _mm512_i32gather_pd(idx3, base, 8);
+  y.v0 = _mm512_i32gather_pd(idx3, base + 1, 8);
+  z.v0 = _mm512_i32gather_pd(idx3, base + 2, 8);
+}
+
+#ifdef __AVX512CD__
+/*!
+ * \internal
+ * \brief Ajout avec indirection de triplets de réels via le scatter de l'AVX512.
+ *
+ * L'instruction de détection de conflits de l'AVX512CD permet de vérifier
+ * qu'aucun indice n'est présent plusieurs fois dans \a idx. Si c'est le cas,
+ * on utilise la version scalaire.
+ */
+inline void
+simdScatterAddReal3(Real* base, const AVXSimdX8Int32& idx, Integer nb_valid,
+                    const AVX512SimdReal& x, const AVX512SimdReal& y, const AVX512SimdReal& z)
+{
+  const __mmask8 mask = static_cast<__mmask8>((1 << nb_valid) - 1);
+  // Seules les composantes de 'mask' sont comparées. Les composantes au dela
+  // de la 8-ème ne sont pas utilisées.
+  __m512i conflicts = _mm512_maskz_conflict_epi32(mask, _mm512_castsi256_si512(idx.v0));
+  if (_mm512_test_epi32_mask(conflicts, conflicts) != 0) {
+    simdScatterAddReal3Scalar(base, idx, nb_valid, x, y, z);
+    return;
+  }
+  __m256i idx3 = _mm256_mullo_epi32(idx.v0, _mm256_set1_epi32(3));
+  __m512d vx = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, idx3, base, 8);
+  __m512d vy = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, idx3, base + 1, 8);
+  __m512d vz = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, idx3, base + 2, 8);
+  _mm512_mask_i32scatter_pd(base, mask, idx3, _mm512_add_pd(vx, x.v0), 8);
+  _mm512_mask_i32scatter_pd(base + 1, mask, idx3, _mm512_add_pd(vy, y.v0), 8);
+  _mm512_mask_i32scatter_pd(base + 2, mask, idx3, _mm512_add_pd(vz, z.v0), 8);
+}
+#endif
+} // namespace impl
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 ARCANE_END_NAMESPACE
 
 /*---------------------------------------------------------------------------*/
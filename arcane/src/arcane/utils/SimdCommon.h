@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* SimdCommnon.h                                               (C) 2000-2014 */
+/* SimdCommnon.h                                               (C) 2000-2023 */
 /*                                                                           */
 /* Types communs à tous les mécanismes de vectorisation.                     */
 /*---------------------------------------------------------------------------*/
@@ -24,6 +24,85 @@ ARCANE_BEGIN_NAMESPACE
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+namespace impl
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Lecture avec indirection de triplets de réels (version scalaire).
+ *
+ * Pour chaque composante \a i du vecteur, lit les trois réels consécutifs
+ * situés à l'adresse \a base + 3 * \a idx[i] et les range dans \a x,
+ * \a y et \a z. Cela correspond à la lecture d'un tableau de Real3.
+ */
+template <typename SimdRealType, typename IndexType> inline void
+simdGatherReal3Scalar(const Real* base, const IndexType& idx,
+                      SimdRealType& x, SimdRealType& y, SimdRealType& z)
+{
+  for (Integer i = 0, n = SimdRealType::BLOCK_SIZE; i < n; ++i) {
+    const Real* p = base + 3 * static_cast<Int64>(idx[i]);
+    x[i] = p[0];
+    y[i] = p[1];
+    z[i] = p[2];
+  }
+}
+
+/*!
+ * \internal
+ * \brief Ajout avec indirection de triplets de réels (version scalaire).
+ *
+ * Seules les \a nb_valid premières composantes sont prises en compte.
+ * Les composantes sont traitées séquentiellement et donc plusieurs
+ * composantes peuvent avoir le même indice.
+ */
+template <typename SimdRealType, typename IndexType> inline void
+simdScatterAddReal3Scalar(Real* base, const IndexType& idx, Integer nb_valid,
+                          const SimdRealType& x, const SimdRealType& y, const SimdRealType& z)
+{
+  for (Integer i = 0; i < nb_valid; ++i) {
+    Real* p = base + 3 * static_cast<Int64>(idx[i]);
+    p[0] += x[i];
+    p[1] += y[i];
+    p[2] += z[i];
+  }
+}
+
+/*!
+ * \internal
+ * \brief Lecture avec indirection de triplets de réels.
+ *
+ * Cette version générique est surchargée pour les mécanismes de
+ * vectorisation qui disposent d'instructions de type 'gather'.
+ */
+template <typename SimdRealType, typename IndexType> inline void
+simdGatherReal3(const Real* base, const IndexType& idx,
+                SimdRealType& x, SimdRealType& y, SimdRealType& z)
+{
+  simdGatherReal3Scalar(base, idx, x, y, z);
+}
+
+/*!
+ * \internal
+ * \brief Ajout avec indirection de triplets de réels.
+ *
+ * Cette version générique est surchargée pour les mécanismes de
+ * vectorisation qui disposent d'instructions de type 'scatter' et
+ * de détection de conflits.
+ */
+template <typename SimdRealType, typename IndexType> inline void
+simdScatterAddReal3(Real* base, const IndexType& idx, Integer nb_valid,
+                    const SimdRealType& x, const SimdRealType& y, const SimdRealType& z)
+{
+  simdScatterAddReal3Scalar(base, idx, nb_valid, x, y, z);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace impl
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
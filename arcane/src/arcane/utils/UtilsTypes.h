@@ -188,6 +188,7 @@ using RealN3x3 = NumMatrix<Real,3>;
 /*---------------------------------------------------------------------------*/
 
 class HPReal;
+class ExactRealSum;
 class JSONWriter;
 class JSONValue;
 class JSONDocument;
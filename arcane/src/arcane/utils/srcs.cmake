@@ -39,6 +39,7 @@ set(ARCANE_SOURCES
   Exception.cc
   Event.cc
   Event.h
+  ExactRealSum.h
   FixedArray.h
   Float16.h
   FloatingPointExceptionSentry.cc
@@ -272,6 +273,7 @@ set(ARCANE_SOURCES
   NotSupportedException.h
   NullThreadMng.h
   HashTableMap.h
+  OpenHashTableMap.h
   ObjectImpl.h
   ParameterList.h
   ParameterList.cc
@@ -0,0 +1,127 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "arcane/utils/ExactRealSum.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+using namespace Arcane;
+
+namespace
+{
+bool _isBitwiseEqual(Real a, Real b)
+{
+  return std::memcmp(&a, &b, sizeof(Real)) == 0;
+}
+} // namespace
+
+TEST(TestExactRealSum, Exact)
+{
+  {
+    ExactRealSum s;
+    ASSERT_EQ(s.toReal(), 0.0);
+    s.add(-0.0);
+    ASSERT_EQ(s.toReal(), 0.0);
+  }
+  {
+    ExactRealSum s;
+    s.add(1.0e100);
+    s.add(1.0);
+    s.add(-1.0e100);
+    ASSERT_EQ(s.toReal(), 1.0);
+  }
+  {
+    ExactRealSum s(-3.5);
+    s += 1.25;
+    ASSERT_EQ(s.toReal(), -2.25);
+  }
+  {
+    // Plus petit nombre dénormalisé et plus grand nombre représentable.
+    Real min_value = std::numeric_limits<Real>::denorm_min();
+    Real max_value = std::numeric_limits<Real>::max();
+    ExactRealSum s;
+    s.add(max_value);
+    s.add(min_value);
+    s.add(-max_value);
+    ASSERT_EQ(s.toReal(), min_value);
+  }
+  {
+    // Dépasse le nombre d'additions avant propagation des retenues en
+    // fusionnant des accumulateurs : chaque fusion double le nombre
+    // d'additions en attente.
+    const Real v = -1.0 / 3.0;
+    ExactRealSum s(v);
+    const Int32 nb_merge = 40;
+    for (Int32 i = 0; i < nb_merge; ++i) {
+      ExactRealSum copy(s);
+      s.add(copy);
+    }
+    ASSERT_EQ(s.toReal(), std::ldexp(v, nb_merge));
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+TEST(TestExactRealSum, Special)
+{
+  const Real inf = std::numeric_limits<Real>::infinity();
+  ExactRealSum s(2.0);
+  s.add(inf);
+  ASSERT_EQ(s.toReal(), inf);
+  ExactRealSum s2(-inf);
+  ASSERT_EQ(s2.toReal(), -inf);
+  s.add(s2);
+  ASSERT_TRUE(std::isnan(s.toReal()));
+  ExactRealSum s3(std::numeric_limits<Real>::quiet_NaN());
+  ASSERT_TRUE(std::isnan(s3.toReal()));
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+TEST(TestExactRealSum, Reproducible)
+{
+  std::mt19937_64 randomizer(42);
+  std::uniform_real_distribution<Real> value_distrib(-1.0, 1.0);
+  std::uniform_int_distribution<int> exponent_distrib(-300, 300);
+  std::vector<Real> values(100000);
+  for (Real& v : values)
+    v = std::ldexp(value_distrib(randomizer), exponent_distrib(randomizer));
+
+  ExactRealSum reference;
+  for (Real v : values)
+    reference.add(v);
+  const Real reference_value = reference.toReal();
+
+  // Le résultat ne doit dépendre ni de l'ordre des valeurs ni du découpage
+  // en sommes partielles, y compris après passage par words().
+  for (Int32 nb_part : { 1, 2, 7, 64 }) {
+    std::shuffle(values.begin(), values.end(), randomizer);
+    const Int32 n = static_cast<Int32>(values.size());
+    ExactRealSum total;
+    for (Int32 p = 0; p < nb_part; ++p) {
+      ExactRealSum partial;
+      for (Int32 i = (n * p) / nb_part; i < (n * (p + 1)) / nb_part; ++i)
+        partial.add(values[i]);
+      partial.normalize();
+      total.add(ExactRealSum::fromWords(partial.words()));
+    }
+    ASSERT_TRUE(_isBitwiseEqual(total.toReal(), reference_value)) << "nb_part=" << nb_part;
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
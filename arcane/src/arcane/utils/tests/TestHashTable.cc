@@ -8,8 +8,13 @@
 #include <gtest/gtest.h>
 
 #include "arcane/utils/HashTableMap.h"
+#include "arcane/utils/OpenHashTableMap.h"
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/ValueConvert.h"
 #include "arcane/utils/String.h"
 
+#include <iostream>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -91,3 +96,182 @@ TEST(TestHashTable, Misc)
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
+
+TEST(TestHashTable, OpenHashTable)
+{
+  {
+    OpenHashTableMapT<Int64, String> hash1;
+
+    ASSERT_EQ(hash1.count(), 0);
+    ASSERT_TRUE(hash1.add(25, "Test1"));
+    ASSERT_EQ(hash1.count(), 1);
+
+    ASSERT_TRUE(hash1.add(32, "Test2"));
+    ASSERT_FALSE(hash1.add(32, "Test3"));
+    ASSERT_EQ(hash1.count(), 2);
+
+    ASSERT_TRUE(hash1.hasKey(32));
+    ASSERT_FALSE(hash1.hasKey(47));
+    ASSERT_EQ(hash1.lookup(47), nullptr);
+
+    ASSERT_EQ(hash1[32], "Test3");
+    ASSERT_EQ(hash1[25], "Test1");
+
+    hash1.remove(32);
+    ASSERT_FALSE(hash1.hasKey(32));
+    ASSERT_EQ(hash1.count(), 1);
+
+    bool is_add = false;
+    auto* d = hash1.lookupAdd(32, "Test4", is_add);
+    ASSERT_TRUE(is_add);
+    ASSERT_EQ(d->value(), "Test4");
+    d = hash1.lookupAdd(32, "Test5", is_add);
+    ASSERT_FALSE(is_add);
+    ASSERT_EQ(d->value(), "Test4");
+    ASSERT_EQ(hash1.count(), 2);
+
+    hash1.clear();
+    ASSERT_EQ(hash1.count(), 0);
+    ASSERT_FALSE(hash1.hasKey(25));
+  }
+  {
+    // Ajoute et supprime un grand nombre de clés pour tester les
+    // agrandissements et les décalages lors des suppressions.
+    OpenHashTableMapT<Int64, Int32> hash2;
+    const int n = 100000;
+    for (int i = 0; i < n; ++i)
+      hash2.add(i * 7 + 1, i);
+    ASSERT_EQ(hash2.count(), n);
+    for (int i = 0; i < n; i += 2)
+      hash2.remove(i * 7 + 1);
+    ASSERT_EQ(hash2.count(), n / 2);
+    for (int i = 0; i < n; ++i) {
+      if ((i % 2) == 0)
+        ASSERT_FALSE(hash2.hasKey(i * 7 + 1));
+      else
+        ASSERT_EQ(hash2[i * 7 + 1], i);
+    }
+    Int64 nb_enumerated = 0;
+    for (auto* d : hash2.dataRange()) {
+      ASSERT_EQ(d->value() * 7 + 1, d->key());
+      ++nb_enumerated;
+    }
+    ASSERT_EQ(nb_enumerated, n / 2);
+
+    // Change les clés et vérifie que rehash() les repositionne.
+    for (auto* d : hash2.dataRange())
+      d->setKey(d->key() + 3);
+    hash2.rehash();
+    ASSERT_EQ(hash2.count(), n / 2);
+    for (int i = 1; i < n; i += 2)
+      ASSERT_EQ(hash2[i * 7 + 4], i);
+
+    OpenHashTableMapT<Int64, Int32> hash3;
+    hash3 = hash2;
+    ASSERT_EQ(hash3.count(), n / 2);
+    for (int i = 1; i < n; i += 2)
+      ASSERT_EQ(hash3[i * 7 + 4], i);
+  }
+  {
+    // Opérations par lots
+    OpenHashTableMapT<Int64, Int32> hash4;
+    const int n = 5000;
+    UniqueArray<Int64> keys(n);
+    UniqueArray<Int32> values(n);
+    for (int i = 0; i < n; ++i) {
+      keys[i] = (Int64(i) << 32) + 5;
+      values[i] = i;
+    }
+    hash4.addMany(keys, values);
+    ASSERT_EQ(hash4.count(), n);
+    keys.add(-1);
+    UniqueArray<OpenHashTableMapT<Int64, Int32>::Data*> datas(keys.size());
+    hash4.lookupMany(keys, datas);
+    for (int i = 0; i < n; ++i) {
+      ASSERT_NE(datas[i], nullptr);
+      ASSERT_EQ(datas[i]->value(), i);
+    }
+    ASSERT_EQ(datas[n], nullptr);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*
+ * Compare les performances de HashTableMapT et OpenHashTableMapT pour des
+ * clés et valeurs similaires à celles utilisées pour les entités du maillage.
+ * Le nombre d'éléments peut être modifié via la variable d'environnement
+ * ARCANE_TEST_HASHTABLE_BENCH_SIZE.
+ */
+namespace
+{
+template <typename HashType> void
+_doBenchmark(const String& name, HashType& hash, ConstArrayView<Int64> keys,
+             ConstArrayView<Int64> lookup_keys)
+{
+  const Int32 n = keys.size();
+  Real t0 = platform::getRealTime();
+  for (Int32 i = 0; i < n; ++i)
+    hash.add(keys[i], i);
+  Real t1 = platform::getRealTime();
+  Int64 sum = 0;
+  for (Int64 uid : lookup_keys) {
+    auto* d = hash.lookup(uid);
+    if (d)
+      sum += d->value();
+  }
+  Real t2 = platform::getRealTime();
+  for (Int32 i = 0; i < n; i += 2)
+    hash.remove(keys[i]);
+  Real t3 = platform::getRealTime();
+  std::cout << "HashTableBench name=" << name << " n=" << n
+            << " add=" << (t1 - t0) << " lookup=" << (t2 - t1)
+            << " remove=" << (t3 - t2) << " sum=" << sum << "\n";
+  ASSERT_EQ(hash.count(), n / 2);
+}
+} // namespace
+
+TEST(TestHashTable, OpenHashTableBenchmark)
+{
+  Int32 n = 500000;
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_TEST_HASHTABLE_BENCH_SIZE", true))
+    n = v.value();
+  UniqueArray<Int64> keys(n);
+  // Les uniqueId sont souvent proches les uns des autres mais
+  // pas forcément contigus.
+  for (Int32 i = 0; i < n; ++i)
+    keys[i] = Int64(i) * 3 + (i % 7);
+  UniqueArray<Int64> lookup_keys(n);
+  for (Int32 i = 0; i < n; ++i)
+    lookup_keys[i] = keys[(Int64(i) * 7919) % n];
+
+  {
+    HashTableMapT<Int64, Int32> hash(5000, false);
+    _doBenchmark("Chained", hash, keys, lookup_keys);
+  }
+  {
+    OpenHashTableMapT<Int64, Int32> hash;
+    _doBenchmark("OpenAddressing", hash, keys, lookup_keys);
+  }
+  {
+    OpenHashTableMapT<Int64, Int32> hash;
+    UniqueArray<OpenHashTableMapT<Int64, Int32>::Data*> datas(n);
+    Real t0 = platform::getRealTime();
+    UniqueArray<Int32> values(n);
+    for (Int32 i = 0; i < n; ++i)
+      values[i] = i;
+    hash.addMany(keys, values);
+    Real t1 = platform::getRealTime();
+    hash.lookupMany(lookup_keys, datas);
+    Real t2 = platform::getRealTime();
+    Int64 sum = 0;
+    for (auto* d : datas)
+      sum += d->value();
+    std::cout << "HashTableBench name=OpenAddressingBatch n=" << n
+              << " add=" << (t1 - t0) << " lookup=" << (t2 - t1)
+              << " sum=" << sum << " max_probe=" << hash.maxProbeLength() << "\n";
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/